@@ -9,6 +9,8 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
 
+#include "storm/storage/dd/DdOperationStatistics.h"
+
 #include <type_traits>
 #include <ctime>
 #include <boost/algorithm/string/replace.hpp>
@@ -62,6 +64,9 @@ namespace storm {
             if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
+            if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isDdStatisticsSet()) {
+                storm::cli::exportDdStatistics(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getDdStatisticsFilename());
+            }
 
             storm::utility::cleanUp();
             return 0;
@@ -206,6 +211,11 @@ namespace storm {
             if (resources.isTimeoutSet()) {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
+            
+            // If requested, we start recording statistics about the DD operations.
+            if (resources.isDdStatisticsSet()) {
+                storm::dd::DdOperationStatistics::getInstance().setEnabled(true);
+            }
         }
         
         void setLogLevel() {
@@ -265,6 +275,13 @@ namespace storm {
             }
         }
 
+        void exportDdStatistics(std::string const& filename) {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            storm::dd::DdOperationStatistics::getInstance().exportToJson(stream);
+            storm::utility::closeFile(stream);
+        }
+
         void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
             struct rusage ru;
             getrusage(RUSAGE_SELF, &ru);
@@ -23,6 +23,8 @@ namespace storm {
         void printVersion(std::string const& name);
             
         void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0);
+
+        void exportDdStatistics(std::string const& filename);
         
         /*!
          * Parses the given command line arguments.
@@ -2,6 +2,9 @@
 
 #include <queue>
 #include <chrono>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include "storm/solver/Z3SmtSolver.h"
 
@@ -35,8 +38,14 @@ namespace storm {
          */
         template <class T>
         class SMTMinimalLabelSetGenerator {
+        public:
+            struct Options;
+            struct GeneratorStats;
+            
 #ifdef STORM_HAVE_Z3
         private:
+            struct PortfolioInformation;
+            
             struct RelevancyInformation {
                 // The set of relevant states in the model.
                 storm::storage::BitVector relevantStates;
@@ -1183,19 +1192,47 @@ namespace storm {
              * @param variableInformation A structure with information about the variables of the solver.
              * @param currentBound The currently known lower bound for the number of labels that need to be enabled
              * in order to satisfy the constraint system.
+             * @param portfolio If given, the solver belongs to the given strategy of this portfolio and no check is
+             * started once the portfolio is done.
+             * @param strategy The index of the strategy in the portfolio.
              * @return The smallest set of labels such that the constraint system of the solver is satisfiable.
              */
-            static boost::optional<boost::container::flat_set<uint_fast64_t>> findSmallestCommandSet(storm::solver::SmtSolver& solver, VariableInformation& variableInformation, uint_fast64_t& currentBound) {
+            static boost::optional<boost::container::flat_set<uint_fast64_t>> findSmallestCommandSet(storm::solver::SmtSolver& solver, VariableInformation& variableInformation, uint_fast64_t& currentBound, PortfolioInformation* portfolio = nullptr, uint64_t strategy = 0) {
                 // Check if we can find a solution with the current bound.
                 storm::expressions::Expression assumption = !variableInformation.auxiliaryVariables.back();
 
+                // Checks the constraint system under the current assumption. Within a portfolio, the check is
+                // registered so that it can be interrupted and it is not even started if the portfolio is done.
+                auto checkWithCurrentAssumption = [&] () {
+                    if (portfolio && !portfolio->beginCheck(strategy)) {
+                        return storm::solver::SmtSolver::CheckResult::Unknown;
+                    }
+                    storm::solver::SmtSolver::CheckResult result;
+                    try {
+                        result = solver.checkWithAssumptions({assumption});
+                    } catch (...) {
+                        if (portfolio) {
+                            portfolio->endCheck(strategy);
+                        }
+                        throw;
+                    }
+                    if (portfolio) {
+                        portfolio->endCheck(strategy);
+                    }
+                    return result;
+                };
+                
                 // As long as the constraints are unsatisfiable, we need to relax the last at-most-k constraint and
                 // try with an increased bound.
-                while (solver.checkWithAssumptions({assumption}) == storm::solver::SmtSolver::CheckResult::Unsat) {
+                storm::solver::SmtSolver::CheckResult checkResult;
+                while ((checkResult = checkWithCurrentAssumption()) == storm::solver::SmtSolver::CheckResult::Unsat) {
                     STORM_LOG_DEBUG("Constraint system is unsatisfiable with at most " << currentBound << " taken commands; increasing bound.");
 #ifndef NDEBUG
-                    STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
-                    STORM_LOG_ASSERT(solver.check() == storm::solver::SmtSolver::CheckResult::Sat, "Constraint system is not satisfiable anymore.");
+                    // Within a portfolio, the sanity check could be interrupted, so it is only performed otherwise.
+                    if (!portfolio) {
+                        STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
+                        STORM_LOG_ASSERT(solver.check() == storm::solver::SmtSolver::CheckResult::Sat, "Constraint system is not satisfiable anymore.");
+                    }
 #endif
                     solver.add(variableInformation.auxiliaryVariables.back());
                     variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(solver, variableInformation, ++currentBound));
@@ -1206,6 +1243,12 @@ namespace storm {
                     }
                 }
                 
+                // If the solver could not decide the constraint system (e.g. because it was interrupted), we give up.
+                if (checkResult == storm::solver::SmtSolver::CheckResult::Unknown) {
+                    STORM_LOG_DEBUG("Solver could not decide the constraint system.");
+                    return boost::none;
+                }
+                
                 // At this point we know that the constraint system was satisfiable, so compute the induced label
                 // set and return it.
                 return getUsedLabelSet(*solver.getModel(), variableInformation);
@@ -1475,143 +1518,97 @@ namespace storm {
                 STORM_LOG_DEBUG("Asserting reachability implications.");
                 assertDisjunction(solver, formulae, *variableInformation.manager);
             }
-#endif
-        
             
             /*!
-             * Returns the sub-model obtained from removing all choices that do not originate from the specified filterLabelSet.
-             * Also returns the Labelsets of the sub-model.
+             * The information that is shared among the strategies of a portfolio that concurrently search for a minimal
+             * label set.
              */
-            static std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<boost::container::flat_set<uint_fast64_t>>> restrictModelToLabelSet(storm::models::sparse::Model<T> const& model,  boost::container::flat_set<uint_fast64_t> const& filterLabelSet, boost::optional<std::string> const& rewardName = boost::none, boost::optional<uint64_t> absorbState = boost::none) {
-
-                bool customRowGrouping = model.isOfType(storm::models::ModelType::Mdp);
-                
-                std::vector<boost::container::flat_set<uint_fast64_t>> resultLabelSet;
-                storm::storage::SparseMatrixBuilder<T> transitionMatrixBuilder(0, model.getTransitionMatrix().getColumnCount(), 0, true, customRowGrouping, model.getTransitionMatrix().getRowGroupCount());
-
-                // Check for each choice of each state, whether the choice commands are fully contained in the given command set.
-                uint_fast64_t currentRow = 0;
-                for(uint_fast64_t state = 0; state < model.getNumberOfStates(); ++state) {
-                    bool stateHasValidChoice = false;
-                    for (uint_fast64_t choice = model.getTransitionMatrix().getRowGroupIndices()[state]; choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
-                        auto const& choiceLabelSet = model.getChoiceOrigins()->isPrismChoiceOrigins() ? model.getChoiceOrigins()->asPrismChoiceOrigins().getCommandSet(choice) : model.getChoiceOrigins()->asJaniChoiceOrigins().getEdgeIndexSet(choice);
-                        bool choiceValid = std::includes(filterLabelSet.begin(), filterLabelSet.end(), choiceLabelSet.begin(), choiceLabelSet.end());
-
-                        // If the choice is valid, copy over all its elements.
-                        if (choiceValid) {
-                            if (!stateHasValidChoice && customRowGrouping) {
-                                transitionMatrixBuilder.newRowGroup(currentRow);
-                            }
-                            stateHasValidChoice = true;
-                            for (auto const& entry : model.getTransitionMatrix().getRow(choice)) {
-                                transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
-                            }
-                            resultLabelSet.push_back(choiceLabelSet);
-                            ++currentRow;
-                        }
+            struct PortfolioInformation {
+                PortfolioInformation(std::vector<storm::solver::SmtSolver*> const& solvers) : solvers(solvers), checking(solvers.size()), lowerBound(0), done(false) {
+                    // Intentionally left empty.
+                }
+                
+                /*!
+                 * Registers that the solver of the given strategy is about to check its constraint system.
+                 *
+                 * @return False iff the portfolio is already done, in which case the check must not be started.
+                 */
+                bool beginCheck(uint64_t strategy) {
+                    // Setting the flag before testing the done flag guarantees that either this strategy sees that the
+                    // portfolio is done or the finishing strategy sees the flag and keeps interrupting the check.
+                    checking[strategy] = true;
+                    if (done) {
+                        checking[strategy] = false;
+                        return false;
                     }
-
-                    // If no choice of the current state may be taken, we insert a self-loop to the state instead.
-                    if (!stateHasValidChoice) {
-                        if (customRowGrouping) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
+                    return true;
+                }
+                
+                /*!
+                 * Registers that the solver of the given strategy finished checking its constraint system.
+                 */
+                void endCheck(uint64_t strategy) {
+                    checking[strategy] = false;
+                }
+                
+                /*!
+                 * Marks the portfolio as done because the given strategy found a counterexample and interrupts the
+                 * checks of all other strategies. As an interrupt is lost if it arrives before the solver started the
+                 * check, it is re-issued until the respective check finished.
+                 */
+                void finish(uint64_t strategy) {
+                    done = true;
+                    for (uint64_t otherStrategy = 0; otherStrategy < solvers.size(); ++otherStrategy) {
+                        if (otherStrategy != strategy) {
+                            while (checking[otherStrategy]) {
+                                solvers[otherStrategy]->interrupt();
+                                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                            }
                         }
-                        uint64_t targetState = absorbState == boost::none ? state : absorbState.get();
-                        transitionMatrixBuilder.addNextValue(currentRow, targetState, storm::utility::one<T>());
-                        // Insert an empty label set for this choice
-                        resultLabelSet.emplace_back();
-                        ++currentRow;
                     }
-
-                }
-
-                if (rewardName) {
-                    auto const &origRewModel = model.getRewardModel(rewardName.get());
-                    assert(origRewModel.hasOnlyStateRewards());
-                }
-
-                std::shared_ptr<storm::models::sparse::Model<T>> resultModel;
-                if (model.isOfType(storm::models::ModelType::Dtmc)) {
-                    resultModel = std::make_shared<storm::models::sparse::Dtmc<T>>(transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
-                } else {
-                    resultModel = std::make_shared<storm::models::sparse::Mdp<T>>(transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
                 }
                 
-                return std::make_pair(resultModel, std::move(resultLabelSet));
-            }
-
-            static T computeMaximalReachabilityProbability(Environment const& env, storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<std::string> const& rewardName) {
-                T result = storm::utility::zero<T>();
+                // The solvers of all strategies. They are used to interrupt the remaining strategies as soon as one of
+                // them found a counterexample.
+                std::vector<storm::solver::SmtSolver*> solvers;
                 
-                std::vector<T> allStatesResult;
+                // For each strategy, a flag indicating whether its solver is currently checking its constraint system.
+                std::vector<std::atomic<bool>> checking;
                 
-                STORM_LOG_DEBUG("Invoking model checker.");
-                if (model.isOfType(storm::models::ModelType::Dtmc)) {
-                    if (rewardName == boost::none) {
-                        allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeUntilProbabilities(env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), phiStates, psiStates, false);
-                    } else {
-                        allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeReachabilityRewards(env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), model.getRewardModel(rewardName.get()), psiStates, false);
-                    }
-                } else {
-                    if (rewardName == boost::none) {
-                        storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelCheckerHelper;
-                        allStatesResult = std::move(modelCheckerHelper.computeUntilProbabilities(env, false, model.getTransitionMatrix(),model.getBackwardTransitions(), phiStates,psiStates, false, false).values);
-                    } else {
-                        STORM_LOG_THROW(rewardName != boost::none, storm::exceptions::NotSupportedException, "Reward property counterexample generation is currently only supported for DTMCs.");
-                    }
-                }
-                for (auto state : model.getInitialStates()) {
-                    result = std::max(result, allStatesResult[state]);
-                }
-                return result;
-            }
-            
-        public:
-            struct Options {
-                Options(bool checkThresholdFeasible = false) : checkThresholdFeasible(checkThresholdFeasible) {
-                    auto const& settings = storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>();
-                    
-                    encodeReachability = settings.isEncodeReachabilitySet();
-                    useDynamicConstraints = settings.isUseDynamicConstraintsSet();
-                }
+                // A mutex guarding the shared information below.
+                std::mutex mutex;
                 
-                bool checkThresholdFeasible;
-                bool encodeReachability;
-                bool useDynamicConstraints;
-                bool silent = false;
-                uint64_t continueAfterFirstCounterexampleUntil = 0;
-                uint64_t maximumCounterexamples = 1;
-                uint64_t multipleCounterexampleSizeCap = 100000000;
-            };
-
-            struct GeneratorStats {
-                std::chrono::milliseconds setupTime;
-                std::chrono::milliseconds solverTime;
-                std::chrono::milliseconds modelCheckingTime;
-                std::chrono::milliseconds analysisTime;
+                // The label sets that were found to not be counterexamples by any of the strategies.
+                std::vector<boost::container::flat_set<uint_fast64_t>> refutedLabelSets;
+                
+                // A lower bound on the number of (minimality) labels of a counterexample that one of the strategies
+                // proved.
+                uint64_t lowerBound;
+                
+                // A flag indicating whether one of the strategies found a counterexample.
+                std::atomic<bool> done;
             };
             
             /*!
-             * Computes the minimal command set that is needed in the given model to exceed the given probability threshold for satisfying phi until psi.
+             * Searches for minimal label sets with the given solver, which is assumed to not hold any assertions yet.
              *
-             * @param symbolicModel The symbolic model description that was used to build the model.
-             * @param model The sparse model in which to find the minimal command set.
-             * @param phiStates A bit vector characterizing all phi states in the model.
-             * @param psiStates A bit vector characterizing all psi states in the model.
-             * @param propertyThreshold The threshold that is to be achieved or exceeded.
-             * @param rewardName The name of the reward structure to use, or boost::none if probabilities are considerd.
-             * @param strictBound Indicates whether the threshold needs to be achieved (true) or exceeded (false).
-             * @param options A set of options for customization.
+             * @param labelSets The label sets of the choices of the model.
+             * @param relevancyInformation The relevant states and labels of the model.
+             * @param manager The expression manager of the solver.
+             * @param solver The solver to use.
+             * @param startTime The point in time at which the computation was started.
+             * @param portfolio If given, the search is one strategy of a portfolio and exchanges lower bounds and refuted
+             * label sets with the other strategies.
+             * @param strategy The index of the strategy in the portfolio.
              */
-            static std::vector<boost::container::flat_set<uint_fast64_t>> getMinimalLabelSet(Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, double propertyThreshold, boost::optional<std::string> const& rewardName, bool strictBound, boost::container::flat_set<uint_fast64_t> const& dontCareLabels = boost::container::flat_set<uint_fast64_t>(), Options const& options = Options()) {
-#ifdef STORM_HAVE_Z3
+            static std::vector<boost::container::flat_set<uint_fast64_t>> searchMinimalLabelSets(Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, std::vector<boost::container::flat_set<uint_fast64_t>> const& labelSets, RelevancyInformation const& relevancyInformation, std::shared_ptr<storm::expressions::ExpressionManager> const& manager, storm::solver::SmtSolver& solver, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, double propertyThreshold, boost::optional<std::string> const& rewardName, bool strictBound, Options const& options, std::chrono::high_resolution_clock::time_point const& startTime, PortfolioInformation* portfolio = nullptr, uint64_t strategy = 0) {
                 std::vector<boost::container::flat_set<uint_fast64_t>> result;
                 // Set up all clocks used for time measurement.
-                auto totalClock = std::chrono::high_resolution_clock::now();
+                auto totalClock = startTime;
                 auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
                 decltype(std::chrono::high_resolution_clock::now() - totalClock) totalTime(0);
                 
-                auto setupTimeClock = std::chrono::high_resolution_clock::now();
+                auto setupTimeClock = startTime;
                 decltype(std::chrono::high_resolution_clock::now() - setupTimeClock) totalSetupTime(0);
                 
                 auto solverClock = std::chrono::high_resolution_clock::now();
@@ -1623,41 +1620,6 @@ namespace storm {
                 auto analysisClock = std::chrono::high_resolution_clock::now();
                 decltype(std::chrono::high_resolution_clock::now() - analysisClock) totalAnalysisTime(0);
 
-                // (0) Obtain the label sets for each choice.
-                // The label set of a choice corresponds to the set of prism commands that induce the choice.
-                STORM_LOG_THROW(model.hasChoiceOrigins(), storm::exceptions::InvalidArgumentException, "Restriction to minimal command set is impossible for model without choice origins.");
-                STORM_LOG_THROW(model.getChoiceOrigins()->isPrismChoiceOrigins() || model.getChoiceOrigins()->isJaniChoiceOrigins(), storm::exceptions::InvalidArgumentException, "Restriction to label set is impossible for model without PRISM or JANI choice origins.");
-                
-                std::vector<boost::container::flat_set<uint_fast64_t>> labelSets(model.getNumberOfChoices());
-                if (model.getChoiceOrigins()->isPrismChoiceOrigins()) {
-                    storm::storage::sparse::PrismChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asPrismChoiceOrigins();
-                    for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
-                        labelSets[choice] = choiceOrigins.getCommandSet(choice);
-                    }
-                } else {
-                    storm::storage::sparse::JaniChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asJaniChoiceOrigins();
-                    for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
-                        labelSets[choice] = choiceOrigins.getEdgeIndexSet(choice);
-                    }
-                }
-                assert(labelSets.size() == model.getNumberOfChoices());
-                
-                // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
-                double maximalReachabilityProbability = 0;
-                if (options.checkThresholdFeasible) {
-                    maximalReachabilityProbability = computeMaximalReachabilityProbability(env, model, phiStates, psiStates, rewardName);
-                    
-                    STORM_LOG_THROW((strictBound && maximalReachabilityProbability >= propertyThreshold) || (!strictBound && maximalReachabilityProbability > propertyThreshold), storm::exceptions::InvalidArgumentException, "Given probability threshold " << propertyThreshold << " can not be " << (strictBound ? "achieved" : "exceeded") << " in model with maximal reachability probability of " << maximalReachabilityProbability << ".");
-                    std::cout << std::endl << "Maximal property value in model is " << maximalReachabilityProbability << "." << std::endl << std::endl;
-                }
-                
-                // (2) Identify all states and commands that are relevant, because only these need to be considered later.
-                RelevancyInformation relevancyInformation = determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels);
-                
-                // (3) Create a solver.
-                std::shared_ptr<storm::expressions::ExpressionManager> manager = std::make_shared<storm::expressions::ExpressionManager>();
-                std::unique_ptr<storm::solver::SmtSolver> solver = std::make_unique<storm::solver::Z3SmtSolver>(*manager);
-                
                 // (4) Create the variables for the relevant commands.
                 VariableInformation variableInformation = createVariables(manager, model, psiStates, relevancyInformation, options.encodeReachability);
                 STORM_LOG_DEBUG("Created variables.");
@@ -1665,15 +1627,15 @@ namespace storm {
                 // (5) Now assert an adder whose result variables can later be used to constrain the nummber of label
                 // variables that were set to true. Initially, we are looking for a solution that has no label enabled
                 // and subsequently relax that.
-                variableInformation.adderVariables = assertAdder(*solver, variableInformation);
-                variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(*solver, variableInformation, 0));
+                variableInformation.adderVariables = assertAdder(solver, variableInformation);
+                variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(solver, variableInformation, 0));
                 
                 // (6) Add constraints that cut off a lot of suboptimal solutions.
                 STORM_LOG_DEBUG("Asserting cuts.");
-                assertCuts(symbolicModel, model, labelSets, psiStates, variableInformation, relevancyInformation, *solver);
+                assertCuts(symbolicModel, model, labelSets, psiStates, variableInformation, relevancyInformation, solver);
                 STORM_LOG_DEBUG("Asserted cuts.");
                 if (options.encodeReachability) {
-                    assertReachabilityCuts(model, labelSets, psiStates, variableInformation, relevancyInformation, *solver);
+                    assertReachabilityCuts(model, labelSets, psiStates, variableInformation, relevancyInformation, solver);
                     STORM_LOG_DEBUG("Asserted reachability cuts.");
                 }
                 
@@ -1687,14 +1649,6 @@ namespace storm {
 
                 boost::container::flat_set<uint_fast64_t> commandSet(relevancyInformation.knownLabels);
                 
-                // If there are no relevant labels, return directly.
-                if (relevancyInformation.relevantLabels.empty()) {
-                    return {commandSet};
-                } else if (relevancyInformation.minimalityLabels.empty()) {
-                    commandSet.insert(relevancyInformation.relevantLabels.begin(), relevancyInformation.relevantLabels.end());
-                    return {commandSet};
-                }
-                
                 // Set up some variables for the iterations.
                 bool done = false;
                 uint_fast64_t lastSize = 0;
@@ -1704,10 +1658,27 @@ namespace storm {
                 uint_fast64_t zeroProbabilityCount = 0;
                 uint64_t smallestCounterexampleSize = model.getNumberOfChoices(); // Definitive u
                 uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
+                uint64_t numberOfImportedRefutedLabelSets = 0;
                 do {
+                    if (portfolio) {
+                        if (portfolio->done) {
+                            break;
+                        }
+                        
+                        // Take over the label sets refuted and the lower bound proved by the other strategies.
+                        std::lock_guard<std::mutex> lock(portfolio->mutex);
+                        for (; numberOfImportedRefutedLabelSets < portfolio->refutedLabelSets.size(); ++numberOfImportedRefutedLabelSets) {
+                            ruleOutSingleSolution(solver, portfolio->refutedLabelSets[numberOfImportedRefutedLabelSets], variableInformation, relevancyInformation);
+                        }
+                        while (currentBound < portfolio->lowerBound) {
+                            solver.add(variableInformation.auxiliaryVariables.back());
+                            variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(solver, variableInformation, ++currentBound));
+                        }
+                    }
+                    
                     STORM_LOG_DEBUG("Computing minimal command set.");
                     solverClock = std::chrono::high_resolution_clock::now();
-                    boost::optional<boost::container::flat_set<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+                    boost::optional<boost::container::flat_set<uint_fast64_t>> smallest = findSmallestCommandSet(solver, variableInformation, currentBound, portfolio, strategy);
                     totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
                     if(smallest == boost::none) {
                         STORM_LOG_DEBUG("No further counterexamples.");
@@ -1717,6 +1688,12 @@ namespace storm {
                     }
                     STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound <<  " and set of size " <<  commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size() << " + " << relevancyInformation.knownLabels.size() << ") ");
                     
+                    if (portfolio) {
+                        // As the solver found no solution with fewer labels, the current bound is a lower bound for all strategies.
+                        std::lock_guard<std::mutex> lock(portfolio->mutex);
+                        portfolio->lowerBound = std::max<uint64_t>(portfolio->lowerBound, currentBound);
+                    }
+                    
                     // Restrict the given model to the current set of labels and compute the reachability probability.
                     modelCheckingClock = std::chrono::high_resolution_clock::now();
                     commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
@@ -1748,26 +1725,32 @@ namespace storm {
                             
                             if (reachableStates.isDisjointFrom(psiStates)) {
                                 // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                                analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                                analyzeZeroProbabilitySolution(solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
                             } else {
                                 // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient to exceed
                                 // the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                                analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
+                                analyzeInsufficientProbabilitySolution(solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
                             }
 
                             if (relevancyInformation.dontCareLabels.size() > 0) {
-                                ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                                ruleOutSingleSolution(solver, commandSet, variableInformation, relevancyInformation);
                             }
                         } else {
                             // Do not guide solver, just rule out current solution.
-                            ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                            ruleOutSingleSolution(solver, commandSet, variableInformation, relevancyInformation);
+                        }
+                        
+                        if (portfolio) {
+                            // Let the other strategies rule out this label set as well.
+                            std::lock_guard<std::mutex> lock(portfolio->mutex);
+                            portfolio->refutedLabelSets.push_back(commandSet);
                         }
                     } else {
                         STORM_LOG_DEBUG("Found a counterexample.");
                         result.push_back(commandSet);
                         if (options.maximumCounterexamples > result.size()) {
                             STORM_LOG_DEBUG("Exclude counterexample for future.");
-                            ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
+                            ruleOutBiggerSolutions(solver, commandSet, variableInformation, relevancyInformation);
 
                         } else {
                             STORM_LOG_DEBUG("Stop searching for further counterexamples.");
@@ -1780,7 +1763,7 @@ namespace storm {
 
                     auto now = std::chrono::high_resolution_clock::now();
                     auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-                    if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
+                    if ((!portfolio || !options.silent) && (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size())) {
                         auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
                         if (lastSize < commandSet.size()) {
                             std::cout << "Improved lower bound to " << currentBound << " after " << milliseconds << "ms." << std::endl;
@@ -1800,7 +1783,8 @@ namespace storm {
                 stats.modelCheckingTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalModelCheckingTime);
                 stats.solverTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSolverTime);
 
-                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                // In a portfolio, only the strategy that found the counterexample reports its statistics.
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet() && (!portfolio || !result.empty())) {
                     boost::container::flat_set<uint64_t> allLabels;
                     for (auto const& e : labelSets) {
                         allLabels.insert(e.begin(), e.end());
@@ -1826,6 +1810,266 @@ namespace storm {
                 }
 
                 return result;
+            }
+            
+            /*!
+             * Searches for a minimal label set by running a portfolio of strategies concurrently. The strategies differ
+             * in the encoding of reachability and the use of dynamic constraints. Each strategy uses a separate solver,
+             * the strategies share proved lower bounds and refuted label sets and the first counterexample that is found
+             * is returned (as it is minimal).
+             */
+            static std::vector<boost::container::flat_set<uint_fast64_t>> searchMinimalLabelSetsConcurrently(Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, std::vector<boost::container::flat_set<uint_fast64_t>> const& labelSets, RelevancyInformation const& relevancyInformation, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, double propertyThreshold, boost::optional<std::string> const& rewardName, bool strictBound, Options const& options, std::chrono::high_resolution_clock::time_point const& startTime) {
+                // The configured strategy comes first, followed by the remaining combinations of the encoding options.
+                std::vector<Options> strategies = {options};
+                for (bool encodeReachability : {options.encodeReachability, !options.encodeReachability}) {
+                    for (bool useDynamicConstraints : {options.useDynamicConstraints, !options.useDynamicConstraints}) {
+                        if (encodeReachability != options.encodeReachability || useDynamicConstraints != options.useDynamicConstraints) {
+                            strategies.push_back(options);
+                            strategies.back().encodeReachability = encodeReachability;
+                            strategies.back().useDynamicConstraints = useDynamicConstraints;
+                            strategies.back().silent = true;
+                        }
+                    }
+                }
+                STORM_LOG_WARN_COND(options.portfolioSize <= strategies.size(), "Portfolio is restricted to the " << strategies.size() << " available strategies.");
+                strategies.resize(std::min<uint64_t>(options.portfolioSize, strategies.size()));
+                
+                std::vector<std::shared_ptr<storm::expressions::ExpressionManager>> managers;
+                std::vector<std::unique_ptr<storm::solver::SmtSolver>> solvers;
+                std::vector<storm::solver::SmtSolver*> solverPointers;
+                for (uint64_t strategy = 0; strategy < strategies.size(); ++strategy) {
+                    managers.push_back(std::make_shared<storm::expressions::ExpressionManager>());
+                    solvers.push_back(std::make_unique<storm::solver::Z3SmtSolver>(*managers.back()));
+                    solverPointers.push_back(solvers.back().get());
+                }
+                PortfolioInformation portfolio(solverPointers);
+                
+                std::vector<std::vector<boost::container::flat_set<uint_fast64_t>>> results(strategies.size());
+                std::vector<GeneratorStats> strategyStats(strategies.size());
+                std::vector<std::exception_ptr> exceptions(strategies.size());
+                auto worker = [&] (uint64_t strategy) {
+                    try {
+                        results[strategy] = searchMinimalLabelSets(env, strategyStats[strategy], symbolicModel, model, labelSets, relevancyInformation, managers[strategy], *solvers[strategy], phiStates, psiStates, propertyThreshold, rewardName, strictBound, strategies[strategy], startTime, &portfolio, strategy);
+                    } catch (...) {
+                        exceptions[strategy] = std::current_exception();
+                    }
+                    
+                    // If the strategy found a counterexample, the other strategies can stop.
+                    if (!results[strategy].empty()) {
+                        portfolio.finish(strategy);
+                    }
+                };
+                
+                std::vector<std::thread> threads;
+                for (uint64_t strategy = 1; strategy < strategies.size(); ++strategy) {
+                    threads.emplace_back(worker, strategy);
+                }
+                worker(0);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                
+                for (uint64_t strategy = 0; strategy < strategies.size(); ++strategy) {
+                    if (!results[strategy].empty()) {
+                        STORM_LOG_INFO("Portfolio strategy " << strategy << " found the minimal label set.");
+                        stats = strategyStats[strategy];
+                        return results[strategy];
+                    }
+                }
+                
+                // If no strategy found a counterexample, an exception of a strategy may be the reason.
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+                stats = strategyStats.front();
+                return {};
+            }
+#endif
+        
+            
+            /*!
+             * Returns the sub-model obtained from removing all choices that do not originate from the specified filterLabelSet.
+             * Also returns the Labelsets of the sub-model.
+             */
+            static std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<boost::container::flat_set<uint_fast64_t>>> restrictModelToLabelSet(storm::models::sparse::Model<T> const& model,  boost::container::flat_set<uint_fast64_t> const& filterLabelSet, boost::optional<std::string> const& rewardName = boost::none, boost::optional<uint64_t> absorbState = boost::none) {
+
+                bool customRowGrouping = model.isOfType(storm::models::ModelType::Mdp);
+                
+                std::vector<boost::container::flat_set<uint_fast64_t>> resultLabelSet;
+                storm::storage::SparseMatrixBuilder<T> transitionMatrixBuilder(0, model.getTransitionMatrix().getColumnCount(), 0, true, customRowGrouping, model.getTransitionMatrix().getRowGroupCount());
+
+                // Check for each choice of each state, whether the choice commands are fully contained in the given command set.
+                uint_fast64_t currentRow = 0;
+                for(uint_fast64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                    bool stateHasValidChoice = false;
+                    for (uint_fast64_t choice = model.getTransitionMatrix().getRowGroupIndices()[state]; choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
+                        auto const& choiceLabelSet = model.getChoiceOrigins()->isPrismChoiceOrigins() ? model.getChoiceOrigins()->asPrismChoiceOrigins().getCommandSet(choice) : model.getChoiceOrigins()->asJaniChoiceOrigins().getEdgeIndexSet(choice);
+                        bool choiceValid = std::includes(filterLabelSet.begin(), filterLabelSet.end(), choiceLabelSet.begin(), choiceLabelSet.end());
+
+                        // If the choice is valid, copy over all its elements.
+                        if (choiceValid) {
+                            if (!stateHasValidChoice && customRowGrouping) {
+                                transitionMatrixBuilder.newRowGroup(currentRow);
+                            }
+                            stateHasValidChoice = true;
+                            for (auto const& entry : model.getTransitionMatrix().getRow(choice)) {
+                                transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
+                            }
+                            resultLabelSet.push_back(choiceLabelSet);
+                            ++currentRow;
+                        }
+                    }
+
+                    // If no choice of the current state may be taken, we insert a self-loop to the state instead.
+                    if (!stateHasValidChoice) {
+                        if (customRowGrouping) {
+                            transitionMatrixBuilder.newRowGroup(currentRow);
+                        }
+                        uint64_t targetState = absorbState == boost::none ? state : absorbState.get();
+                        transitionMatrixBuilder.addNextValue(currentRow, targetState, storm::utility::one<T>());
+                        // Insert an empty label set for this choice
+                        resultLabelSet.emplace_back();
+                        ++currentRow;
+                    }
+
+                }
+
+                if (rewardName) {
+                    auto const &origRewModel = model.getRewardModel(rewardName.get());
+                    assert(origRewModel.hasOnlyStateRewards());
+                }
+
+                std::shared_ptr<storm::models::sparse::Model<T>> resultModel;
+                if (model.isOfType(storm::models::ModelType::Dtmc)) {
+                    resultModel = std::make_shared<storm::models::sparse::Dtmc<T>>(transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
+                } else {
+                    resultModel = std::make_shared<storm::models::sparse::Mdp<T>>(transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
+                }
+                
+                return std::make_pair(resultModel, std::move(resultLabelSet));
+            }
+
+            static T computeMaximalReachabilityProbability(Environment const& env, storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<std::string> const& rewardName) {
+                T result = storm::utility::zero<T>();
+                
+                std::vector<T> allStatesResult;
+                
+                STORM_LOG_DEBUG("Invoking model checker.");
+                if (model.isOfType(storm::models::ModelType::Dtmc)) {
+                    if (rewardName == boost::none) {
+                        allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeUntilProbabilities(env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), phiStates, psiStates, false);
+                    } else {
+                        allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeReachabilityRewards(env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), model.getRewardModel(rewardName.get()), psiStates, false);
+                    }
+                } else {
+                    if (rewardName == boost::none) {
+                        storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelCheckerHelper;
+                        allStatesResult = std::move(modelCheckerHelper.computeUntilProbabilities(env, false, model.getTransitionMatrix(),model.getBackwardTransitions(), phiStates,psiStates, false, false).values);
+                    } else {
+                        STORM_LOG_THROW(rewardName != boost::none, storm::exceptions::NotSupportedException, "Reward property counterexample generation is currently only supported for DTMCs.");
+                    }
+                }
+                for (auto state : model.getInitialStates()) {
+                    result = std::max(result, allStatesResult[state]);
+                }
+                return result;
+            }
+            
+        public:
+            struct Options {
+                Options(bool checkThresholdFeasible = false) : checkThresholdFeasible(checkThresholdFeasible) {
+                    auto const& settings = storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>();
+                    
+                    encodeReachability = settings.isEncodeReachabilitySet();
+                    useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+                    portfolioSize = settings.getPortfolioSize();
+                }
+                
+                bool checkThresholdFeasible;
+                bool encodeReachability;
+                bool useDynamicConstraints;
+                bool silent = false;
+                uint64_t continueAfterFirstCounterexampleUntil = 0;
+                uint64_t maximumCounterexamples = 1;
+                uint64_t multipleCounterexampleSizeCap = 100000000;
+                uint64_t portfolioSize;
+            };
+
+            struct GeneratorStats {
+                std::chrono::milliseconds setupTime;
+                std::chrono::milliseconds solverTime;
+                std::chrono::milliseconds modelCheckingTime;
+                std::chrono::milliseconds analysisTime;
+            };
+            
+            /*!
+             * Computes the minimal command set that is needed in the given model to exceed the given probability threshold for satisfying phi until psi.
+             *
+             * @param symbolicModel The symbolic model description that was used to build the model.
+             * @param model The sparse model in which to find the minimal command set.
+             * @param phiStates A bit vector characterizing all phi states in the model.
+             * @param psiStates A bit vector characterizing all psi states in the model.
+             * @param propertyThreshold The threshold that is to be achieved or exceeded.
+             * @param rewardName The name of the reward structure to use, or boost::none if probabilities are considerd.
+             * @param strictBound Indicates whether the threshold needs to be achieved (true) or exceeded (false).
+             * @param options A set of options for customization.
+             */
+            static std::vector<boost::container::flat_set<uint_fast64_t>> getMinimalLabelSet(Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, double propertyThreshold, boost::optional<std::string> const& rewardName, bool strictBound, boost::container::flat_set<uint_fast64_t> const& dontCareLabels = boost::container::flat_set<uint_fast64_t>(), Options const& options = Options()) {
+#ifdef STORM_HAVE_Z3
+                auto startTime = std::chrono::high_resolution_clock::now();
+                
+                // (0) Obtain the label sets for each choice.
+                // The label set of a choice corresponds to the set of prism commands that induce the choice.
+                STORM_LOG_THROW(model.hasChoiceOrigins(), storm::exceptions::InvalidArgumentException, "Restriction to minimal command set is impossible for model without choice origins.");
+                STORM_LOG_THROW(model.getChoiceOrigins()->isPrismChoiceOrigins() || model.getChoiceOrigins()->isJaniChoiceOrigins(), storm::exceptions::InvalidArgumentException, "Restriction to label set is impossible for model without PRISM or JANI choice origins.");
+                
+                std::vector<boost::container::flat_set<uint_fast64_t>> labelSets(model.getNumberOfChoices());
+                if (model.getChoiceOrigins()->isPrismChoiceOrigins()) {
+                    storm::storage::sparse::PrismChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asPrismChoiceOrigins();
+                    for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
+                        labelSets[choice] = choiceOrigins.getCommandSet(choice);
+                    }
+                } else {
+                    storm::storage::sparse::JaniChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asJaniChoiceOrigins();
+                    for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
+                        labelSets[choice] = choiceOrigins.getEdgeIndexSet(choice);
+                    }
+                }
+                assert(labelSets.size() == model.getNumberOfChoices());
+                
+                // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
+                double maximalReachabilityProbability = 0;
+                if (options.checkThresholdFeasible) {
+                    maximalReachabilityProbability = computeMaximalReachabilityProbability(env, model, phiStates, psiStates, rewardName);
+                    
+                    STORM_LOG_THROW((strictBound && maximalReachabilityProbability >= propertyThreshold) || (!strictBound && maximalReachabilityProbability > propertyThreshold), storm::exceptions::InvalidArgumentException, "Given probability threshold " << propertyThreshold << " can not be " << (strictBound ? "achieved" : "exceeded") << " in model with maximal reachability probability of " << maximalReachabilityProbability << ".");
+                    std::cout << std::endl << "Maximal property value in model is " << maximalReachabilityProbability << "." << std::endl << std::endl;
+                }
+                
+                // (2) Identify all states and commands that are relevant, because only these need to be considered later.
+                RelevancyInformation relevancyInformation = determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels);
+                
+                // If there are no relevant labels, return directly.
+                if (relevancyInformation.relevantLabels.empty()) {
+                    return {relevancyInformation.knownLabels};
+                } else if (relevancyInformation.minimalityLabels.empty()) {
+                    boost::container::flat_set<uint_fast64_t> commandSet(relevancyInformation.knownLabels);
+                    commandSet.insert(relevancyInformation.relevantLabels.begin(), relevancyInformation.relevantLabels.end());
+                    return {commandSet};
+                }
+                
+                // The portfolio relies on the first counterexample being minimal, so it is only used if a single
+                // counterexample is requested.
+                if (options.portfolioSize > 1 && options.maximumCounterexamples == 1 && options.continueAfterFirstCounterexampleUntil == 0) {
+                    return searchMinimalLabelSetsConcurrently(env, stats, symbolicModel, model, labelSets, relevancyInformation, phiStates, psiStates, propertyThreshold, rewardName, strictBound, options, startTime);
+                }
+                
+                // (3) Create a solver.
+                std::shared_ptr<storm::expressions::ExpressionManager> manager = std::make_shared<storm::expressions::ExpressionManager>();
+                std::unique_ptr<storm::solver::SmtSolver> solver = std::make_unique<storm::solver::Z3SmtSolver>(*manager);
+                return searchMinimalLabelSets(env, stats, symbolicModel, model, labelSets, relevancyInformation, manager, *solver, phiStates, psiStates, propertyThreshold, rewardName, strictBound, options, startTime);
 #else
                 throw storm::exceptions::NotImplementedException() << "This functionality is unavailable since storm has been compiled without support for Z3.";
 #endif
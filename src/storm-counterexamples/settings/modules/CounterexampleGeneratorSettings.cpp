@@ -17,6 +17,7 @@ namespace storm {
             const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
             const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
             const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+            const std::string CounterexampleGeneratorSettings::portfolioOptionName = "portfolio";
 
             CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> techniques = {"maxsat", "milp"};
@@ -25,6 +26,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, encodeReachabilityOptionName, true, "Sets whether to encode reachability for MAXSAT-based counterexample generation.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, schedulerCutsOptionName, true, "Sets whether to add the scheduler cuts for MILP-based counterexample generation.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, noDynamicConstraintsOptionName, true, "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, portfolioOptionName, true, "Sets the number of strategies that the MAXSAT-based counterexample generation runs concurrently.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of strategies.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             bool CounterexampleGeneratorSettings::isMinimalCommandSetGenerationSet() const {
@@ -50,6 +52,10 @@ namespace storm {
             bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
                 return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
             }
+            
+            uint64_t CounterexampleGeneratorSettings::getPortfolioSize() const {
+                return this->getOption(portfolioOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
 
             bool CounterexampleGeneratorSettings::check() const {
                 // Ensure that the model was given either symbolically or explicitly.
@@ -58,6 +64,7 @@ namespace storm {
                 if (isMinimalCommandSetGenerationSet()) {
                     STORM_LOG_WARN_COND(isUseMaxSatBasedMinimalCommandSetGenerationSet() || !isEncodeReachabilitySet(), "Encoding reachability is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
                     STORM_LOG_WARN_COND(isUseMilpBasedMinimalCommandSetGenerationSet() || !isUseSchedulerCutsSet(), "Using scheduler cuts is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
+                    STORM_LOG_WARN_COND(isUseMaxSatBasedMinimalCommandSetGenerationSet() || getPortfolioSize() == 1, "The portfolio is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
                 }
                 
                 return true;
@@ -63,6 +63,13 @@ namespace storm {
                  */
                 bool isUseDynamicConstraintsSet() const;
                 
+                /*!
+                 * Retrieves the number of strategies that the MAXSAT-based technique runs concurrently.
+                 *
+                 * @return The number of strategies.
+                 */
+                uint64_t getPortfolioSize() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -74,6 +81,7 @@ namespace storm {
                 static const std::string encodeReachabilityOptionName;
                 static const std::string schedulerCutsOptionName;
                 static const std::string noDynamicConstraintsOptionName;
+                static const std::string portfolioOptionName;
             };
             
         } // namespace modules
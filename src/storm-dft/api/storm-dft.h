@@ -54,8 +54,9 @@ namespace storm {
          */
         template <typename ValueType>
         typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results analyzeDFT(storm::storage::DFT<ValueType> const& dft, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties, bool symred, bool allowModularisation, bool enableDC, bool printOutput) {
+            storm::Environment env;
             storm::modelchecker::DFTModelChecker<ValueType> modelChecker;
-            typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(dft, properties, symred, allowModularisation, enableDC, 0.0);
+            typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(env, dft, properties, symred, allowModularisation, enableDC, 0.0);
             if (printOutput) {
                 modelChecker.printTimings();
                 modelChecker.printResults();
@@ -78,8 +79,9 @@ namespace storm {
          */
         template <typename ValueType>
         typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results analyzeDFTApprox(storm::storage::DFT<ValueType> const& dft, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError, bool printOutput) {
+            storm::Environment env;
             storm::modelchecker::DFTModelChecker<ValueType> modelChecker;
-            typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(dft, properties, symred, allowModularisation, enableDC, approximationError);
+            typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(env, dft, properties, symred, allowModularisation, enableDC, approximationError);
             if (printOutput) {
                 modelChecker.printTimings();
                 modelChecker.printResults();
@@ -40,7 +40,7 @@ namespace storm {
                 return id;
             }
 
-            bool isExpand() {
+            bool isExpand() const {
                 return expand;
             }
 
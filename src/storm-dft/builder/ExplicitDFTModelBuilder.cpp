@@ -61,7 +61,8 @@ namespace storm {
                 stateStorage(((dft.stateVectorSize() / 64) + 1) * 64),
                 // TODO Matthias: make choosable
                 //explorationQueue(dft.nrElements()+1, 0, 1)
-                explorationQueue(200, 0, 0.9)
+                explorationQueue(200, 0, 0.9, heuristics),
+                pendingStatuses(dft.stateVectorSize())
         {
             // Intentionally left empty.
             // TODO Matthias: remove again
@@ -161,11 +162,12 @@ namespace storm {
                 initialStateIndex = stateStorage.initialStateIndices[0];
                 STORM_LOG_TRACE("Initial state: " << initialStateIndex);
                 // Initialize heuristic values for inital state
-                STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).second, "Heuristic for initial state is already initialized");
-                ExplorationHeuristicPointer heuristic = std::make_shared<ExplorationHeuristic>(initialStateIndex);
-                heuristic->markExpand();
-                statesNotExplored[initialStateIndex].second = heuristic;
-                explorationQueue.push(heuristic);
+                STORM_LOG_ASSERT(statesNotExplored.at(initialStateIndex).heuristicSlot == NO_HEURISTIC, "Heuristic for initial state is already initialized");
+                ExplorationHeuristic heuristic(initialStateIndex);
+                heuristic.markExpand();
+                uint64_t heuristicSlot = storeHeuristic(heuristic);
+                statesNotExplored[initialStateIndex].heuristicSlot = heuristicSlot;
+                explorationQueue.push(heuristicSlot);
             } else {
                 initializeNextIteration();
             }
@@ -221,8 +223,8 @@ namespace storm {
             // Push skipped states to explore queue
             // TODO Matthias: remove
             for (auto const& skippedState : skippedStates) {
-                statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
-                explorationQueue.push(skippedState.second.second);
+                statesNotExplored[heuristics[skippedState.second.heuristicSlot].getId()] = skippedState.second;
+                explorationQueue.push(skippedState.second.heuristicSlot);
             }
 
             // Initialize matrix builder again
@@ -251,7 +253,7 @@ namespace storm {
             matrixBuilder.mappingOffset = nrStates;
             STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
             StateType skippedIndex = nrExpandedStates;
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+            std::map<StateType, PendingState> skippedStatesNew;
             for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
                 StateType index = matrixBuilder.getRemapping(id);
                 auto itFind = skippedStates.find(index);
@@ -298,7 +300,7 @@ namespace storm {
                             auto itFind = skippedStates.find(itEntry->getColumn());
                             if (itFind != skippedStates.end()) {
                                 // Set id for skipped states as we remap it later
-                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + heuristics[itFind->second.heuristicSlot].getId(), itEntry->getValue());
                             } else {
                                 // Set newly remapped index for expanded states
                                 matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -322,25 +324,22 @@ namespace storm {
             // TODO Matthias: do not empty queue every time but break before
             while (!explorationQueue.empty()) {
                 // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.popTop();
-                StateType currentId = currentExplorationHeuristic->getId();
+                // The heuristic values are copied, as the storage may grow while the successors are added.
+                uint64_t currentHeuristicSlot = explorationQueue.popTop();
+                ExplorationHeuristic currentExplorationHeuristic = heuristics[currentHeuristicSlot];
+                StateType currentId = currentExplorationHeuristic.getId();
                 auto itFind = statesNotExplored.find(currentId);
                 STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-                DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+                PendingState pendingState = std::move(itFind->second);
+                STORM_LOG_ASSERT(currentHeuristicSlot == pendingState.heuristicSlot, "Exploration heuristics do not match");
                 // Remove it from the list of not explored states
                 statesNotExplored.erase(itFind);
+
+                // Reconstruct the concrete state from its status
+                DFTStatePointer currentState = loadState(currentId, pendingState);
                 STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
                 STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
 
-                // Get concrete state if necessary
-                if (currentState->isPseudoState()) {
-                    // Create concrete state from pseudo state
-                    currentState->construct();
-                }
-                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
                 // Remember that the current row group was actually filled with the transitions of a different state
                 matrixBuilder.setRemapping(currentId);
 
@@ -350,7 +349,7 @@ namespace storm {
                 generator.load(currentState);
 
                 //if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
-                if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
+                if (approximationThreshold > 0.0 && currentExplorationHeuristic.isSkip(approximationThreshold)) {
                     // Skip the current state
                     ++nrSkippedStates;
                     STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
@@ -359,11 +358,14 @@ namespace storm {
                     // TODO Matthias: what to do when there is no unique target state?
                     matrixBuilder.addTransition(failedStateId, storm::utility::zero<ValueType>());
                     // Remember skipped state
-                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
+                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::move(pendingState);
                     matrixBuilder.finishRow();
                 } else {
                     // Explore the current state
                     ++nrExpandedStates;
+                    // The status and the heuristic values are not needed anymore
+                    pendingStatuses.release(pendingState.statusSlot);
+                    releaseHeuristic(currentHeuristicSlot);
                     storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
                     STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
                     setMarkovian(behavior.begin()->isMarkovian());
@@ -379,36 +381,32 @@ namespace storm {
                             auto iter = statesNotExplored.find(stateProbabilityPair.first);
                             if (iter != statesNotExplored.end()) {
                                 // Update heuristic values
-                                DFTStatePointer state = iter->second.first;
-                                if (!iter->second.second) {
+                                if (iter->second.heuristicSlot == NO_HEURISTIC) {
                                     // Initialize heuristic values
-                                    ExplorationHeuristicPointer heuristic = std::make_shared<ExplorationHeuristic>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    iter->second.second = heuristic;
-                                    if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->nrFailableDependencies() > 0 || (state->nrFailableDependencies() == 0 && state->nrFailableBEs() == 0)) {
+                                    ExplorationHeuristic heuristic(stateProbabilityPair.first, currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    if (iter->second.expandAlways) {
                                         // Do not skip absorbing state or if reached by dependencies
-                                        iter->second.second->markExpand();
+                                        heuristic.markExpand();
                                     }
                                     if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
                                         // Compute bounds for heuristic now
-                                        if (state->isPseudoState()) {
-                                            // Create concrete state from pseudo state
-                                            state->construct();
-                                        }
-                                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                                        DFTStatePointer state = loadState(stateProbabilityPair.first, iter->second);
 
                                         // Initialize bounds
                                         // TODO Mathias: avoid hack
                                         ValueType lowerBound = getLowerBound(state);
                                         ValueType upperBound = getUpperBound(state);
-                                        heuristic->setBounds(lowerBound, upperBound);
+                                        heuristic.setBounds(lowerBound, upperBound);
                                     }
 
-                                    explorationQueue.push(heuristic);
-                                } else if (!iter->second.second->isExpand()) {
-                                    double oldPriority = iter->second.second->getPriority();
-                                    if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
+                                    iter->second.heuristicSlot = storeHeuristic(heuristic);
+                                    explorationQueue.push(iter->second.heuristicSlot);
+                                } else if (!heuristics[iter->second.heuristicSlot].isExpand()) {
+                                    ExplorationHeuristic& heuristic = heuristics[iter->second.heuristicSlot];
+                                    double oldPriority = heuristic.getPriority();
+                                    if (heuristic.updateHeuristicValues(currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
                                         // Update priority queue
-                                        explorationQueue.update(iter->second.second, oldPriority);
+                                        explorationQueue.update(iter->second.heuristicSlot, oldPriority);
                                     }
                                 }
                             }
@@ -494,7 +492,6 @@ namespace storm {
                     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                         auto matrixEntry = matrix.getRow(it->first, 0).begin();
                         STORM_LOG_ASSERT(matrixEntry->getColumn() == failedStateId, "Transition has wrong target state.");
-                        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                         matrixEntry->setValue(storm::utility::one<ValueType>());
                         matrixEntry->setColumn(it->first);
                     }
@@ -612,21 +609,21 @@ namespace storm {
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == failedStateId, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
 
-                ExplorationHeuristicPointer heuristic = it->second.second;
-                if (storm::utility::isZero(heuristic->getUpperBound())) {
+                ExplorationHeuristic& heuristic = heuristics[it->second.heuristicSlot];
+                if (storm::utility::isZero(heuristic.getUpperBound())) {
                     // Initialize bounds
-                    ValueType lowerBound = getLowerBound(it->second.first);
-                    ValueType upperBound = getUpperBound(it->second.first);
-                    heuristic->setBounds(lowerBound, upperBound);
+                    DFTStatePointer state = loadState(heuristic.getId(), it->second);
+                    ValueType lowerBound = getLowerBound(state);
+                    ValueType upperBound = getUpperBound(state);
+                    heuristic.setBounds(lowerBound, upperBound);
                 }
 
                 // Change bound
                 if (lowerBound) {
-                    matrixEntry->setValue(it->second.second->getLowerBound());
+                    matrixEntry->setValue(heuristic.getLowerBound());
                 } else {
-                    matrixEntry->setValue(it->second.second->getUpperBound());
+                    matrixEntry->setValue(heuristic.getUpperBound());
                 }
             }
         }
@@ -761,6 +758,49 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType, typename StateType>
+        typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::loadState(StateType id, PendingState const& pendingState) const {
+            DFTStatePointer state = std::make_shared<storm::storage::DFTState<ValueType>>(pendingStatuses.load(pendingState.statusSlot), dft, *stateGenerationInfo, id);
+            if (pendingState.orderInformation.empty()) {
+                state->construct();
+            } else {
+                state->construct(pendingState.orderInformation);
+            }
+            return state;
+        }
+
+        template<typename ValueType, typename StateType>
+        bool ExplicitDFTModelBuilder<ValueType, StateType>::isExpandAlways(DFTStatePointer const& state) const {
+            // Do not skip absorbing state or if reached by dependencies
+            return state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->nrFailableDependencies() > 0 || (state->nrFailableDependencies() == 0 && state->nrFailableBEs() == 0);
+        }
+
+        template<typename ValueType, typename StateType>
+        std::vector<size_t> ExplicitDFTModelBuilder<ValueType, StateType>::getRequiredOrderInformation(DFTStatePointer const& state) const {
+            // Pseudo states are always constructed from their status
+            if (state->isPseudoState() || state->isReconstructible()) {
+                return std::vector<size_t>();
+            }
+            return state->getOrderInformation();
+        }
+
+        template<typename ValueType, typename StateType>
+        uint64_t ExplicitDFTModelBuilder<ValueType, StateType>::storeHeuristic(ExplorationHeuristic const& heuristic) {
+            if (freeHeuristicSlots.empty()) {
+                heuristics.push_back(heuristic);
+                return heuristics.size() - 1;
+            }
+            uint64_t slot = freeHeuristicSlots.back();
+            freeHeuristicSlots.pop_back();
+            heuristics[slot] = heuristic;
+            return slot;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::releaseHeuristic(uint64_t slot) {
+            freeHeuristicSlots.push_back(slot);
+        }
+
         template<typename ValueType, typename StateType>
         StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTStatePointer const& state) {
             StateType stateId;
@@ -781,14 +821,13 @@ namespace storm {
                     // Check if state is pseudo state
                     // If state is explored already the possible pseudo state was already constructed
                     auto iter = statesNotExplored.find(stateId);
-                    if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
-                        // Create pseudo state now
-                        STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                        STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
+                    if (iter != statesNotExplored.end() && iter->second.pseudo) {
+                        // The state is now reached as concrete state
+                        STORM_LOG_ASSERT(pendingStatuses.load(iter->second.statusSlot) == state->status(), "Pseudo states do not coincide.");
                         state->setId(stateId);
-                        // Update mapping to map to concrete state now
-                        // TODO Matthias: just change pointer?
-                        statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
+                        iter->second.orderInformation = getRequiredOrderInformation(state);
+                        iter->second.expandAlways = isExpandAlways(state);
+                        iter->second.pseudo = false;
                         // We do not push the new state on the exploration queue as the pseudo state was already pushed
                         STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
                     }
@@ -801,8 +840,7 @@ namespace storm {
                 stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
                 STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
                 // Insert state as not yet explored
-                ExplorationHeuristicPointer nullHeuristic;
-                statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+                statesNotExplored[stateId] = PendingState{pendingStatuses.store(state->status()), getRequiredOrderInformation(state), NO_HEURISTIC, isExpandAlways(state), state->isPseudoState()};
                 // Reserve one slot for the new state in the remapping
                 matrixBuilder.stateRemapping.push_back(0);
                 STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -823,7 +861,7 @@ namespace storm {
         void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
             std::cout << "states not explored:" << std::endl;
             for (auto it : statesNotExplored) {
-                std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+                std::cout << it.first << " -> " << dft.getStateString(pendingStatuses.load(it.second.statusSlot), *stateGenerationInfo, it.first) << std::endl;
             }
         }
 
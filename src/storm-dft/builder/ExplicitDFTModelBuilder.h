@@ -18,6 +18,7 @@
 #include "storm-dft/storage/dft/DFT.h"
 #include "storm-dft/storage/dft/SymmetricUnits.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
+#include "storm-dft/storage/DFTStatusArena.h"
 
 namespace storm {
     namespace builder {
@@ -31,8 +32,26 @@ namespace storm {
             using DFTStatePointer = std::shared_ptr<storm::storage::DFTState<ValueType>>;
             // TODO Matthias: make choosable
             using ExplorationHeuristic = DFTExplorationHeuristicDepth<ValueType>;
-            using ExplorationHeuristicPointer = std::shared_ptr<ExplorationHeuristic>;
 
+            // A state which is not yet expanded. Its status is kept in the status arena and the concrete state is
+            // reconstructed from the status when needed. For states where the reconstruction would yield a different
+            // order of failable elements, this order is kept as well.
+            struct PendingState {
+                // Slot of the status in the arena.
+                uint64_t statusSlot;
+
+                // The order information if the state can not be reconstructed from its status alone (empty otherwise).
+                std::vector<size_t> orderInformation;
+
+                // Slot of the heuristic values (NO_HEURISTIC before the state is reached during exploration).
+                uint64_t heuristicSlot;
+
+                // Flag indicating if the state must not be skipped during approximation.
+                bool expandAlways;
+
+                // Flag indicating if the state was reached as pseudo state only.
+                bool pseudo;
+            };
 
             // A structure holding the individual components of a model.
             struct ModelComponents {
@@ -235,6 +254,52 @@ namespace storm {
              */
             StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+            /*!
+             * Get the concrete state of a state which was not yet expanded. If it was not kept completely, it is
+             * reconstructed from its status.
+             *
+             * @param id           Id of the state.
+             * @param pendingState The state.
+             *
+             * @return The concrete state.
+             */
+            DFTStatePointer loadState(StateType id, PendingState const& pendingState) const;
+
+            /*!
+             * Check whether the given state must not be skipped during approximation.
+             *
+             * @param state The state.
+             *
+             * @return True iff the state must always be expanded.
+             */
+            bool isExpandAlways(DFTStatePointer const& state) const;
+
+            /*!
+             * Get the order information which has to be kept for a state which is not yet expanded.
+             *
+             * @param state The state.
+             *
+             * @return The order information if the state is concrete and can not be reconstructed from its status,
+             *         an empty vector otherwise.
+             */
+            std::vector<size_t> getRequiredOrderInformation(DFTStatePointer const& state) const;
+
+            /*!
+             * Store the given heuristic values in a free slot.
+             *
+             * @param heuristic The heuristic values.
+             *
+             * @return The slot of the heuristic values.
+             */
+            uint64_t storeHeuristic(ExplorationHeuristic const& heuristic);
+
+            /*!
+             * Release the given slot of heuristic values such that it can be reused.
+             *
+             * @param slot The slot.
+             */
+            void releaseHeuristic(uint64_t slot);
+
             /*!
              * Set markovian flag for the current state.
              *
@@ -304,6 +369,8 @@ namespace storm {
             const size_t INITIAL_BITVECTOR_SIZE = 20000;
             // Offset used for pseudo states.
             const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+            // Slot indicating that the heuristic values of a state are not yet initialized.
+            const uint64_t NO_HEURISTIC = std::numeric_limits<uint64_t>::max();
 
             // Dft
             storm::storage::DFT<ValueType> const& dft;
@@ -342,17 +409,27 @@ namespace storm {
             // Internal information about the states that were explored.
             storm::storage::sparse::StateStorage<StateType> stateStorage;
 
-            // A priority queue of states that still need to be explored.
+            // The heuristic values of the states that are not yet explored or were skipped, in slots that are reused
+            // once a state has been expanded. The bounds are initialized lazily when approximating the model.
+            mutable std::vector<ExplorationHeuristic> heuristics;
+
+            // The slots of the heuristic values which are free.
+            std::vector<uint64_t> freeHeuristicSlots;
+
+            // A priority queue of states (given by the slots of their heuristic values) that still need to be explored.
             storm::storage::BucketPriorityQueue<ValueType> explorationQueue;
 
-            // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+            // The statuses of all states which are not yet explored or were skipped.
+            storm::storage::DFTStatusArena pendingStatuses;
+
+            // A mapping of not yet explored states from the id to the pending state.
+            std::map<StateType, PendingState> statesNotExplored;
 
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
             // to the corresponding skipped states.
             // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
             // TODO remove again
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+            std::map<StateType, PendingState> skippedStates;
 
             // List of independent subtrees and the BEs contained in them.
             std::vector<std::vector<size_t>> subtreeBEs;
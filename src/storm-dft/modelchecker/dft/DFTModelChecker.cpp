@@ -1,5 +1,9 @@
 #include "DFTModelChecker.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
@@ -7,6 +11,10 @@
 #include "storm/utility/DirectEncodingExporter.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/utility/NumberTraits.h"
 
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
 #include "storm-dft/storage/dft/DFTIsomorphism.h"
@@ -17,9 +25,10 @@ namespace storm {
     namespace modelchecker {
 
         template<typename ValueType>
-        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::check(storm::storage::DFT<ValueType> const& origDft, std::vector<std::shared_ptr<const storm::logic::Formula>> const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError) {
+        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::check(storm::Environment const& env, storm::storage::DFT<ValueType> const& origDft, std::vector<std::shared_ptr<const storm::logic::Formula>> const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError) {
             // Initialize
             this->approximationError = approximationError;
+            this->numberOfModuleThreads = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>().getNumberOfModuleThreads();
             totalTimer.start();
 
             // Optimizing DFT
@@ -32,19 +41,19 @@ namespace storm {
                 // Use parallel composition as modularisation approach for expected time
                 std::shared_ptr<storm::models::sparse::Model<ValueType>> model = buildModelViaComposition(dft, properties, symred, true, enableDC, approximationError);
                 // Model checking
-                std::vector<ValueType> resultsValue = checkModel(model, properties);
+                std::vector<ValueType> resultsValue = checkModel(env, model, properties);
                 for (ValueType result : resultsValue) {
                     checkResults.push_back(result);
                 }
             } else {
-                checkResults = checkHelper(dft, properties, symred, allowModularisation, enableDC, approximationError);
+                checkResults = checkHelper(env, dft, properties, symred, allowModularisation, enableDC, approximationError);
             }
             totalTimer.stop();
             return checkResults;
         }
 
         template<typename ValueType>
-        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::checkHelper(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError)  {
+        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::checkHelper(storm::Environment const& env, storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError)  {
             STORM_LOG_TRACE("Check helper called");
             std::vector<storm::storage::DFT<ValueType>> dfts;
             bool invResults = false;
@@ -89,59 +98,125 @@ namespace storm {
             // Perform modularisation
             if(dfts.size() > 1) {
                 STORM_LOG_TRACE("Recursive CHECK Call");
-                // TODO Matthias: compute simultaneously
-                dft_results results;
+                property_vector probabilityProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for(auto const ft : dfts) {
-                            // TODO Matthias: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, enableDC, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        probabilityProperties.push_back(property);
+                    }
+                }
+                dft_results results;
+                if (probabilityProperties.empty()) {
+                    return results;
+                }
+
+                // Recursively call model checking, each module is checked for all properties at once
+                std::vector<dft_results> moduleResults = checkModules(env, dfts, probabilityProperties, symred, enableDC);
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM+1;
-                        int chK = invResults ? -1 : 1;
-                        // WARNING: there is a bug for computing permutations with more than 32 elements
-                        STORM_LOG_ASSERT(res.size() < 32, "Permutations work only for < 32 elements");
-                        for(int cK = nrK; cK != limK; cK += chK ) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation="<<permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for(size_t i = 0; i < res.size(); ++i) {
-                                    if(permutation & (1 << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
+                for (size_t propertyIndex = 0; propertyIndex < probabilityProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> res;
+                    for (auto const& ftResults : moduleResults) {
+                        STORM_LOG_ASSERT(ftResults.size() == probabilityProperties.size(), "Wrong number of results");
+                        res.push_back(boost::get<ValueType>(ftResults[propertyIndex]));
+                    }
+
+                    // Combine modularisation results
+                    STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults=" << (invResults?"On":"Off"));
+                    ValueType result = storm::utility::zero<ValueType>();
+                    int limK = invResults ? -1 : nrM+1;
+                    int chK = invResults ? -1 : 1;
+                    // WARNING: there is a bug for computing permutations with more than 32 elements
+                    STORM_LOG_ASSERT(res.size() < 32, "Permutations work only for < 32 elements");
+                    for(int cK = nrK; cK != limK; cK += chK ) {
+                        STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                        size_t permutation = smallestIntWithNBitsSet(static_cast<size_t>(cK));
+                        do {
+                            STORM_LOG_TRACE("Permutation="<<permutation);
+                            ValueType permResult = storm::utility::one<ValueType>();
+                            for(size_t i = 0; i < res.size(); ++i) {
+                                if(permutation & (1 << i)) {
+                                    permResult *= res[i];
+                                } else {
+                                    permResult *= storm::utility::one<ValueType>() - res[i];
                                 }
-                                STORM_LOG_TRACE("Result for permutation:"<<permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while(permutation < (1 << nrM) && permutation != 0);
-                        }
-                        if(invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                            }
+                            STORM_LOG_TRACE("Result for permutation:"<<permResult);
+                            permutation = nextBitPermutation(permutation);
+                            result += permResult;
+                        } while(permutation < (1 << nrM) && permutation != 0);
+                    }
+                    if(invResults) {
+                        result = storm::utility::one<ValueType>() - result;
                     }
+                    results.push_back(result);
                 }
                 return results;
             } else {
                 // No modularisation was possible
-                return checkDFT(dft, properties, symred, enableDC, approximationError);
+                return checkDFT(env, dft, properties, symred, enableDC, approximationError);
             }
         }
 
+        template<typename ValueType>
+        std::vector<typename DFTModelChecker<ValueType>::dft_results> DFTModelChecker<ValueType>::checkModules(storm::Environment const& env, std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, bool enableDC) {
+            std::vector<dft_results> results(dfts.size());
+
+            // Rational functions share non-thread-safe caches, so modules are only checked concurrently for double.
+            uint_fast64_t numberOfThreads = std::is_same<ValueType, double>::value ? std::min<uint_fast64_t>(numberOfModuleThreads, dfts.size()) : 1;
+            if (numberOfThreads <= 1) {
+                for (size_t i = 0; i < dfts.size(); ++i) {
+                    // TODO Matthias: allow approximation in modularisation
+                    results[i] = checkHelper(env, dfts[i], properties, symred, true, enableDC, 0.0);
+                }
+                return results;
+            }
+
+            STORM_LOG_DEBUG("Checking " << dfts.size() << " modules with " << numberOfThreads << " threads.");
+            // Each thread uses its own checker (and thereby its own timers). Nested modules are checked sequentially.
+            std::vector<DFTModelChecker<ValueType>> checkers(numberOfThreads);
+            // Each thread also gets its own copy of the environment as sub-environments are created on first access.
+            std::vector<storm::Environment> environments(numberOfThreads, env);
+            std::atomic<size_t> nextModule(0);
+            std::exception_ptr exception;
+            std::mutex exceptionMutex;
+            auto worker = [&] (DFTModelChecker<ValueType>& checker, storm::Environment const& threadEnv) {
+                try {
+                    for (size_t i = nextModule++; i < dfts.size(); i = nextModule++) {
+                        results[i] = checker.checkHelper(threadEnv, dfts[i], properties, symred, true, enableDC, 0.0);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    // Prevent the other threads from picking up further modules.
+                    nextModule = dfts.size();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (uint_fast64_t thread = 1; thread < numberOfThreads; ++thread) {
+                threads.emplace_back(worker, std::ref(checkers[thread]), std::cref(environments[thread]));
+            }
+            worker(checkers[0], environments[0]);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+
+            // Accumulate the times spent by all threads.
+            for (auto const& checker : checkers) {
+                explorationTimer.addToTime(std::chrono::nanoseconds(checker.explorationTimer.getTimeInNanoseconds()));
+                buildingTimer.addToTime(std::chrono::nanoseconds(checker.buildingTimer.getTimeInNanoseconds()));
+                bisimulationTimer.addToTime(std::chrono::nanoseconds(checker.bisimulationTimer.getTimeInNanoseconds()));
+                modelCheckingTimer.addToTime(std::chrono::nanoseconds(checker.modelCheckingTimer.getTimeInNanoseconds()));
+            }
+            return results;
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError)  {
             // TODO Matthias: use approximation?
@@ -258,7 +333,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::checkDFT(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool enableDC, double approximationError) {
+        typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::checkDFT(storm::Environment const& env, storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool enableDC, double approximationError) {
             explorationTimer.start();
 
             // Find symmetries
@@ -311,7 +386,7 @@ namespace storm {
                     buildingTimer.stop();
 
                     // Check lower bounds
-                    newResult = checkModel(model, {property});
+                    newResult = checkModel(env, model, {property});
                     STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
                     STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first), "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
                     approxResult.first = newResult[0];
@@ -322,7 +397,7 @@ namespace storm {
                     model = builder.getModelApproximation(false, !probabilityFormula);
                     buildingTimer.stop();
                     // Check upper bound
-                    newResult = checkModel(model, {property});
+                    newResult = checkModel(env, model, {property});
                     STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
                     STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]), "New over-approximation " << newResult[0] << " is greater than old result " << approxResult.second);
                     approxResult.second = newResult[0];
@@ -362,7 +437,7 @@ namespace storm {
                 }
 
                 // Model checking
-                std::vector<ValueType> resultsValue = checkModel(model, properties);
+                std::vector<ValueType> resultsValue = checkModel(env, model, properties);
                 dft_results results;
                 for (ValueType result : resultsValue) {
                     results.push_back(result);
@@ -372,7 +447,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties) {
+        std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties) {
             // Bisimulation
             if (model->isOfType(storm::models::ModelType::Ctmc) && storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet()) {
                 bisimulationTimer.start();
@@ -386,20 +461,62 @@ namespace storm {
             // Check the model
             STORM_LOG_DEBUG("Model checking...");
             modelCheckingTimer.start();
-            std::vector<ValueType> results;
+            std::vector<ValueType> results(properties.size());
+            storm::storage::BitVector checkedProperties(properties.size(), false);
+
+            // Time-bounded reachability properties on CTMCs that only differ in their time bound are answered by a
+            // single transient analysis.
+            if (storm::NumberTraits<ValueType>::SupportsExponential && model->isOfType(storm::models::ModelType::Ctmc)) {
+                std::map<std::string, std::vector<size_t>> timeBoundedProperties;
+                for (size_t i = 0; i < properties.size(); ++i) {
+                    if (!properties[i]->isProbabilityOperatorFormula() || properties[i]->asProbabilityOperatorFormula().hasBound() || !properties[i]->asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+                        continue;
+                    }
+                    storm::logic::BoundedUntilFormula const& pathFormula = properties[i]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+                    if (!pathFormula.isMultiDimensional() && pathFormula.getTimeBoundReference().isTimeBound() && !pathFormula.hasLowerBound() && pathFormula.hasUpperBound() && pathFormula.getLeftSubformula().isTrueFormula()) {
+                        std::stringstream stream;
+                        stream << pathFormula.getRightSubformula();
+                        timeBoundedProperties[stream.str()].push_back(i);
+                    }
+                }
+
+                std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ctmc = model->template as<storm::models::sparse::Ctmc<ValueType>>();
+                uint_fast64_t initialState = *model->getInitialStates().begin();
+                for (auto const& group : timeBoundedProperties) {
+                    if (group.second.size() < 2) {
+                        continue;
+                    }
+                    STORM_LOG_DEBUG("Checking " << group.second.size() << " time bounds for target " << group.first << " at once.");
+                    storm::logic::BoundedUntilFormula const& firstPathFormula = properties[group.second.front()]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+                    std::unique_ptr<storm::modelchecker::CheckResult> psiResult(storm::api::verifyWithSparseEngine<ValueType>(env, model, storm::api::createTask<ValueType>(firstPathFormula.getRightSubformula().asSharedPointer())));
+                    std::vector<double> upperBounds;
+                    for (auto const& index : group.second) {
+                        upperBounds.push_back(properties[index]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula().template getNonStrictUpperBound<double>());
+                    }
+                    std::vector<std::vector<ValueType>> values = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), storm::storage::BitVector(model->getNumberOfStates(), true), psiResult->asExplicitQualitativeCheckResult().getTruthValuesVector(), ctmc->getExitRateVector(), upperBounds);
+                    for (size_t i = 0; i < group.second.size(); ++i) {
+                        results[group.second[i]] = values[i][initialState];
+                        checkedProperties.set(group.second[i]);
+                    }
+                }
+            }
 
-            // Check each property
+            // Check each remaining property
             storm::utility::Stopwatch singleModelCheckingTimer;
-            for (auto property : properties) {
+            for (size_t i = 0; i < properties.size(); ++i) {
+                if (checkedProperties.get(i)) {
+                    continue;
+                }
+                auto property = properties[i];
                 singleModelCheckingTimer.reset();
                 singleModelCheckingTimer.start();
                 //STORM_PRINT_AND_LOG("Model checking property " << *property << " ..." << std::endl);
-                std::unique_ptr<storm::modelchecker::CheckResult> result(storm::api::verifyWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(property, true)));
+                std::unique_ptr<storm::modelchecker::CheckResult> result(storm::api::verifyWithSparseEngine<ValueType>(env, model, storm::api::createTask<ValueType>(property, true)));
                 STORM_LOG_ASSERT(result, "Result does not exist.");
                 result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
                 ValueType resultValue = result->asExplicitQuantitativeCheckResult<ValueType>().getValueMap().begin()->second;
                 //STORM_PRINT_AND_LOG("Result (initial states): " << resultValue << std::endl);
-                results.push_back(resultValue);
+                results[i] = resultValue;
                 singleModelCheckingTimer.stop();
                 //STORM_PRINT_AND_LOG("Time for model checking: " << singleModelCheckingTimer << "." << std::endl);
             }
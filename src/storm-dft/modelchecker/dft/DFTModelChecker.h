@@ -3,6 +3,7 @@
 #include "storm/logic/Formula.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
 #include "storm/utility/Stopwatch.h"
 
 #include "storm-dft/storage/dft/DFT.h"
@@ -25,12 +26,13 @@ namespace storm {
             /*!
              * Constructor.
              */
-            DFTModelChecker() {
+            DFTModelChecker() : numberOfModuleThreads(1) {
             }
 
             /*!
              * Main method for checking DFTs.
              *
+             * @param env                 The environment used for checking the generated models
              * @param origDft             Original DFT
              * @param properties          Properties to check for
              * @param symred              Flag indicating if symmetry reduction should be used
@@ -40,7 +42,7 @@ namespace storm {
              *
              * @return Model checking results for the given properties.
              */
-            dft_results check(storm::storage::DFT<ValueType> const& origDft, property_vector const& properties, bool symred = true, bool allowModularisation = true, bool enableDC = true, double approximationError = 0.0);
+            dft_results check(storm::Environment const& env, storm::storage::DFT<ValueType> const& origDft, property_vector const& properties, bool symred = true, bool allowModularisation = true, bool enableDC = true, double approximationError = 0.0);
 
             /*!
              * Print timings of all operations to stream.
@@ -71,9 +73,13 @@ namespace storm {
             // Allowed error bound for approximation
             double approximationError;
 
+            // Number of threads used to check independent modules
+            uint_fast64_t numberOfModuleThreads;
+
             /*!
              * Internal helper for model checking a DFT.
              *
+             * @param env                 The environment used for checking the generated models
              * @param dft                 DFT
              * @param properties          Properties to check for
              * @param symred              Flag indicating if symmetry reduction should be used
@@ -83,7 +89,21 @@ namespace storm {
              *
              * @return Model checking results (or in case of approximation two results for lower and upper bound)
              */
-            dft_results checkHelper(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError);
+            dft_results checkHelper(storm::Environment const& env, storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation, bool enableDC, double approximationError);
+
+            /*!
+             * Internal helper for checking the modules of a DFT. Independent modules are checked concurrently if more
+             * than one thread is configured.
+             *
+             * @param env        The environment used for checking the generated models
+             * @param dfts       Modules of the DFT
+             * @param properties Properties to check for (all of them are checked on each module)
+             * @param symred     Flag indicating if symmetry reduction should be used
+             * @param enableDC   Flag indicating if dont care propagation should be used
+             *
+             * @return Model checking results for each module
+             */
+            std::vector<dft_results> checkModules(storm::Environment const& env, std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, bool enableDC);
 
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
@@ -102,6 +122,7 @@ namespace storm {
             /*!
              * Check model generated from DFT.
              *
+             * @param env                The environment used for checking the generated model
              * @param dft                The DFT
              * @param properties         Properties to check for
              * @param symred             Flag indicating if symmetry reduction should be used
@@ -110,17 +131,18 @@ namespace storm {
              *
              * @return Model checking result
              */
-            dft_results checkDFT(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool enableDC, double approximationError = 0.0);
+            dft_results checkDFT(storm::Environment const& env, storm::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool enableDC, double approximationError = 0.0);
 
             /*!
              * Check the given markov model for the given properties.
              *
+             * @param env        The environment used for checking the model
              * @param model      Model to check
              * @param properties Properties to check for
              *
              * @return Model checking result
              */
-            std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
+            std::vector<ValueType> checkModel(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
             /*!
              * Checks if the computed approximation is sufficient, i.e.
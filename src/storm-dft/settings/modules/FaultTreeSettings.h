@@ -67,6 +67,21 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isTakeFirstDependency() const;
+
+                /*!
+                 * Retrieves the number of threads that are used to check independent modules of the DFT concurrently.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfModuleThreads() const;
+
+                /*!
+                 * Overrides the number of threads that are used to check independent modules of the DFT concurrently.
+                 *
+                 * @param numberOfThreads The number of threads.
+                 * @return A pointer to an object that restores the previous number upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfModuleThreads(uint_fast64_t numberOfThreads);
                 
 #ifdef STORM_HAVE_Z3
                 /*!
@@ -93,6 +108,7 @@ namespace storm {
                 static const std::string approximationErrorOptionShortName;
                 static const std::string approximationHeuristicOptionName;
                 static const std::string firstDependencyOptionName;
+                static const std::string moduleThreadsOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
@@ -8,9 +8,9 @@ namespace storm {
     namespace storage {
 
         template<typename ValueType>
-        BucketPriorityQueue<ValueType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio) : lowerValue(lowerValue), logBase(std::log(ratio)), nrBuckets(nrBuckets), nrUnsortedItems(0), buckets(nrBuckets), currentBucket(nrBuckets) {
-            compare = ([](HeuristicPointer a, HeuristicPointer b) {
-                return *a < *b;
+        BucketPriorityQueue<ValueType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, std::vector<Heuristic> const& heuristics) : lowerValue(lowerValue), logBase(std::log(ratio)), nrBuckets(nrBuckets), nrUnsortedItems(0), heuristics(heuristics), buckets(nrBuckets), currentBucket(nrBuckets) {
+            compare = ([&heuristics](uint64_t a, uint64_t b) {
+                return heuristics[a] < heuristics[b];
             });
         }
 
@@ -38,7 +38,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename BucketPriorityQueue<ValueType>::HeuristicPointer const& BucketPriorityQueue<ValueType>::top() const {
+        uint64_t BucketPriorityQueue<ValueType>::top() const {
             if (!immediateBucket.empty()) {
                 return immediateBucket.back();
             }
@@ -47,12 +47,12 @@ namespace storm {
         }
 
         template<typename ValueType>
-        void BucketPriorityQueue<ValueType>::push(HeuristicPointer const& item) {
-            if (item->isExpand()) {
+        void BucketPriorityQueue<ValueType>::push(uint64_t item) {
+            if (heuristics[item].isExpand()) {
                 immediateBucket.push_back(item);
                 return;
             }
-            size_t bucket = getBucket(item->getPriority());
+            size_t bucket = getBucket(heuristics[item].getPriority());
             if (bucket < currentBucket) {
                 currentBucket = bucket;
                 nrUnsortedItems = 0;
@@ -69,9 +69,9 @@ namespace storm {
         }
 
         template<typename ValueType>
-        void BucketPriorityQueue<ValueType>::update(HeuristicPointer const& item, double oldPriority) {
-            STORM_LOG_ASSERT(!item->isExpand(), "Item is marked for expansion");
-            size_t newBucket = getBucket(item->getPriority());
+        void BucketPriorityQueue<ValueType>::update(uint64_t item, double oldPriority) {
+            STORM_LOG_ASSERT(!heuristics[item].isExpand(), "Item is marked for expansion");
+            size_t newBucket = getBucket(heuristics[item].getPriority());
             size_t oldBucket = getBucket(oldPriority);
 
             if (oldBucket == newBucket) {
@@ -98,11 +98,11 @@ namespace storm {
                     // Notice: using a map to rememeber index was not efficient
                     size_t oldIndex = 0;
                     for ( ; oldIndex < buckets[oldBucket].size(); ++oldIndex) {
-                        if (buckets[oldBucket][oldIndex]->getId() == item->getId()) {
+                        if (buckets[oldBucket][oldIndex] == item) {
                             break;
                         }
                     }
-                    STORM_LOG_ASSERT(oldIndex < buckets[oldBucket].size(), "Id " << item->getId() << " not found");
+                    STORM_LOG_ASSERT(oldIndex < buckets[oldBucket].size(), "Id " << heuristics[item].getId() << " not found");
                     std::iter_swap(buckets[oldBucket].begin() + oldIndex, buckets[oldBucket].end() - 1);
                 }
                 buckets[oldBucket].pop_back();
@@ -144,8 +144,8 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename BucketPriorityQueue<ValueType>::HeuristicPointer BucketPriorityQueue<ValueType>::popTop() {
-            HeuristicPointer item = top();
+        uint64_t BucketPriorityQueue<ValueType>::popTop() {
+            uint64_t item = top();
             pop();
             return item;
         }
@@ -178,16 +178,16 @@ namespace storm {
         void BucketPriorityQueue<ValueType>::print(std::ostream& out) const {
             out << "Bucket priority queue with size " << buckets.size() << ", lower value: " << lowerValue << " and logBase: " << logBase << std::endl;
             out << "Immediate bucket: ";
-            for (HeuristicPointer heuristic : immediateBucket) {
-                out << heuristic->getId() << ", ";
+            for (uint64_t item : immediateBucket) {
+                out << heuristics[item].getId() << ", ";
             }
             out << std::endl;
             out << "Current bucket (" << currentBucket << ") has " << nrUnsortedItems  << " unsorted items" << std::endl;
             for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
                 if (!buckets[bucket].empty()) {
                     out << "Bucket " << bucket << ":" << std::endl;
-                    for (HeuristicPointer heuristic : buckets[bucket]) {
-                        out << "\t" << heuristic->getId() << ": " << heuristic->getPriority() << std::endl;
+                    for (uint64_t item : buckets[bucket]) {
+                        out << "\t" << heuristics[item].getId() << ": " << heuristics[item].getPriority() << std::endl;
                     }
                 }
             }
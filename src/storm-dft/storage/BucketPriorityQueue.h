@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <vector>
@@ -10,13 +11,17 @@
 namespace storm {
     namespace storage {
 
+        /*!
+         * Priority queue over heuristic values that are stored elsewhere. The items of the queue are the indices of
+         * the heuristic values in the given storage, which may grow while the queue is in use.
+         */
         template<typename ValueType>
         class BucketPriorityQueue {
 
-            using HeuristicPointer = std::shared_ptr<storm::builder::DFTExplorationHeuristicDepth<ValueType>>;
+            using Heuristic = storm::builder::DFTExplorationHeuristicDepth<ValueType>;
 
         public:
-            explicit BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio);
+            explicit BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, std::vector<Heuristic> const& heuristics);
 
             void fix();
 
@@ -24,15 +29,15 @@ namespace storm {
 
             std::size_t size() const;
 
-            HeuristicPointer const& top() const;
+            uint64_t top() const;
 
-            void push(HeuristicPointer const& item);
+            void push(uint64_t item);
 
-            void update(HeuristicPointer const& item, double oldPriority);
+            void update(uint64_t item, double oldPriority);
 
             void pop();
 
-            HeuristicPointer popTop();
+            uint64_t popTop();
 
             void print(std::ostream& out) const;
 
@@ -54,16 +59,19 @@ namespace storm {
 
             size_t nrUnsortedItems;
 
+            // The heuristic values the items refer to
+            std::vector<Heuristic> const& heuristics;
+
             // List of buckets
-            std::vector<std::vector<HeuristicPointer>> buckets;
+            std::vector<std::vector<uint64_t>> buckets;
 
             // Bucket containing all items which should be considered immediately
-            std::vector<HeuristicPointer> immediateBucket;
+            std::vector<uint64_t> immediateBucket;
 
             // Index of first bucket which contains items
             size_t currentBucket;
 
-            std::function<bool(HeuristicPointer, HeuristicPointer)> compare;
+            std::function<bool(uint64_t, uint64_t)> compare;
 
         };
 
@@ -0,0 +1,52 @@
+#include "DFTStatusArena.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        DFTStatusArena::DFTStatusArena(uint64_t numberOfBits) : numberOfBits(numberOfBits), wordsPerStatus(std::max<uint64_t>(1, (numberOfBits + 63) / 64)) {
+            // Intentionally left empty.
+        }
+
+        uint64_t DFTStatusArena::store(storm::storage::BitVector const& status) {
+            STORM_LOG_ASSERT(status.size() == numberOfBits, "Status has size " << status.size() << " but " << numberOfBits << " was expected.");
+            uint64_t slot;
+            if (freeSlots.empty()) {
+                slot = words.size() / wordsPerStatus;
+                words.resize(words.size() + wordsPerStatus);
+            } else {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+
+            auto wordIt = words.begin() + slot * wordsPerStatus;
+            for (uint64_t bitIndex = 0; bitIndex < numberOfBits; bitIndex += 64, ++wordIt) {
+                *wordIt = status.getAsInt(bitIndex, std::min<uint64_t>(64, numberOfBits - bitIndex));
+            }
+            return slot;
+        }
+
+        storm::storage::BitVector DFTStatusArena::load(uint64_t slot) const {
+            STORM_LOG_ASSERT((slot + 1) * wordsPerStatus <= words.size(), "Invalid slot " << slot << ".");
+            storm::storage::BitVector status(numberOfBits);
+            auto wordIt = words.begin() + slot * wordsPerStatus;
+            for (uint64_t bitIndex = 0; bitIndex < numberOfBits; bitIndex += 64, ++wordIt) {
+                status.setFromInt(bitIndex, std::min<uint64_t>(64, numberOfBits - bitIndex), *wordIt);
+            }
+            return status;
+        }
+
+        void DFTStatusArena::release(uint64_t slot) {
+            STORM_LOG_ASSERT((slot + 1) * wordsPerStatus <= words.size(), "Invalid slot " << slot << ".");
+            freeSlots.push_back(slot);
+        }
+
+        uint64_t DFTStatusArena::size() const {
+            return words.size() / wordsPerStatus - freeSlots.size();
+        }
+
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Stores the status bit vectors of DFT states in a single contiguous block of memory. As all statuses of a DFT
+         * have the same length, each one occupies a fixed number of words and is addressed by its slot. Released slots
+         * are reused by subsequently stored statuses.
+         */
+        class DFTStatusArena {
+        public:
+            /*!
+             * Creates an arena for statuses with the given number of bits.
+             *
+             * @param numberOfBits The length of each stored status.
+             */
+            explicit DFTStatusArena(uint64_t numberOfBits);
+
+            /*!
+             * Stores the given status.
+             *
+             * @param status The status to store. Its size must match the size given upon construction.
+             *
+             * @return The slot at which the status is stored.
+             */
+            uint64_t store(storm::storage::BitVector const& status);
+
+            /*!
+             * Retrieves the status stored at the given slot.
+             *
+             * @param slot The slot of the status.
+             *
+             * @return The status.
+             */
+            storm::storage::BitVector load(uint64_t slot) const;
+
+            /*!
+             * Releases the given slot such that it can be reused.
+             *
+             * @param slot The slot to release.
+             */
+            void release(uint64_t slot);
+
+            /*!
+             * Retrieves the number of statuses that are currently stored.
+             *
+             * @return The number of occupied slots.
+             */
+            uint64_t size() const;
+
+        private:
+            // The number of bits of each status.
+            uint64_t numberOfBits;
+
+            // The number of words occupied by each status.
+            uint64_t wordsPerStatus;
+
+            // The words of all stored statuses.
+            std::vector<uint64_t> words;
+
+            // The slots that were released and can be reused.
+            std::vector<uint64_t> freeSlots;
+        };
+
+    }
+}
@@ -1,4 +1,7 @@
 #include "DFTState.h"
+
+#include <algorithm>
+
 #include "storm-dft/storage/dft/DFTElements.h"
 #include "storm-dft/storage/dft/DFT.h"
 
@@ -58,7 +61,8 @@ namespace storm {
                 std::shared_ptr<DFTDependency<ValueType> const> dependency = mDft.getDependency(dependencyId);
                 STORM_LOG_ASSERT(dependencyId == dependency->id(), "Ids do not match.");
                 assert(dependency->dependentEvents().size() == 1);
-                if (hasFailed(dependency->triggerEvent()->id()) && getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational) {
+                // Dependencies which were already resolved are not failable anymore
+                if (hasFailed(dependency->triggerEvent()->id()) && getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational && !dependencyTriggered(dependencyId)) {
                     mFailableDependencies.push_back(dependencyId);
                     STORM_LOG_TRACE("New dependency failure: " << dependency->toString());
                 }
@@ -66,6 +70,58 @@ namespace storm {
             mPseudoState = false;
         }
 
+        template<typename ValueType>
+        bool DFTState<ValueType>::isReconstructible() const {
+            STORM_LOG_ASSERT(!mPseudoState, "State is pseudo state.");
+            DFTState<ValueType> reconstructed(mStatus, mDft, mStateGenerationInfo, mId);
+            reconstructed.construct();
+            if (reconstructed.mCurrentlyFailableBE != mCurrentlyFailableBE || reconstructed.mFailableDependencies != mFailableDependencies) {
+                return false;
+            }
+
+            // Used representants are only queried for elements which have not failed, so neither their order nor the
+            // failed ones matter.
+            auto relevantUsedRepresentants = [this] (std::vector<size_t> const& usedRepresentants) {
+                std::vector<size_t> result;
+                for (size_t representant : usedRepresentants) {
+                    if (!hasFailed(representant)) {
+                        result.push_back(representant);
+                    }
+                }
+                std::sort(result.begin(), result.end());
+                result.erase(std::unique(result.begin(), result.end()), result.end());
+                return result;
+            };
+            return relevantUsedRepresentants(reconstructed.mUsedRepresentants) == relevantUsedRepresentants(mUsedRepresentants);
+        }
+
+        template<typename ValueType>
+        std::vector<size_t> DFTState<ValueType>::getOrderInformation() const {
+            STORM_LOG_ASSERT(!mPseudoState, "State is pseudo state.");
+            std::vector<size_t> result;
+            result.reserve(3 + mCurrentlyFailableBE.size() + mFailableDependencies.size() + mUsedRepresentants.size());
+            for (std::vector<size_t> const* elements : {&mCurrentlyFailableBE, &mFailableDependencies, &mUsedRepresentants}) {
+                result.push_back(elements->size());
+                result.insert(result.end(), elements->begin(), elements->end());
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void DFTState<ValueType>::construct(std::vector<size_t> const& orderInformation) {
+            construct();
+            auto it = orderInformation.begin();
+            for (std::vector<size_t>* elements : {&mCurrentlyFailableBE, &mFailableDependencies, &mUsedRepresentants}) {
+                STORM_LOG_ASSERT(it != orderInformation.end(), "Order information is incomplete.");
+                size_t nrEntries = *it;
+                ++it;
+                STORM_LOG_ASSERT(static_cast<size_t>(orderInformation.end() - it) >= nrEntries, "Order information is incomplete.");
+                elements->assign(it, it + nrEntries);
+                it += nrEntries;
+            }
+            STORM_LOG_ASSERT(it == orderInformation.end(), "Order information is too long.");
+        }
+
         template<typename ValueType>
         std::shared_ptr<DFTState<ValueType>> DFTState<ValueType>::copy() const {
             return std::make_shared<storm::storage::DFTState<ValueType>>(*this);
@@ -59,6 +59,30 @@ namespace storm {
              */
             void construct();
 
+            /**
+             * Check whether construct() yields this state again from its status, i.e. with the same currently failable
+             * BEs and failable dependencies (in the same order) and the same used representants.
+             *
+             * @return True iff the state can be reconstructed from its status.
+             */
+            bool isReconstructible() const;
+
+            /**
+             * Retrieve the information which construct() can not recover from the status, i.e. the currently failable
+             * BEs, the failable dependencies and the used representants, each preceded by its number of entries.
+             *
+             * @return The order information of the state.
+             */
+            std::vector<size_t> getOrderInformation() const;
+
+            /**
+             * Construct concrete state from pseudo state by using the underlying bitvector and the given order
+             * information as obtained by getOrderInformation().
+             *
+             * @param orderInformation The order information of the concrete state.
+             */
+            void construct(std::vector<size_t> const& orderInformation);
+
             std::shared_ptr<DFTState<ValueType>> copy() const;
 
             DFTElementState getElementState(size_t id) const;
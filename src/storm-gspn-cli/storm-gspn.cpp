@@ -7,6 +7,7 @@
 
 #include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/initialize.h"
@@ -21,6 +22,7 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/JSONExporter.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -120,14 +122,20 @@ int main(const int argc, const char **argv) {
             delete model;
         }
 
+        if (storm::settings::getModule<storm::settings::modules::GSPNSettings>().isExplicitBuildSet()) {
+            std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel(*gspn, storm::api::extractFormulasFromProperties(properties));
+            model->printModelInformationToStream(std::cout);
+            for (auto const& property : properties) {
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+                STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property " << property << " could not be checked.");
+                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                std::cout << "Result (initial states) for property " << property.getName() << ": " << *result << std::endl;
+            }
+        }
+
         delete gspn;
         return 0;
         
-//
-//        // construct ma
-//        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-//        auto ma = builder.translateGspn(gspn, formula);
-//
         // All operations have now been performed, so we clean up everything and terminate.
         storm::utility::cleanUp();
         return 0;
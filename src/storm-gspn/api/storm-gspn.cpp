@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/utility/file.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 
 
 namespace storm {
@@ -13,6 +14,11 @@ namespace storm {
             return builder.build();
         }
 
+        std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModel(storm::gspn::GSPN const& gspn, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+            storm::builder::ExplicitGspnModelBuilder<double> builder(gspn, storm::builder::BuilderOptions(formulas));
+            return builder.build();
+        }
+
         void handleGSPNExportSettings(storm::gspn::GSPN const& gspn) {
             storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
             if (exportSettings.isWriteToDotSet()) {
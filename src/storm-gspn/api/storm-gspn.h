@@ -1,6 +1,8 @@
 #pragma once
 
 #include "storm/storage/jani/Model.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 
@@ -12,6 +14,11 @@ namespace storm {
          */
         storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+        /**
+         *    Builds the state space of the GSPN directly (without the translation to JANI), eliminating vanishing markings.
+         */
+        std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModel(storm::gspn::GSPN const& gspn, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
         void handleGSPNExportSettings(storm::gspn::GSPN const& gspn);
     }
 }
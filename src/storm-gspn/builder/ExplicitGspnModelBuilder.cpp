@@ -1,326 +1,417 @@
-//#include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-//#include "storm/models/sparse/StandardRewardModel.h"
-//
-//#include "storm/utility/macros.h"
-//#include "storm/exceptions/NotImplementedException.h"
-//#include "storm/storage/expressions/ExpressionManager.h"
-//#include "storm-parsers/parser/FormulaParser.h"
-//#include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//namespace storm {
-//    namespace builder {
-//
-//        template<typename ValueType>
-//        storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula) {
-//            // set the given gspn and compute the limits of the net
-//            this->gspn = gspn;
-//            computeCapacities(gspn);
-//
-//            // markings maps markings to their corresponding rowgroups (indices)
-//            markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//            builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//            // add initial marking to todo list
-//            auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//            findOrAddBitvectorToMarkings(*bitvector);
-//            currentRowIndex = 0;
-//
-//            // vector marking markovian states (vector contains an 1 if the state is markovian)
-//            storm::storage::BitVector markovianStates(0);
-//
-//            // vector containing the exit rates for the markovian states
-//            std::vector<ValueType> exitRates;
-//
-//
-//            while (!todo.empty()) {
-//                // take next element from the todo list
-//                auto currentBitvector = todo.front();
-//                todo.pop_front();
-//                auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                // increment list of states by one
-//                markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                // create new row group for the current marking
-//                builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                std::cout << "work on: " << *currentBitvector << std::endl;
-//
-//                auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                if (!enabledImmediateTransitions.empty()) {
-//                    markovianStates.set(currentRowIndex, 0);
-//                    exitRates.push_back(0);
-//
-//                    auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                    addRowForPartitions(partitions, currentMarking);
-//                } else {
-//
-//                    auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                    if (!enabledTimedTransitions.empty()) {
-//                        markovianStates.set(currentRowIndex, 1);
-//
-//                        auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                        std::cout << "\t\tacc. rate: " << accRate << std::endl;
-//                        exitRates.push_back(accRate);
-//
-//                        addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                    } else {
-//                        markovianStates.set(currentRowIndex, 1);
-//                    }
-//                }
-//                ++currentRowIndex;
-//            }
-//
-//            auto matrix = builder.build();
-//
-//            // create expression manager and add variables from the gspn
-//            auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//            for (auto& place : gspn.getPlaces()) {
-//                expressionManager->declareIntegerVariable(place.getName());
-//            }
-//
-//            // parse formula
-//            storm::parser::FormulaParser formulaParser(expressionManager);
-//            auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//            auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//            // create empty state labeling
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//            storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//            std::cout << std::endl;
-//            std::cout << "build labeling:" << std::endl;
-//            for (auto& atomicFormula : atomicFormulas) {
-//                std::cout << atomicFormula;
-//                auto label = atomicFormula->toString();
-//                labeling.addLabel(label);
-//
-//                for (auto statePair : markings) {
-//                    auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                    for (auto& place : gspn.getPlaces()) {
-//                        auto variable = expressionManager->getVariable(place.getName());
-//                        expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                    }
-//                    bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                    if (hold) {
-//                        labeling.addLabelToState(label, statePair.second);
-//                    }
-//                }
-//
-//            }
-//
-//            //auto labeling = getStateLabeling();
-//
-//            return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions, storm::gspn::Marking const& currentMarking) {
-//            for (auto& partition : partitions) {
-//                std::cout << "\tnew partition:" << std::endl;
-//                auto accWeight = getAccumulatedWeight(partition);
-//                std::cout << "\t\tacc. weight: " << accWeight << std::endl;
-//
-//                std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                for (auto& trans : partition) {
-//                    std::cout << "\t\ttransname: " << trans.getName() << std::endl;
-//                    auto newMarking = trans.fire(currentMarking);
-//                    std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << std::endl;
-//
-//                    findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                    auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                    double currentWeight = 0;
-//                    if (it != weights.end()) {
-//                        currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                    }
-//                    currentWeight += trans.getWeight() / accWeight;
-//                    weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                }
-//
-//                addValuesToBuilder(weights);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//            std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//            for (auto& trans : enabledTimedTransitions) {
-//                std::cout << "\t\ttransname: " << trans.getName() << std::endl;
-//                auto newMarking = trans.fire(currentMarking);
-//                std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << std::endl;
-//
-//                findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                double currentWeightRate = 0;
-//                if (it != rates.end()) {
-//                    currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                }
-//                currentWeightRate += trans.getRate() / accRate;
-//                rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//            }
-//
-//            addValuesToBuilder(rates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//            for (auto& it : values) {
-//                std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << std::endl;
-//                builder.addNextValue(currentRowIndex, it.first, it.second);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                storm::gspn::Marking const& marking,
-//                std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//            decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//            for (auto& trans : enabledImmediateTransitions) {
-//                if (trans.noWeightAttached()) {
-//                    decltype(weightedTransitions) singleton;
-//                    singleton.push_back(trans);
-//                    result.push_back(singleton);
-//                } else {
-//                    weightedTransitions.push_back(trans);
-//                }
-//            }
-//
-//            if (weightedTransitions.size() != 0) {
-//                result.push_back(weightedTransitions);
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const {
-//            double result = 0;
-//
-//            for (auto &trans : vector) {
-//                result += trans.getWeight();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//            uint_fast64_t sum = 0;
-//            for (auto& place : gspn.getPlaces()) {//TODO
-//                numberOfBits[place.getID()] = 1;
-//                sum += numberOfBits[place.getID()];
-//            }
-//
-//            // compute next multiple of 64
-//            uint_fast64_t rem = sum % 64;
-//            numberOfTotalBits = sum + 64 - rem;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getTimedTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getImmediateTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//            double result = 0;
-//            for (auto trans : vector) {
-//                result += trans.getRate();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//            for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                if (std::get<1>(*it) == index) {
-//                    return std::get<0>(*it);
-//                }
-//            }
-//            return storm::storage::BitVector();
-//        }
-//
-//        template<typename ValueType>
-//        uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//            auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//            if (index == nextRowGroupIndex) {
-//                // bitvector was not already in the map
-//                ++nextRowGroupIndex;
-//                // bitvector was also never in the todo list
-//                todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//            }
-//            return index;
-//        }
-//
-//        template<typename ValueType>
-//        storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//            std::map<uint_fast64_t , std::string> idToName;
-//            for (auto& place : gspn.getPlaces()) {
-//                idToName[place.getID()] = place.getName();
-//                labeling.addLabel(place.getName());
-//            }
-//
-//            auto it = markings.begin();
-//            for ( ; it != markings.end() ; ++it) {
-//                auto bitvector = std::get<0>(*it);
-//                storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                    if (marking.getNumberOfTokensAt(i) > 0) {
-//                        std::cout << i << std::endl;
-//                        labeling.addLabelToState(idToName.at(i), i);
-//                    }
-//                }
-//            }
-//
-//            return labeling;
-//        }
-//
-//        template class ExplicitGspnModelBuilder<double>;
-//    }
-//}
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace builder {
+
+        namespace {
+            uint64_t getNumberOfBitsFor(uint64_t value) {
+                uint64_t result = 1;
+                while (result < 64 && (value >> result) != 0) {
+                    ++result;
+                }
+                return result;
+            }
+        }
+
+        template<typename ValueType>
+        const uint64_t ExplicitGspnModelBuilder<ValueType>::defaultNumberOfBitsForUnboundedPlaces = 8;
+
+        template<typename ValueType>
+        ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, storm::builder::BuilderOptions const& options) : gspn(gspn), options(options), numberOfBits(0) {
+            compile();
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::compile() {
+            // Lay out the places in the packed marking.
+            placeLayouts.resize(gspn.getNumberOfPlaces());
+            for (auto const& place : gspn.getPlaces()) {
+                PlaceLayout& layout = placeLayouts[place.getID()];
+                if (place.hasRestrictedCapacity()) {
+                    layout.capacity = place.getCapacity();
+                    STORM_LOG_THROW(place.getNumberOfInitialTokens() <= layout.capacity, storm::exceptions::WrongFormatException, "The initial number of tokens of place '" << place.getName() << "' exceeds its capacity.");
+                    layout.width = getNumberOfBitsFor(layout.capacity);
+                } else {
+                    layout.width = std::max(defaultNumberOfBitsForUnboundedPlaces, getNumberOfBitsFor(place.getNumberOfInitialTokens()));
+                    layout.capacity = layout.width == 64 ? std::numeric_limits<uint64_t>::max() : (1ull << layout.width) - 1;
+                }
+                layout.offset = numberOfBits;
+                numberOfBits += layout.width;
+            }
+            // The hash maps expect the number of bits to be a multiple of 64.
+            numberOfBits = std::max<uint64_t>(64, ((numberOfBits + 63) / 64) * 64);
+            markingToState = storm::storage::BitVectorHashMap<StateType>(numberOfBits, 1000);
+            eliminatedMarkings = storm::storage::BitVectorHashMap<uint64_t>(numberOfBits, 1000);
+
+            // Compile the transitions into the arc arrays.
+            for (auto const& transition : gspn.getImmediateTransitions()) {
+                immediateTransitions.push_back(compileTransition(transition, transition.getWeight()));
+            }
+            for (auto const& transition : gspn.getTimedTransitions()) {
+                timedTransitions.push_back(compileTransition(transition, transition.getRate()));
+            }
+
+            // As in the translation to JANI, immediate transitions without weight are ignored.
+            for (auto const& partition : gspn.getPartitions()) {
+                CompiledPartition compiledPartition;
+                compiledPartition.priority = partition.priority;
+                for (auto const& transition : partition.transitions) {
+                    if (gspn.getImmediateTransitions()[transition].noWeightAttached()) {
+                        STORM_LOG_WARN("Ignoring immediate transition '" << gspn.getImmediateTransitions()[transition].getName() << "' as it has no weight.");
+                    } else {
+                        compiledPartition.transitions.push_back(transition);
+                    }
+                }
+                if (!compiledPartition.transitions.empty()) {
+                    partitions.push_back(std::move(compiledPartition));
+                }
+            }
+            std::stable_sort(partitions.begin(), partitions.end(), [] (CompiledPartition const& first, CompiledPartition const& second) { return first.priority > second.priority; });
+
+            // Prepare the labels.
+            for (auto const& expression : options.getExpressionLabels()) {
+                std::stringstream stream;
+                stream << expression;
+                labels.emplace_back(stream.str(), expression);
+            }
+            for (auto const& label : options.getLabelNames()) {
+                STORM_LOG_THROW(label == "init" || label == "deadlock", storm::exceptions::InvalidArgumentException, "Unknown label '" << label << "'. Properties of GSPNs may only refer to the places of the GSPN.");
+            }
+            if (!labels.empty()) {
+                storm::expressions::ExpressionManager const& manager = *gspn.getExpressionManager();
+                evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(manager);
+                placeVariables.resize(gspn.getNumberOfPlaces());
+                for (auto const& place : gspn.getPlaces()) {
+                    if (manager.hasVariable(place.getName())) {
+                        placeVariables[place.getID()] = manager.getVariable(place.getName());
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        typename ExplicitGspnModelBuilder<ValueType>::CompiledTransition ExplicitGspnModelBuilder<ValueType>::compileTransition(storm::gspn::Transition const& transition, ValueType const& value) {
+            auto makeArc = [this] (uint64_t place, int64_t value) {
+                PlaceLayout const& layout = placeLayouts[place];
+                return PlaceArc({place, layout.offset, layout.width, value});
+            };
+
+            CompiledTransition result;
+            result.transition = &transition;
+            result.value = value;
+            result.inputBegin = arcs.size();
+            for (auto const& entry : transition.getInputPlaces()) {
+                arcs.push_back(makeArc(entry.first, entry.second));
+            }
+            result.inhibitionBegin = arcs.size();
+            for (auto const& entry : transition.getInhibitionPlaces()) {
+                arcs.push_back(makeArc(entry.first, entry.second));
+            }
+
+            // Firing only needs the net change of tokens of each place.
+            result.updateBegin = arcs.size();
+            std::map<uint64_t, int64_t> changes;
+            for (auto const& entry : transition.getInputPlaces()) {
+                changes[entry.first] -= static_cast<int64_t>(entry.second);
+            }
+            for (auto const& entry : transition.getOutputPlaces()) {
+                changes[entry.first] += static_cast<int64_t>(entry.second);
+            }
+            for (auto const& change : changes) {
+                if (change.second != 0) {
+                    arcs.push_back(makeArc(change.first, change.second));
+                }
+            }
+            result.updateEnd = arcs.size();
+            return result;
+        }
+
+        template<typename ValueType>
+        bool ExplicitGspnModelBuilder<ValueType>::isEnabled(storm::storage::BitVector const& marking, CompiledTransition const& transition) const {
+            for (uint64_t arc = transition.inputBegin; arc < transition.inhibitionBegin; ++arc) {
+                if (marking.getAsInt(arcs[arc].offset, arcs[arc].width) < static_cast<uint64_t>(arcs[arc].value)) {
+                    return false;
+                }
+            }
+            for (uint64_t arc = transition.inhibitionBegin; arc < transition.updateBegin; ++arc) {
+                if (marking.getAsInt(arcs[arc].offset, arcs[arc].width) >= static_cast<uint64_t>(arcs[arc].value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::fire(storm::storage::BitVector const& marking, CompiledTransition const& transition) const {
+            storm::storage::BitVector result(marking);
+            for (uint64_t arc = transition.updateBegin; arc < transition.updateEnd; ++arc) {
+                PlaceArc const& update = arcs[arc];
+                uint64_t tokens = result.getAsInt(update.offset, update.width);
+                if (update.value > 0) {
+                    STORM_LOG_THROW(placeLayouts[update.place].capacity - tokens >= static_cast<uint64_t>(update.value), storm::exceptions::WrongFormatException, "Firing transition '" << transition.transition->getName() << "' exceeds the capacity of place '" << gspn.getPlace(update.place)->getName() << "'." << (gspn.getPlace(update.place)->hasRestrictedCapacity() ? "" : " Please specify a capacity for this place."));
+                    tokens += update.value;
+                } else {
+                    tokens -= static_cast<uint64_t>(-update.value);
+                }
+                result.setFromInt(update.offset, update.width, tokens);
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::vector<std::vector<uint64_t>> ExplicitGspnModelBuilder<ValueType>::getImmediateChoices(storm::storage::BitVector const& marking) const {
+            std::vector<std::vector<uint64_t>> result;
+            uint64_t priority = 0;
+            for (auto const& partition : partitions) {
+                // Partitions of lower priority are disabled by any enabled partition of higher priority.
+                if (!result.empty() && partition.priority < priority) {
+                    break;
+                }
+                std::vector<uint64_t> enabledTransitions;
+                for (auto const& transition : partition.transitions) {
+                    if (isEnabled(marking, immediateTransitions[transition])) {
+                        enabledTransitions.push_back(transition);
+                    }
+                }
+                if (!enabledTransitions.empty()) {
+                    priority = partition.priority;
+                    result.push_back(std::move(enabledTransitions));
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        bool ExplicitGspnModelBuilder<ValueType>::addSuccessors(storm::storage::BitVector const& marking, ValueType const& factor, std::map<StateType, ValueType>& row) {
+            if (markingToState.contains(marking)) {
+                row[markingToState.getValue(marking)] += factor;
+                return true;
+            }
+            if (eliminatedMarkings.contains(marking)) {
+                for (auto const& entry : eliminatedDistributions[eliminatedMarkings.getValue(marking)]) {
+                    row[entry.first] += factor * entry.second;
+                }
+                return true;
+            }
+
+            std::vector<std::vector<uint64_t>> choices = getImmediateChoices(marking);
+            if (choices.size() != 1 || satisfiesSomeLabel(marking)) {
+                // The marking is tangible, resolves a nondeterministic choice or is labeled, so it needs a state.
+                row[getOrAddState(marking)] += factor;
+                return true;
+            }
+            if (!markingsBeingEliminated.insert(marking).second) {
+                cycleMarking = marking;
+                return false;
+            }
+
+            // Eliminate the vanishing marking by resolving the probabilistic choice between its enabled transitions.
+            ValueType totalWeight = storm::utility::zero<ValueType>();
+            for (auto const& transition : choices.front()) {
+                totalWeight += immediateTransitions[transition].value;
+            }
+            std::map<StateType, ValueType> distribution;
+            for (auto const& transition : choices.front()) {
+                CompiledTransition const& compiledTransition = immediateTransitions[transition];
+                if (!addSuccessors(fire(marking, compiledTransition), compiledTransition.value / totalWeight, distribution)) {
+                    markingsBeingEliminated.erase(marking);
+                    return false;
+                }
+            }
+            markingsBeingEliminated.erase(marking);
+
+            eliminatedMarkings.findOrAdd(marking, eliminatedDistributions.size());
+            eliminatedDistributions.emplace_back(distribution.begin(), distribution.end());
+            for (auto const& entry : distribution) {
+                row[entry.first] += factor * entry.second;
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::computeRow(storm::storage::BitVector const& marking, std::vector<uint64_t> const& transitions, std::vector<CompiledTransition> const& compiledTransitions, ValueType const& total, std::map<StateType, ValueType>& row) {
+            bool complete = false;
+            while (!complete) {
+                row.clear();
+                complete = true;
+                for (auto const& transition : transitions) {
+                    CompiledTransition const& compiledTransition = compiledTransitions[transition];
+                    if (!addSuccessors(fire(marking, compiledTransition), compiledTransition.value / total, row)) {
+                        // Keeping the marking on the cycle as a state breaks the cycle.
+                        getOrAddState(cycleMarking);
+                        complete = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        typename ExplicitGspnModelBuilder<ValueType>::StateType ExplicitGspnModelBuilder<ValueType>::getOrAddState(storm::storage::BitVector const& marking) {
+            StateType newState = markingToState.size();
+            StateType state = markingToState.findOrAdd(marking, newState);
+            if (state == newState) {
+                statesToExplore.push_back(marking);
+            }
+            return state;
+        }
+
+        template<typename ValueType>
+        void ExplicitGspnModelBuilder<ValueType>::setEvaluatorValues(storm::storage::BitVector const& marking) {
+            for (uint64_t place = 0; place < placeVariables.size(); ++place) {
+                if (placeVariables[place]) {
+                    evaluator->setIntegerValue(placeVariables[place].get(), marking.getAsInt(placeLayouts[place].offset, placeLayouts[place].width));
+                }
+            }
+        }
+
+        template<typename ValueType>
+        bool ExplicitGspnModelBuilder<ValueType>::satisfiesSomeLabel(storm::storage::BitVector const& marking) {
+            if (labels.empty()) {
+                return false;
+            }
+            setEvaluatorValues(marking);
+            for (auto const& label : labels) {
+                if (evaluator->asBool(label.second)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename ValueType>
+        storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::buildStateLabeling(std::vector<StateType> const& initialStates, std::vector<StateType> const& deadlockStates) {
+            storm::models::sparse::StateLabeling result(markingToState.size());
+            for (auto const& label : labels) {
+                if (!result.containsLabel(label.first)) {
+                    result.addLabel(label.first);
+                }
+            }
+            if (!labels.empty()) {
+                for (auto const& markingStatePair : markingToState) {
+                    setEvaluatorValues(markingStatePair.first);
+                    for (auto const& label : labels) {
+                        if (evaluator->asBool(label.second)) {
+                            result.addLabelToState(label.first, markingStatePair.second);
+                        }
+                    }
+                }
+            }
+
+            result.addLabel("init");
+            for (auto const& state : initialStates) {
+                result.addLabelToState("init", state);
+            }
+            result.addLabel("deadlock");
+            for (auto const& state : deadlockStates) {
+                result.addLabelToState("deadlock", state);
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+            storm::storage::BitVector initialMarking(numberOfBits);
+            for (auto const& place : gspn.getPlaces()) {
+                PlaceLayout const& layout = placeLayouts[place.getID()];
+                initialMarking.setFromInt(layout.offset, layout.width, place.getNumberOfInitialTokens());
+            }
+
+            // A vanishing initial marking is only kept if it does not lead to a unique state.
+            std::map<StateType, ValueType> initialDistribution;
+            while (!addSuccessors(initialMarking, storm::utility::one<ValueType>(), initialDistribution)) {
+                initialDistribution.clear();
+                getOrAddState(cycleMarking);
+            }
+            StateType initialState = initialDistribution.size() == 1 ? initialDistribution.begin()->first : getOrAddState(initialMarking);
+
+            bool fixDeadlocks = !storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet();
+            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, true, 0);
+            std::vector<StateType> probabilisticStates;
+            std::vector<StateType> deadlockStates;
+            std::map<StateType, ValueType> row;
+            uint64_t currentRow = 0;
+            StateType currentState = 0;
+
+            // States are explored in the order of their creation, such that the row groups match the state indices.
+            while (!statesToExplore.empty()) {
+                storm::storage::BitVector marking = std::move(statesToExplore.front());
+                statesToExplore.pop_front();
+                transitionMatrixBuilder.newRowGroup(currentRow);
+
+                std::vector<std::vector<uint64_t>> choices = getImmediateChoices(marking);
+                if (choices.empty()) {
+                    std::vector<uint64_t> enabledTransitions;
+                    for (uint64_t transition = 0; transition < timedTransitions.size(); ++transition) {
+                        if (isEnabled(marking, timedTransitions[transition])) {
+                            enabledTransitions.push_back(transition);
+                        }
+                    }
+                    if (enabledTransitions.empty()) {
+                        STORM_LOG_THROW(fixDeadlocks, storm::exceptions::WrongFormatException, "Found a deadlock marking in the GSPN. For fixing these, please provide the appropriate option.");
+                        deadlockStates.push_back(currentState);
+                        row.clear();
+                        row[currentState] = storm::utility::one<ValueType>();
+                    } else {
+                        computeRow(marking, enabledTransitions, timedTransitions, storm::utility::one<ValueType>(), row);
+                    }
+                    for (auto const& entry : row) {
+                        transitionMatrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                    }
+                    ++currentRow;
+                } else {
+                    probabilisticStates.push_back(currentState);
+                    for (auto const& choice : choices) {
+                        ValueType totalWeight = storm::utility::zero<ValueType>();
+                        for (auto const& transition : choice) {
+                            totalWeight += immediateTransitions[transition].value;
+                        }
+                        computeRow(marking, choice, immediateTransitions, totalWeight, row);
+                        for (auto const& entry : row) {
+                            transitionMatrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                        }
+                        ++currentRow;
+                    }
+                }
+                ++currentState;
+            }
+
+            StateType numberOfStates = currentState;
+            storm::storage::SparseMatrix<ValueType> transitionMatrix = transitionMatrixBuilder.build(currentRow, numberOfStates, numberOfStates);
+            storm::models::sparse::StateLabeling stateLabeling = buildStateLabeling({initialState}, deadlockStates);
+            STORM_LOG_INFO("Built " << numberOfStates << " states from the GSPN. Eliminated " << eliminatedDistributions.size() << " vanishing markings and kept " << probabilisticStates.size() << " vanishing markings.");
+
+            if (probabilisticStates.empty()) {
+                transitionMatrix.makeRowGroupingTrivial();
+                storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(stateLabeling), std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>(), true);
+                return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(components));
+            }
+
+            storm::storage::BitVector markovianStates(numberOfStates, true);
+            for (auto const& state : probabilisticStates) {
+                markovianStates.set(state, false);
+            }
+            storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(stateLabeling), std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>(), true, std::move(markovianStates));
+            return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+        }
+
+        template class ExplicitGspnModelBuilder<double>;
+    }
+}
@@ -1,172 +1,163 @@
-//#ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//#define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-//#include <string>
-//
-//#include "storm/models/sparse/MarkovAutomaton.h"
-//#include "storm/models/sparse/StandardRewardModel.h"
-//#include "storm/storage/BitVector.h"
-//#include "storm/storage/BitVectorHashMap.h"
-//#include "storm/storage/gspn/GSPN.h"
-//#include "storm/storage/gspn/ImmediateTransition.h"
-//#include "storm/storage/gspn/TimedTransition.h"
-//
-//namespace storm {
-//    namespace builder {
-//
-//        /*!
-//         * This class provides the facilities for building an markov automaton.
-//         */
-//        template<typename ValueType=double>
-//        class ExplicitGspnModelBuilder {
-//        public:
-//
-//            /*!
-//             * Builds an MarkovAutomaton from the given GSPN.
-//             *
-//             * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//             * @return The resulting MarkovAutomaton
-//             */
-//            storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//        private:
-//
-//            /*!
-//             * Add for each partition a new row in the probability matrix.
-//             *
-//             * @param partitions The partitioned immediate transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             */
-//            void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions, storm::gspn::Marking const& currentMarking);
-//
-//
-//            /*!
-//             * Add row for a markovian state.
-//             *
-//             * @param enabledTimedTransitions List of enabled timed transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             * @param accRate The sum of all rates of the enabled timed transisitons
-//             */
-//            void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//            /*!
-//             * Struct for comparing unsigned integer for maps
-//             */
-//            struct cmpByIndex {
-//                bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                    return a < b;
-//                }
-//            };
-//
-//            /*!
-//             * This method insert the values from a map into the matrix
-//             *
-//             * @param values The values which are inserted
-//             */
-//            void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//            /*!
-//             * This method partitions all enabled immediate transitions w.r.t. a marking.
-//             * All enabled weighted immediate transitions are in one vector. Between these transitions
-//             * is chosen probabilistically by the weights.
-//             *
-//             * All other enabled non-weighted immediate transitions are in an singleton vector.
-//             * Between different vectors is chosen non-deterministically.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//             * @return The vector of vectors which is described above.
-//             */
-//            std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//            /*!
-//             * Computes the accumulated weight of immediate transisions which are stored in a list.
-//             *
-//             * @param vector List of immediate transisitions.
-//             */
-//            double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//            /*!
-//             * Compute the upper bound for the number of tokens in each place.
-//             * Also computes the number of bits which are used to store a marking.
-//             *
-//             * @param gspn The corresponding gspn.
-//             */
-//            void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//            /*!
-//             * Returns the vector of enabled timed transition with the highest priority.
-//             *
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled timed transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Returns the vector of active immediate transition with the highest priority.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled immediate transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Computes the accumulated rate of a vector of timed transitions.
-//             *
-//             * @param vector The vector of timed transitions.
-//             * @return The accumulated rate.
-//             */
-//            double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//            // is only needed for debugging purposes
-//            // since markings is injective, we can determine the bitvector
-//            storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//            /*!
-//             * Adds the bitvector to the marking-map.
-//             * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//             *
-//             * @return The rowGroup index for the bitvector.
-//             */
-//            uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//            /*!
-//             * Computes the state labeling and returns it.
-//             * Every state is labeled with its name.
-//             *
-//             * @return The computed state labeling.
-//             */
-//            storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//            // contains the number of bits which are used the store the number of tokens at each place
-//            std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//            // contains the number of bits used to create markings
-//            uint_fast64_t numberOfTotalBits;
-//
-//            // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//            storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//            // a list of markings for which the outgoing edges need to be computed
-//            std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//            //the gspn which is transformed
-//            storm::gspn::GSPN gspn;
-//
-//            // the next index for a new rowgroup
-//            uint_fast64_t nextRowGroupIndex = 0;
-//
-//            // builder object which is used to create the probability matrix
-//            storm::storage::SparseMatrixBuilder<double> builder;
-//
-//            // contains the current row index during the computation
-//            uint_fast64_t currentRowIndex;
-//        };
-//    }
-//}
-//
-//#endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/sparse/StateType.h"
+#include "storm-gspn/storage/gspn/GSPN.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * This class builds the state space of a GSPN explicitly, i.e. without the detour via JANI. Markings are stored
+         * as packed bit fields and transitions are fired via precomputed arc arrays. Vanishing markings (markings in
+         * which an immediate transition is enabled) are eliminated on the fly, such that the result is a CTMC over the
+         * tangible markings. Vanishing markings are only kept as (probabilistic) states if they resolve a
+         * nondeterministic choice, lie on a cycle of immediate transitions or satisfy one of the labels that are to be
+         * built. In this case, a Markov automaton is built.
+         */
+        template<typename ValueType = double>
+        class ExplicitGspnModelBuilder {
+        public:
+            typedef storm::storage::sparse::state_type StateType;
+
+            /*!
+             * Creates a builder for the given GSPN.
+             *
+             * @param gspn The GSPN whose state space is built.
+             * @param options The options of the builder. The expression labels are evaluated over the places of the GSPN.
+             */
+            ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, storm::builder::BuilderOptions const& options = storm::builder::BuilderOptions());
+
+            /*!
+             * Builds the model.
+             *
+             * @return A CTMC if all vanishing markings could be eliminated and a Markov automaton otherwise.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+        private:
+            // The position of the tokens of a place in the packed marking.
+            struct PlaceLayout {
+                uint64_t offset;
+                uint64_t width;
+                uint64_t capacity;
+            };
+
+            // An arc of a transition with the position of the connected place in the packed marking. For input and
+            // inhibition arcs the value is the multiplicity, for updates it is the change of the number of tokens.
+            struct PlaceArc {
+                uint64_t place;
+                uint64_t offset;
+                uint64_t width;
+                int64_t value;
+            };
+
+            // A transition whose arcs are stored in the ranges [inputBegin, inhibitionBegin), [inhibitionBegin,
+            // updateBegin) and [updateBegin, updateEnd) of the arc array.
+            struct CompiledTransition {
+                storm::gspn::Transition const* transition;
+                uint64_t inputBegin;
+                uint64_t inhibitionBegin;
+                uint64_t updateBegin;
+                uint64_t updateEnd;
+                ValueType value;
+            };
+
+            struct CompiledPartition {
+                uint64_t priority;
+                std::vector<uint64_t> transitions;
+            };
+
+            /*!
+             * Computes the layout of the packed markings and compiles the transitions into the arc arrays.
+             */
+            void compile();
+
+            CompiledTransition compileTransition(storm::gspn::Transition const& transition, ValueType const& value);
+
+            bool isEnabled(storm::storage::BitVector const& marking, CompiledTransition const& transition) const;
+
+            storm::storage::BitVector fire(storm::storage::BitVector const& marking, CompiledTransition const& transition) const;
+
+            /*!
+             * Retrieves the choices of immediate transitions in the given marking. There is one choice for each
+             * partition of the highest priority that has an enabled transition. Each choice holds the enabled (weighted)
+             * transitions of its partition. If there is no choice, the marking is tangible.
+             */
+            std::vector<std::vector<uint64_t>> getImmediateChoices(storm::storage::BitVector const& marking) const;
+
+            /*!
+             * Adds the distribution over states that is reached from the given marking, scaled by the given factor, to
+             * the row. If the marking is vanishing and can be eliminated, this is the distribution over the states
+             * reached by firing immediate transitions.
+             *
+             * @return False iff a cycle of immediate transitions was encountered. In this case, the marking on the cycle
+             * is stored in cycleMarking and the row is incomplete.
+             */
+            bool addSuccessors(storm::storage::BitVector const& marking, ValueType const& factor, std::map<StateType, ValueType>& row);
+
+            /*!
+             * Adds the successors of all given transitions (weighted by their value over the given total) to the row. If
+             * a cycle of immediate transitions is encountered, the marking on the cycle is kept as a state and the row
+             * is computed again.
+             */
+            void computeRow(storm::storage::BitVector const& marking, std::vector<uint64_t> const& transitions, std::vector<CompiledTransition> const& compiledTransitions, ValueType const& total, std::map<StateType, ValueType>& row);
+
+            /*!
+             * Retrieves the state of the given marking. If the marking does not yet have a state, one is created and the
+             * marking is scheduled for exploration.
+             */
+            StateType getOrAddState(storm::storage::BitVector const& marking);
+
+            void setEvaluatorValues(storm::storage::BitVector const& marking);
+
+            bool satisfiesSomeLabel(storm::storage::BitVector const& marking);
+
+            storm::models::sparse::StateLabeling buildStateLabeling(std::vector<StateType> const& initialStates, std::vector<StateType> const& deadlockStates);
+
+            // The default number of bits per place for places without capacity.
+            static const uint64_t defaultNumberOfBitsForUnboundedPlaces;
+
+            storm::gspn::GSPN const& gspn;
+            storm::builder::BuilderOptions options;
+
+            // The layout of the markings.
+            std::vector<PlaceLayout> placeLayouts;
+            uint64_t numberOfBits;
+
+            // The compiled transitions and their arcs.
+            std::vector<PlaceArc> arcs;
+            std::vector<CompiledTransition> immediateTransitions;
+            std::vector<CompiledTransition> timedTransitions;
+            std::vector<CompiledPartition> partitions;
+
+            // The labels that are built and an evaluator for them.
+            std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+            std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
+            std::vector<boost::optional<storm::expressions::Variable>> placeVariables;
+
+            // The markings that have a state and the markings whose states still need to be explored.
+            storm::storage::BitVectorHashMap<StateType> markingToState;
+            std::deque<storm::storage::BitVector> statesToExplore;
+
+            // The eliminated vanishing markings and the distributions over states they lead to.
+            storm::storage::BitVectorHashMap<uint64_t> eliminatedMarkings;
+            std::vector<std::vector<std::pair<StateType, ValueType>>> eliminatedDistributions;
+
+            // The vanishing markings that are currently being eliminated and the marking on a detected cycle.
+            std::unordered_set<storm::storage::BitVector> markingsBeingEliminated;
+            storm::storage::BitVector cycleMarking;
+        };
+    }
+}
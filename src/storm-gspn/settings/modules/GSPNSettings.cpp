@@ -18,6 +18,7 @@ namespace storm {
             const std::string GSPNSettings::gspnFileOptionShortName = "gspn";
             const std::string GSPNSettings::gspnToJaniOptionName = "to-jani";
             const std::string GSPNSettings::gspnToJaniOptionShortName = "tj";
+            const std::string GSPNSettings::explicitBuildOptionName = "explicit";
             const std::string GSPNSettings::capacitiesFileOptionName = "capacitiesfile";
             const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
             
@@ -25,6 +26,7 @@ namespace storm {
             GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.").setShortName(gspnFileOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "path to file").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, gspnToJaniOptionName, false, "Transform to JANI.").setShortName(gspnToJaniOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBuildOptionName, false, "Builds the state space explicitly (eliminating vanishing markings) and checks the given properties.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, capacitiesFileOptionName, false, "Capacaties as invariants for places.").setShortName(capacitiesFileOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "path to file").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
             }
             
@@ -40,6 +42,10 @@ namespace storm {
                 return this->getOption(gspnToJaniOptionName).getHasOptionBeenSet();
             }
             
+            bool GSPNSettings::isExplicitBuildSet() const {
+                return this->getOption(explicitBuildOptionName).getHasOptionBeenSet();
+            }
+            
             bool GSPNSettings::isCapacitiesFileSet() const {
                 return this->getOption(capacitiesFileOptionName).getHasOptionBeenSet();
             }
@@ -60,6 +66,9 @@ namespace storm {
                     if(isCapacitiesFileSet()) {
                         return false;
                     }
+                    if(isExplicitBuildSet()) {
+                        return false;
+                    }
                 }
                 return true;
             }
@@ -28,6 +28,11 @@ namespace storm {
                  * Whether the gspn should be transformed to Jani
                  */
                 bool isToJaniSet() const;
+
+                /**
+                 * Whether the state space of the gspn should be built explicitly (without the translation to Jani)
+                 */
+                bool isExplicitBuildSet() const;
                 
                 /**
                  * Retrievew whether the pgcl file option was set
@@ -50,6 +55,7 @@ namespace storm {
                 static const std::string gspnFileOptionShortName;
                 static const std::string gspnToJaniOptionName;
                 static const std::string gspnToJaniOptionShortName;
+                static const std::string explicitBuildOptionName;
                 static const std::string capacitiesFileOptionName;
                 static const std::string capacitiesFileOptionShortName;
                 
@@ -16,6 +16,7 @@
 #include "storm/utility/macros.h"
 
 #include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcBatchInstantiationModelChecker.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -33,7 +34,7 @@ namespace storm {
 
         template <typename ValueType>
         struct SampleInformation {
-            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact) {
+            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact), batchSize(1) {
                 // Intentionally left empty.
             }
             
@@ -44,6 +45,7 @@ namespace storm {
             std::vector<std::map<typename utility::parametric::VariableType<ValueType>::type, std::vector<typename utility::parametric::CoefficientType<ValueType>::type>>> cartesianProducts;
             bool graphPreserving;
             bool exact;
+            uint64_t batchSize;
         };
         
         template <typename ValueType>
@@ -251,6 +253,54 @@ namespace storm {
             }
         }
         
+        template <typename ValueType>
+        void forEachSamplePoint(SampleInformation<ValueType> const& samples, std::function<void(storm::utility::parametric::Valuation<ValueType> const&)> const& callback) {
+            storm::utility::parametric::Valuation<ValueType> valuation;
+            
+            std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+            
+            for (auto const& product : samples.cartesianProducts) {
+                parameters.clear();
+                iterators.clear();
+                iteratorEnds.clear();
+                
+                for (auto const& entry : product) {
+                    parameters.push_back(entry.first);
+                    iterators.push_back(entry.second.cbegin());
+                    iteratorEnds.push_back(entry.second.cend());
+                }
+                
+                bool done = false;
+                while (!done) {
+                    // Read off valuation.
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        valuation[parameters[i]] = *iterators[i];
+                    }
+                    
+                    callback(valuation);
+                    
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        ++iterators[i];
+                        if (iterators[i] == iteratorEnds[i]) {
+                            // Reset iterator and proceed to move next iterator.
+                            iterators[i] = product.at(parameters[i]).cbegin();
+                            
+                            // If the last iterator was removed, we are done.
+                            if (i == parameters.size() - 1) {
+                                done = true;
+                            }
+                        } else {
+                            // If an iterator was moved but not reset, we have another valuation to check.
+                            break;
+                        }
+                    }
+                    
+                }
+            }
+        }
+        
         template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
         void verifyPropertiesAtSamplePoints(ModelType const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
             
@@ -263,31 +313,64 @@ namespace storm {
                 modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
                 modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
                 
-                storm::utility::parametric::Valuation<ValueType> valuation;
-                
-                std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
-                
                 storm::utility::Stopwatch watch(true);
-                for (auto const& product : samples.cartesianProducts) {
-                    parameters.clear();
-                    iterators.clear();
-                    iteratorEnds.clear();
+                forEachSamplePoint<ValueType>(samples, [&] (storm::utility::parametric::Valuation<ValueType> const& valuation) {
+                    storm::utility::Stopwatch valuationWatch(true);
+                    std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+                    valuationWatch.stop();
                     
-                    for (auto const& entry : product) {
-                        parameters.push_back(entry.first);
-                        iterators.push_back(entry.second.cbegin());
-                        iteratorEnds.push_back(entry.second.cend());
+                    if (result) {
+                        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                     }
-                    
-                    bool done = false;
-                    while (!done) {
-                        // Read off valuation.
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            valuation[parameters[i]] = *iterators[i];
+                    printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
+                });
+                
+                watch.stop();
+                STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << std::endl << std::endl);
+            }
+        }
+        
+        template<typename ValueType>
+        void verifyPropertiesAtSamplePointsInBatches(storm::models::sparse::Dtmc<ValueType> const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+            
+            // Graph-preserving samples of DTMCs are checked in batches sharing one equation system.
+            storm::modelchecker::SparseDtmcBatchInstantiationModelChecker<storm::models::sparse::Dtmc<ValueType>, double> batchModelchecker(model);
+            storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<ValueType>, double> modelchecker(model);
+            batchModelchecker.setInstantiationsAreGraphPreserving(true);
+            modelchecker.setInstantiationsAreGraphPreserving(true);
+            
+            for (auto const& property : input.properties) {
+                storm::cli::printModelCheckingProperty(property);
+                
+                auto task = storm::api::createTask<ValueType>(property.getRawFormula(), true);
+                batchModelchecker.specifyFormula(task);
+                bool useBatches = batchModelchecker.canHandleSpecifiedFormula();
+                if (!useBatches) {
+                    STORM_LOG_INFO("Property can not be checked in batches, checking the samples one by one.");
+                    modelchecker.specifyFormula(task);
+                }
+                
+                std::vector<storm::utility::parametric::Valuation<ValueType>> batch;
+                auto checkBatch = [&] () {
+                    storm::utility::Stopwatch batchWatch(true);
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = batchModelchecker.checkBatch(Environment(), batch);
+                    batchWatch.stop();
+                    for (uint64_t i = 0; i < batch.size(); ++i) {
+                        results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                        printInitialStatesResult<ValueType>(results[i], property, nullptr, &batch[i]);
+                    }
+                    STORM_PRINT_AND_LOG("Time for model checking a batch of " << batch.size() << " instances: " << batchWatch << "." << std::endl << std::endl);
+                    batch.clear();
+                };
+                
+                storm::utility::Stopwatch watch(true);
+                forEachSamplePoint<ValueType>(samples, [&] (storm::utility::parametric::Valuation<ValueType> const& valuation) {
+                    if (useBatches) {
+                        batch.push_back(valuation);
+                        if (batch.size() == samples.batchSize) {
+                            checkBatch();
                         }
-                        
+                    } else {
                         storm::utility::Stopwatch valuationWatch(true);
                         std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
                         valuationWatch.stop();
@@ -296,24 +379,10 @@ namespace storm {
                             result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                         }
                         printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
-                        
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            ++iterators[i];
-                            if (iterators[i] == iteratorEnds[i]) {
-                                // Reset iterator and proceed to move next iterator.
-                                iterators[i] = product.at(parameters[i]).cbegin();
-                                
-                                // If the last iterator was removed, we are done.
-                                if (i == parameters.size() - 1) {
-                                    done = true;
-                                }
-                            } else {
-                                // If an iterator was moved but not reset, we have another valuation to check.
-                                break;
-                            }
-                        }
-                        
                     }
+                });
+                if (!batch.empty()) {
+                    checkBatch();
                 }
                 
                 watch.stop();
@@ -323,7 +392,9 @@ namespace storm {
         
         template <typename ValueType, typename SolveValueType = double>
         void verifyPropertiesAtSamplePoints(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
-            if (model->isOfType(storm::models::ModelType::Dtmc)) {
+            if (model->isOfType(storm::models::ModelType::Dtmc) && samples.graphPreserving && !samples.exact && samples.batchSize > 1) {
+                verifyPropertiesAtSamplePointsInBatches<ValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+            } else if (model->isOfType(storm::models::ModelType::Dtmc)) {
                 verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
                 verifyPropertiesAtSamplePoints<storm::modelchecker::SparseCtmcInstantiationModelChecker, storm::models::sparse::Ctmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
@@ -399,7 +470,7 @@ namespace storm {
                                         if (regionSettings.isDepthLimitSet()) {
                                             optionalDepthLimit = regionSettings.getDepthLimit();
                                         }
-                                        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis());
+                                        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), regionSettings.getRefinementThreadCount());
                                         return result;
                                     };
             } else {
@@ -467,6 +538,7 @@ namespace storm {
             std::vector<storm::storage::ParameterRegion<ValueType>> regions = parseRegions<ValueType>(model);
             SampleInformation<ValueType> samples = parseSamples<ValueType>(model, parSettings.getSamples(), parSettings.isSamplesAreGraphPreservingSet());
             samples.exact = parSettings.isSampleExactSet();
+            samples.batchSize = parSettings.getSamplesBatchSize();
             
             if (model) {
                 storm::cli::exportModel<DdType, ValueType>(model, input);
@@ -180,11 +180,20 @@ namespace storm {
          * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
          * @param refinementDepthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
          * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds (and NOT the complementary result).
+         * @param numberOfThreads the number of threads that concurrently analyze (sub-)regions. Each thread uses its own region model checker.
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, uint64_t numberOfThreads = 1) {
             Environment env;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine);
+            if (numberOfThreads > 1) {
+                // The checkers are specified sequentially, as the construction of the parameter lifters is not thread-safe.
+                std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> additionalCheckers;
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    additionalCheckers.push_back(initializeRegionModelChecker(env, model, task, engine));
+                }
+                return regionChecker->performParallelRegionRefinement(env, additionalCheckers, region, coverageThreshold, refinementDepthThreshold, hypothesis);
+            }
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis);
         }
         
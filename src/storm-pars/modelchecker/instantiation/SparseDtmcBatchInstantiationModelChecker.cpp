@@ -0,0 +1,243 @@
+#include "storm-pars/modelchecker/instantiation/SparseDtmcBatchInstantiationModelChecker.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcBatchInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), equationSystemPrepared(false), rewardFormula(false) {
+            // Intentionally left empty
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask) {
+            SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(checkTask);
+            equationSystemPrepared = false;
+            rowStarts.clear();
+            columnIndices.clear();
+            matrixFunctionIndices.clear();
+            vectorFunctionIndices.clear();
+            evaluator = storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType>();
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::canHandleSpecifiedFormula() const {
+            if (!this->currentCheckTask) {
+                return false;
+            }
+            storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+            if (formula.isInFragment(storm::logic::reachability())) {
+                storm::logic::Formula const& subformula = formula.asOperatorFormula().getSubformula();
+                return subformula.isUntilFormula() || subformula.isEventuallyFormula();
+            }
+            if (formula.isInFragment(storm::logic::propositional().setRewardOperatorsAllowed(true).setReachabilityRewardFormulasAllowed(true).setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false))) {
+                return formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().getSubformula().isEventuallyFormula();
+            }
+            return false;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+            std::vector<storm::utility::parametric::Valuation<ParametricType>> valuations = {valuation};
+            return std::move(checkBatch(env, valuations).front());
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::prepareEquationSystem() {
+            storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(this->parametricModel);
+            uint64_t numberOfStates = this->parametricModel.getNumberOfStates();
+            std::vector<ParametricType> b;
+
+            rewardFormula = formula.isRewardOperatorFormula();
+            if (rewardFormula) {
+                storm::logic::EventuallyFormula const& eventuallyFormula = formula.asRewardOperatorFormula().getSubformula().asEventuallyFormula();
+                STORM_LOG_THROW(propositionalChecker.canHandle(eventuallyFormula.getSubformula()), storm::exceptions::NotSupportedException, "Batch instantiation checking with non-propositional subformulas is not supported.");
+                storm::storage::BitVector targetStates = std::move(propositionalChecker.check(eventuallyFormula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+
+                // The states from which the target is not reached almost surely get reward infinity.
+                statesWithValueInfinity = ~storm::utility::graph::performProb1(this->parametricModel.getBackwardTransitions(), storm::storage::BitVector(numberOfStates, true), targetStates);
+                statesWithValueOne = storm::storage::BitVector(numberOfStates, false);
+                maybeStates = ~(targetStates | statesWithValueInfinity);
+
+                STORM_LOG_THROW((this->currentCheckTask->isRewardModelSet() && this->parametricModel.hasRewardModel(this->currentCheckTask->getRewardModel())) || (!this->currentCheckTask->isRewardModelSet() && this->parametricModel.hasUniqueRewardModel()), storm::exceptions::InvalidPropertyException, "The reward model specified by the CheckTask is not available in the given model.");
+                typename SparseModelType::RewardModelType const& rewardModel = this->currentCheckTask->isRewardModelSet() ? this->parametricModel.getRewardModel(this->currentCheckTask->getRewardModel()) : this->parametricModel.getUniqueRewardModel();
+                b = storm::utility::vector::filterVector(rewardModel.getTotalRewardVector(this->parametricModel.getTransitionMatrix()), maybeStates);
+            } else {
+                storm::logic::Formula const& subformula = formula.asOperatorFormula().getSubformula();
+                storm::storage::BitVector phiStates(numberOfStates, true);
+                storm::storage::BitVector psiStates;
+                if (subformula.isUntilFormula()) {
+                    STORM_LOG_THROW(propositionalChecker.canHandle(subformula.asUntilFormula().getLeftSubformula()) && propositionalChecker.canHandle(subformula.asUntilFormula().getRightSubformula()), storm::exceptions::NotSupportedException, "Batch instantiation checking with non-propositional subformulas is not supported.");
+                    phiStates = std::move(propositionalChecker.check(subformula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                    psiStates = std::move(propositionalChecker.check(subformula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                } else {
+                    STORM_LOG_THROW(propositionalChecker.canHandle(subformula.asEventuallyFormula().getSubformula()), storm::exceptions::NotSupportedException, "Batch instantiation checking with non-propositional subformulas is not supported.");
+                    psiStates = std::move(propositionalChecker.check(subformula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                }
+
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(this->parametricModel.getBackwardTransitions(), phiStates, psiStates);
+                statesWithValueOne = std::move(statesWithProbability01.second);
+                statesWithValueInfinity = storm::storage::BitVector(numberOfStates, false);
+                maybeStates = ~(statesWithProbability01.first | statesWithValueOne);
+                b = this->parametricModel.getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithValueOne);
+            }
+
+            // Flatten the equation system such that the values only refer to the distinct functions.
+            storm::storage::SparseMatrix<ParametricType> submatrix = this->parametricModel.getTransitionMatrix().getSubmatrix(true, maybeStates, maybeStates);
+            rowStarts.reserve(submatrix.getRowCount() + 1);
+            columnIndices.reserve(submatrix.getEntryCount());
+            matrixFunctionIndices.reserve(submatrix.getEntryCount());
+            vectorFunctionIndices.reserve(b.size());
+            for (uint64_t row = 0; row < submatrix.getRowCount(); ++row) {
+                rowStarts.push_back(columnIndices.size());
+                for (auto const& entry : submatrix.getRow(row)) {
+                    columnIndices.push_back(entry.getColumn());
+                    matrixFunctionIndices.push_back(evaluator.addFunction(entry.getValue()));
+                }
+                vectorFunctionIndices.push_back(evaluator.addFunction(b[row]));
+            }
+            rowStarts.push_back(columnIndices.size());
+            evaluator.compile();
+
+            STORM_LOG_INFO("Batch instantiation checker uses an equation system with " << submatrix.getRowCount() << " rows, " << submatrix.getEntryCount() << " entries and " << evaluator.getNumberOfFunctions() << " distinct functions.");
+            equationSystemPrepared = true;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcBatchInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            STORM_LOG_THROW(canHandleSpecifiedFormula(), storm::exceptions::NotSupportedException, "The specified formula can not be handled by the batch instantiation checker.");
+            STORM_LOG_THROW(this->getInstantiationsAreGraphPreserving(), storm::exceptions::InvalidStateException, "Batch instantiation checking requires that all instantiations are graph preserving.");
+            STORM_LOG_THROW(env.solver().native().isMethodSetFromDefault() || env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power, storm::exceptions::NotSupportedException, "Batch instantiation checking only supports power iteration, but the method " << toString(env.solver().native().getMethod()) << " was selected.");
+
+            if (!equationSystemPrepared) {
+                prepareEquationSystem();
+            }
+
+            uint64_t const batchSize = valuations.size();
+            uint64_t const numberOfRows = vectorFunctionIndices.size();
+
+            // Evaluate every distinct function once per instantiation. The values for the different instantiations
+            // are stored next to each other, such that the innermost loops below run over contiguous memory.
+            uint64_t const numberOfFunctions = evaluator.getNumberOfFunctions();
+            std::vector<ConstantType> functionValues(numberOfFunctions * batchSize);
+            std::vector<ConstantType> laneFunctionValues;
+            for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                evaluator.evaluate(valuations[lane], laneFunctionValues);
+                for (uint64_t function = 0; function < numberOfFunctions; ++function) {
+                    functionValues[function * batchSize + lane] = laneFunctionValues[function];
+                }
+            }
+
+            // Solve the equation systems with power iteration, starting from zero.
+            std::vector<ConstantType> currentValues(numberOfRows * batchSize, storm::utility::zero<ConstantType>());
+            std::vector<ConstantType> newValues(numberOfRows * batchSize);
+            std::vector<ConstantType> rowValues(batchSize);
+            std::vector<bool> laneConverged(batchSize, numberOfRows == 0);
+            uint64_t numberOfConvergedLanes = numberOfRows == 0 ? batchSize : 0;
+
+            ConstantType const precision = storm::utility::convertNumber<ConstantType>(env.solver().native().getPrecision());
+            bool const relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+            uint64_t iterations = 0;
+            while (numberOfConvergedLanes < batchSize && iterations < maxIterations) {
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    ConstantType const* bValues = &functionValues[vectorFunctionIndices[row] * batchSize];
+                    for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                        rowValues[lane] = bValues[lane];
+                    }
+                    for (uint64_t entry = rowStarts[row]; entry < rowStarts[row + 1]; ++entry) {
+                        ConstantType const* entryValues = &functionValues[matrixFunctionIndices[entry] * batchSize];
+                        ConstantType const* columnValues = &currentValues[columnIndices[entry] * batchSize];
+                        for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                            rowValues[lane] += entryValues[lane] * columnValues[lane];
+                        }
+                    }
+                    ConstantType* target = &newValues[row * batchSize];
+                    for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                        target[lane] = rowValues[lane];
+                    }
+                }
+
+                // Check convergence for each instantiation separately. Converged instantiations keep their values, that
+                // is, the values computed in this iteration are discarded.
+                for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                    if (laneConverged[lane]) {
+                        for (uint64_t row = 0; row < numberOfRows; ++row) {
+                            newValues[row * batchSize + lane] = currentValues[row * batchSize + lane];
+                        }
+                        continue;
+                    }
+                    bool converged = true;
+                    for (uint64_t row = 0; row < numberOfRows; ++row) {
+                        ConstantType const& newValue = newValues[row * batchSize + lane];
+                        ConstantType difference = storm::utility::abs<ConstantType>(newValue - currentValues[row * batchSize + lane]);
+                        if (relative && !storm::utility::isZero(newValue)) {
+                            difference /= storm::utility::abs<ConstantType>(newValue);
+                        }
+                        if (difference > precision) {
+                            converged = false;
+                            break;
+                        }
+                    }
+                    if (converged) {
+                        laneConverged[lane] = true;
+                        ++numberOfConvergedLanes;
+                    }
+                }
+                std::swap(currentValues, newValues);
+                ++iterations;
+            }
+
+            if (numberOfConvergedLanes < batchSize) {
+                STORM_LOG_WARN("Batch instantiation checking did not converge for " << (batchSize - numberOfConvergedLanes) << " of " << batchSize << " instantiations within " << iterations << " iterations.");
+            } else {
+                STORM_LOG_TRACE("Batch instantiation checking converged after " << iterations << " iterations.");
+            }
+
+            // Build the results for the individual instantiations.
+            std::vector<std::unique_ptr<CheckResult>> results;
+            results.reserve(batchSize);
+            storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+            for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                std::vector<ConstantType> result(this->parametricModel.getNumberOfStates(), storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(result, statesWithValueOne, storm::utility::one<ConstantType>());
+                storm::utility::vector::setVectorValues(result, statesWithValueInfinity, storm::utility::infinity<ConstantType>());
+                uint64_t row = 0;
+                for (auto const& state : maybeStates) {
+                    result[state] = currentValues[row * batchSize + lane];
+                    ++row;
+                }
+
+                ExplicitQuantitativeCheckResult<ConstantType> quantitativeResult(std::move(result));
+                if (formula.asOperatorFormula().hasQuantitativeResult()) {
+                    results.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(quantitativeResult)));
+                } else {
+                    results.push_back(quantitativeResult.compareAgainstBound(formula.asOperatorFormula().getComparisonType(), formula.asOperatorFormula().template getThresholdAs<ConstantType>()));
+                }
+            }
+            return results;
+        }
+
+        template class SparseDtmcBatchInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
+
+    }
+}
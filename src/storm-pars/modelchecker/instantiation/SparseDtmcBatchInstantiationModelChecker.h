@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Class to check a reachability probability or reachability reward formula on a parametric DTMC for a batch of
+         * parameter instantiations at once. The equation system is set up only once (which requires that all
+         * instantiations are graph preserving). For a batch of K instantiations, each matrix entry then holds K values
+         * such that a single sweep over the matrix performs K matrix-vector multiplications. Convergence is checked
+         * for each instantiation separately.
+         */
+        template <typename SparseModelType, typename ConstantType>
+        class SparseDtmcBatchInstantiationModelChecker : public SparseInstantiationModelChecker<SparseModelType, ConstantType> {
+        public:
+            typedef typename SparseModelType::ValueType ParametricType;
+
+            SparseDtmcBatchInstantiationModelChecker(SparseModelType const& parametricModel);
+
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask) override;
+
+            /*!
+             * Retrieves whether the specified formula can be checked with this model checker.
+             */
+            bool canHandleSpecifiedFormula() const;
+
+            virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<ParametricType> const& valuation) override;
+
+            /*!
+             * Checks the specified formula for all given instantiations at once. The equation systems are solved with
+             * power iteration, other methods for the native solver are rejected.
+             *
+             * @param valuations The instantiations to consider.
+             * @return The results (in the order of the given instantiations).
+             */
+            std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+
+        private:
+            /*!
+             * Performs the graph analysis and sets up the parametric equation system for the specified formula.
+             */
+            void prepareEquationSystem();
+
+            // Whether the equation system for the specified formula has been set up.
+            bool equationSystemPrepared;
+
+            // Whether the specified formula is a reward formula.
+            bool rewardFormula;
+
+            // The states for which the equation system is solved.
+            storm::storage::BitVector maybeStates;
+
+            // The states with value one (for probabilities) or infinity (for rewards).
+            storm::storage::BitVector statesWithValueOne;
+            storm::storage::BitVector statesWithValueInfinity;
+
+            // The equation system x = Ax + b over the maybe states in a compressed row format, where the values are
+            // given as indices of the distinct functions in the evaluator.
+            std::vector<uint64_t> rowStarts;
+            std::vector<uint64_t> columnIndices;
+            std::vector<uint64_t> matrixFunctionIndices;
+            std::vector<uint64_t> vectorFunctionIndices;
+
+            // The distinct functions occurring in the equation system, compiled for the evaluation.
+            storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType> evaluator;
+        };
+    }
+}
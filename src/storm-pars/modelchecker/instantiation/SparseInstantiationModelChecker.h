@@ -21,7 +21,7 @@ namespace storm {
             SparseInstantiationModelChecker(SparseModelType const& parametricModel);
             virtual ~SparseInstantiationModelChecker() = default;
             
-            void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
             
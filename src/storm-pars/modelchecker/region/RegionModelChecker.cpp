@@ -1,5 +1,9 @@
 #include <sstream>
 #include <queue>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <exception>
 
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
@@ -7,6 +11,7 @@
 
 
 #include "storm/utility/vector.h"
+#include "storm/utility/constants.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -151,6 +156,187 @@ namespace storm {
                 auto regionCopyForResult = region;
                 return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
             }
+        
+            namespace detail {
+                template <typename ParametricType>
+                struct UnprocessedRegion {
+                    typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+                    
+                    UnprocessedRegion(storm::storage::ParameterRegion<ParametricType>&& region, RegionResult result, uint64_t depth) : region(std::move(region)), result(result), depth(depth), area(this->region.area()) {
+                        // Intentionally left empty
+                    }
+                    
+                    // Regions with a larger area are processed first.
+                    bool operator<(UnprocessedRegion const& other) const {
+                        return area < other.area || (area == other.area && depth > other.depth);
+                    }
+                    
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult result;
+                    uint64_t depth;
+                    CoefficientType area;
+                };
+                
+                /*!
+                 * Copies the given region such that the copy does not share any (reference counted) numbers with the original.
+                 * This way, the copy can be used by another thread.
+                 */
+                template <typename ParametricType>
+                storm::storage::ParameterRegion<ParametricType> copyRegionForThread(storm::storage::ParameterRegion<ParametricType> const& region) {
+                    typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+                    typename storm::storage::ParameterRegion<ParametricType>::Valuation lowerBoundaries, upperBoundaries;
+                    for (auto const& variable : region.getVariables()) {
+                        lowerBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getLowerBoundary(variable))));
+                        upperBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getUpperBoundary(variable))));
+                    }
+                    return storm::storage::ParameterRegion<ParametricType>(std::move(lowerBoundaries), std::move(upperBoundaries));
+                }
+            }
+        
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+                if (additionalCheckers.empty()) {
+                    return performRegionRefinement(env, region, coverageThreshold, depthThreshold, hypothesis);
+                }
+                STORM_LOG_INFO("Applying refinement with " << additionalCheckers.size() + 1 << " threads on region: " << region.toString(true) << " .");
+                
+                auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+                auto areaOfParameterSpace = region.area();
+                auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+                
+                // The resulting (sub-)regions
+                std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+                
+                // The regions that we still need to process (largest regions first).
+                std::priority_queue<detail::UnprocessedRegion<ParametricType>> unprocessedRegions;
+                unprocessedRegions.emplace(storm::storage::ParameterRegion<ParametricType>(region), RegionResult::Unknown, 0);
+                
+                // All data above (including the numbers within the regions) is only accessed while holding the mutex.
+                // The threads only analyze private copies of the regions without holding the mutex.
+                std::mutex mutex;
+                std::condition_variable condition;
+                uint64_t numberOfBusyThreads = 0;
+                bool finished = false;
+                std::exception_ptr exception;
+                
+                uint_fast64_t numOfAnalyzedRegions = 0;
+                bool showProgress = storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+                CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
+                if (showProgress) {
+                    STORM_PRINT_AND_LOG("Progress (solved fraction) :" << std::endl <<  "0% [");
+                    while (displayedProgress < storm::utility::one<CoefficientType>() - thresholdAsCoefficient) {
+                        STORM_PRINT_AND_LOG(" ");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                        STORM_PRINT_AND_LOG("-");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    STORM_PRINT_AND_LOG("] 100%" << std::endl << "   [");
+                    displayedProgress = storm::utility::zero<CoefficientType>();
+                }
+                
+                auto worker = [&] (RegionModelChecker<ParametricType>& checker) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        // Wait until there is a region to process or all threads are idle (i.e. no more regions will be added).
+                        condition.wait(lock, [&] { return finished || !unprocessedRegions.empty() || numberOfBusyThreads == 0; });
+                        if (finished || unprocessedRegions.empty() || fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                            finished = true;
+                            condition.notify_all();
+                            return;
+                        }
+                        
+                        detail::UnprocessedRegion<ParametricType> current = unprocessedRegions.top();
+                        unprocessedRegions.pop();
+                        storm::storage::ParameterRegion<ParametricType> regionForThread = detail::copyRegionForThread(current.region);
+                        ++numberOfBusyThreads;
+                        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << current.depth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        
+                        lock.unlock();
+                        RegionResult res = current.result;
+                        try {
+                            res = checker.analyzeRegion(env, regionForThread, hypothesis, res, false);
+                        } catch (...) {
+                            lock.lock();
+                            if (!exception) {
+                                exception = std::current_exception();
+                            }
+                            --numberOfBusyThreads;
+                            finished = true;
+                            condition.notify_all();
+                            return;
+                        }
+                        lock.lock();
+                        
+                        current.result = res;
+                        switch (res) {
+                            case RegionResult::AllSat:
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                                result.emplace_back(std::move(current.region), res);
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || current.depth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    current.region.split(current.region.getCenterPoint(), newRegions);
+                                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                             ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                              RegionResult::Unknown);
+                                    for (auto& newRegion : newRegions) {
+                                        unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions, current.depth + 1);
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.emplace_back(std::move(current.region), res);
+                                }
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
+                        --numberOfBusyThreads;
+                        if (showProgress) {
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                STORM_PRINT_AND_LOG("#");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            }
+                        }
+                        condition.notify_all();
+                    }
+                };
+                
+                std::vector<std::thread> threads;
+                for (auto const& checker : additionalCheckers) {
+                    threads.emplace_back(worker, std::ref(*checker));
+                }
+                worker(*this);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+                
+                // Add the still unprocessed regions to the result
+                while (!unprocessedRegions.empty()) {
+                    result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
+                    unprocessedRegions.pop();
+                }
+                
+                if (showProgress) {
+                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                        STORM_PRINT_AND_LOG("-");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    STORM_PRINT_AND_LOG("]" << std::endl);
+                    
+                    STORM_PRINT_AND_LOG("Region Refinement Statistics:" << std::endl);
+                    STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << threads.size() + 1 << " threads." << std::endl);
+                }
+                
+                auto regionCopyForResult = region;
+                return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+            }
 
         template <typename ParametricType>
         bool RegionModelChecker<ParametricType>::isRegionSplitEstimateSupported() const {
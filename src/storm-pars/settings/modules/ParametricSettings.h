@@ -64,6 +64,11 @@ namespace storm {
                  */
                 bool isSampleExactSet() const;
                 
+                /*!
+                 * Retrieves the number of (graph-preserving) samples that are to be checked together in one batch.
+                 */
+                uint64_t getSamplesBatchSize() const;
+                
                 const static std::string moduleName;
                 
             private:
@@ -75,6 +80,7 @@ namespace storm {
                 const static std::string samplesOptionName;
                 const static std::string samplesGraphPreservingOptionName;
                 const static std::string sampleExactOptionName;
+                const static std::string samplesBatchOptionName;
             };
             
         } // namespace modules
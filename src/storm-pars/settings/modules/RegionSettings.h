@@ -61,6 +61,11 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently analyze regions during refinement.
+                 */
+                uint64_t getRefinementThreadCount() const;
+                
 				/*!
 				 * Retrieves which type of region check should be performed
 				 */
@@ -84,6 +89,7 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementThreadsOptionName;
 				const static std::string checkEngineOptionName;
 				const static std::string printNoIllustrationOptionName;
 				const static std::string printFullResultOptionName;
@@ -133,6 +133,8 @@ namespace storm {
                 }
             }
             STORM_LOG_ASSERT(vectorAssignmentIt == vectorAssignment.end(), "Unexpected number of entries in the vector assignment.");
+            
+            functionValuationCollector.compileCollectedFunctions();
         }
     
         template<typename ParametricType, typename ConstantType>
@@ -278,26 +280,71 @@ namespace storm {
             AbstractValuation simplifiedValuation = valuation.getSubValuation(variablesInFunction);
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
-            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
-            return insertionRes.first->second;
+            CollectedFunction collectedFunction;
+            collectedFunction.function = evaluator.addFunction(simplifiedFunction);
+            collectedFunction.placeholder = storm::utility::one<ConstantType>();
+            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, CollectedFunction>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), std::move(collectedFunction)));
+            return insertionRes.first->second.placeholder;
         }
     
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            evaluator.compile();
+            
+            // Look up the indices of the variables of each valuation.
+            for (auto& collectedFunctionValuation : collectedFunctions) {
+                AbstractValuation const& abstrValuation = collectedFunctionValuation.first.second;
+                CollectedFunction& collectedFunction = collectedFunctionValuation.second;
+                collectedFunction.lowerVariables.clear();
+                collectedFunction.upperVariables.clear();
+                collectedFunction.unspecifiedVariables.clear();
+                for (auto const& var : abstrValuation.getLowerParameters()) {
+                    collectedFunction.lowerVariables.push_back(evaluator.getVariableIndex(var));
+                }
+                for (auto const& var : abstrValuation.getUpperParameters()) {
+                    collectedFunction.upperVariables.push_back(evaluator.getVariableIndex(var));
+                }
+                for (auto const& var : abstrValuation.getUnspecifiedParameters()) {
+                    collectedFunction.unspecifiedVariables.push_back(evaluator.getVariableIndex(var));
+                }
+            }
+        }
+        
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
-            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
-                ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
-                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-                ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
+            STORM_LOG_ASSERT(evaluator.isCompiled(), "The collected functions have not been compiled.");
+            
+            // Get the boundaries of the region for each variable
+            std::vector<CoefficientType> lowerValues, upperValues;
+            for (auto const& var : evaluator.getVariables()) {
+                lowerValues.push_back(region.getLowerBoundary(var));
+                upperValues.push_back(region.getUpperBoundary(var));
+            }
+            std::vector<CoefficientType> variableValues = lowerValues;
+            
+            for (auto& collectedFunctionValuation : collectedFunctions) {
+                CollectedFunction& collectedFunction = collectedFunctionValuation.second;
+                for (auto const& var : collectedFunction.lowerVariables) {
+                    variableValues[var] = lowerValues[var];
+                }
+                for (auto const& var : collectedFunction.upperVariables) {
+                    variableValues[var] = upperValues[var];
+                }
                 
-                auto concreteValuations = abstrValuation.getConcreteValuations(region);
-                auto concreteValuationIt = concreteValuations.begin();
-                placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                for(++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                    if(storm::solver::minimize(dirForUnspecifiedParameters)) {
-                        placeholder = std::min(placeholder, currentResult);
+                // Consider each vertex of the region w.r.t. the unspecified variables
+                uint64_t const numOfVertices = 1ull << collectedFunction.unspecifiedVariables.size();
+                for (uint64_t vertexId = 0; vertexId < numOfVertices; ++vertexId) {
+                    for (uint64_t variableIndex = 0; variableIndex < collectedFunction.unspecifiedVariables.size(); ++variableIndex) {
+                        uint64_t var = collectedFunction.unspecifiedVariables[variableIndex];
+                        variableValues[var] = ((vertexId >> variableIndex) % 2 == 0) ? lowerValues[var] : upperValues[var];
+                    }
+                    ConstantType currentResult = evaluator.evaluate(collectedFunction.function, variableValues, powerValues, monomialValues);
+                    if (vertexId == 0) {
+                        collectedFunction.placeholder = std::move(currentResult);
+                    } else if(storm::solver::minimize(dirForUnspecifiedParameters)) {
+                        collectedFunction.placeholder = std::min(collectedFunction.placeholder, currentResult);
                     } else {
-                        placeholder = std::max(placeholder, currentResult);
+                        collectedFunction.placeholder = std::max(collectedFunction.placeholder, currentResult);
                     }
                 }
             }
@@ -8,6 +8,7 @@
 
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/OptimizationDirection.h"
@@ -104,6 +105,11 @@ namespace storm {
                  */
                 ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
                 
+                /*!
+                 * Compiles the collected functions. Has to be called after all functions are added.
+                 */
+                void compileCollectedFunctions();
+                
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
@@ -119,8 +125,22 @@ namespace storm {
                         }
                 };
                 
-                // Stores the collected functions with the valuations together with a placeholder for the result.
-                std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                // Stores for a collected function and valuation the index of the function in the evaluator, the indices of the
+                // variables that are set to the lower, upper or an unspecified bound as well as a placeholder for the result.
+                struct CollectedFunction {
+                    uint64_t function;
+                    std::vector<uint64_t> lowerVariables, upperVariables, unspecifiedVariables;
+                    ConstantType placeholder;
+                };
+                
+                // Stores the collected functions with the valuations.
+                std::unordered_map<FunctionValuation, CollectedFunction, FuncValHash> collectedFunctions;
+                
+                // The collected functions compiled into an evaluation program.
+                storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType> evaluator;
+                
+                // Storage for the powers and monomials that is reused when evaluating the collected functions.
+                std::vector<CoefficientType> powerValues, monomialValues;
             };
             
             FunctionValuationCollector functionValuationCollector;
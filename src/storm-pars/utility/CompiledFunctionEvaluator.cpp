@@ -0,0 +1,266 @@
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            template<typename FunctionType, typename ConstantType>
+            const uint64_t CompiledFunctionEvaluator<FunctionType, ConstantType>::noMonomial = std::numeric_limits<uint64_t>::max();
+
+            template<typename FunctionType, typename ConstantType>
+            CompiledFunctionEvaluator<FunctionType, ConstantType>::CompiledFunctionEvaluator() : compiled(true) {
+                // Intentionally left empty
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            uint64_t CompiledFunctionEvaluator<FunctionType, ConstantType>::addFunction(FunctionType const& function) {
+                auto insertionRes = functionToIndexMap.insert(std::make_pair(function, functions.size()));
+                if (insertionRes.second) {
+                    functions.push_back(function);
+                    compiled = false;
+                }
+                return insertionRes.first->second;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            uint64_t CompiledFunctionEvaluator<FunctionType, ConstantType>::getNumberOfFunctions() const {
+                return functions.size();
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            bool CompiledFunctionEvaluator<FunctionType, ConstantType>::isCompiled() const {
+                return compiled;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            std::vector<typename CompiledFunctionEvaluator<FunctionType, ConstantType>::VariableType> const& CompiledFunctionEvaluator<FunctionType, ConstantType>::getVariables() const {
+                return variables;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            uint64_t CompiledFunctionEvaluator<FunctionType, ConstantType>::getVariableIndex(VariableType const& variable) const {
+                auto variableIt = variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIt != variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "The variable " << variable << " does not occur in the compiled functions.");
+                return variableIt->second;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            void CompiledFunctionEvaluator<FunctionType, ConstantType>::compile() {
+                variables.clear();
+                variableToIndexMap.clear();
+                maximalExponents.clear();
+                powerOffsets.clear();
+                monomialToIndexMap.clear();
+                monomialPrefixes.clear();
+                monomialPowers.clear();
+                monomialLastFactors.clear();
+                termCoefficients.clear();
+                termMonomials.clear();
+                numeratorStarts.clear();
+                denominatorStarts.clear();
+                functionVariableStarts.clear();
+                functionVariables.clear();
+                functionMonomialStarts.clear();
+                functionMonomials.clear();
+
+                for (auto const& function : functions) {
+                    numeratorStarts.push_back(termCoefficients.size());
+                    if (function.isConstant()) {
+                        termCoefficients.push_back(function.nominatorAsNumber() / function.denominatorAsNumber());
+                        termMonomials.push_back(noMonomial);
+                        denominatorStarts.push_back(termCoefficients.size());
+                    } else if (function.denominator().isConstant()) {
+                        // Constant denominators are folded into the coefficients of the numerator.
+                        CoefficientType factor = storm::utility::one<CoefficientType>() / function.denominator().polynomialWithCoefficient().constantPart();
+                        compilePolynomial(function.nominator().polynomialWithCoefficient(), factor);
+                        denominatorStarts.push_back(termCoefficients.size());
+                    } else {
+                        compilePolynomial(function.nominator().polynomialWithCoefficient(), storm::utility::one<CoefficientType>());
+                        denominatorStarts.push_back(termCoefficients.size());
+                        compilePolynomial(function.denominator().polynomialWithCoefficient(), storm::utility::one<CoefficientType>());
+                    }
+                }
+                numeratorStarts.push_back(termCoefficients.size());
+
+                // Now that the maximal exponents are known, we can fix the positions of the powers.
+                uint64_t numberOfPowers = 0;
+                for (auto const& exponent : maximalExponents) {
+                    powerOffsets.push_back(numberOfPowers);
+                    numberOfPowers += exponent;
+                }
+                monomialPowers.reserve(monomialLastFactors.size());
+                for (auto const& factor : monomialLastFactors) {
+                    monomialPowers.push_back(powerOffsets[factor.first] + factor.second - 1);
+                }
+
+                // Determine the variables and monomials each function depends on.
+                std::set<uint64_t> occurringVariables;
+                std::set<uint64_t> occurringMonomials;
+                for (uint64_t function = 0; function < functions.size(); ++function) {
+                    occurringVariables.clear();
+                    occurringMonomials.clear();
+                    for (uint64_t term = numeratorStarts[function]; term < numeratorStarts[function + 1]; ++term) {
+                        for (uint64_t monomial = termMonomials[term]; monomial != noMonomial && occurringMonomials.insert(monomial).second; monomial = monomialPrefixes[monomial]) {
+                            occurringVariables.insert(monomialLastFactors[monomial].first);
+                        }
+                    }
+                    functionVariableStarts.push_back(functionVariables.size());
+                    functionVariables.insert(functionVariables.end(), occurringVariables.begin(), occurringVariables.end());
+                    functionMonomialStarts.push_back(functionMonomials.size());
+                    functionMonomials.insert(functionMonomials.end(), occurringMonomials.begin(), occurringMonomials.end());
+                }
+                functionVariableStarts.push_back(functionVariables.size());
+                functionMonomialStarts.push_back(functionMonomials.size());
+
+                STORM_LOG_DEBUG("Compiled " << functions.size() << " functions over " << variables.size() << " variables into a program with " << numberOfPowers << " powers, " << monomialPrefixes.size() << " monomials and " << termCoefficients.size() << " terms.");
+                compiled = true;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            template<typename PolynomialType>
+            void CompiledFunctionEvaluator<FunctionType, ConstantType>::compilePolynomial(PolynomialType const& polynomial, CoefficientType const& factor) {
+                std::vector<std::pair<uint64_t, uint64_t>> monomialFactors;
+                for (auto const& term : polynomial) {
+                    termCoefficients.push_back(term.coeff() * factor);
+                    if (term.isConstant()) {
+                        termMonomials.push_back(noMonomial);
+                        continue;
+                    }
+
+                    monomialFactors.clear();
+                    for (auto const& variableExponentPair : *term.monomial()) {
+                        auto insertionRes = variableToIndexMap.insert(std::make_pair(variableExponentPair.first, variables.size()));
+                        if (insertionRes.second) {
+                            variables.push_back(variableExponentPair.first);
+                            maximalExponents.push_back(0);
+                        }
+                        uint64_t variableIndex = insertionRes.first->second;
+                        uint64_t exponent = variableExponentPair.second;
+                        maximalExponents[variableIndex] = std::max(maximalExponents[variableIndex], exponent);
+                        monomialFactors.emplace_back(variableIndex, exponent);
+                    }
+                    std::sort(monomialFactors.begin(), monomialFactors.end());
+                    termMonomials.push_back(getMonomialIndex(monomialFactors, monomialFactors.size()));
+                }
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            uint64_t CompiledFunctionEvaluator<FunctionType, ConstantType>::getMonomialIndex(std::vector<std::pair<uint64_t, uint64_t>> const& factors, uint64_t numberOfFactors) {
+                std::vector<std::pair<uint64_t, uint64_t>> monomial(factors.begin(), factors.begin() + numberOfFactors);
+                auto monomialIt = monomialToIndexMap.find(monomial);
+                if (monomialIt != monomialToIndexMap.end()) {
+                    return monomialIt->second;
+                }
+
+                uint64_t prefix = numberOfFactors > 1 ? getMonomialIndex(factors, numberOfFactors - 1) : noMonomial;
+                uint64_t index = monomialPrefixes.size();
+                monomialPrefixes.push_back(prefix);
+                monomialLastFactors.push_back(monomial.back());
+                monomialToIndexMap.emplace(std::move(monomial), index);
+                return index;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            void CompiledFunctionEvaluator<FunctionType, ConstantType>::computePowerValues(uint64_t variable, std::vector<CoefficientType> const& variableValues, std::vector<CoefficientType>& powerValues) const {
+                auto powerIt = powerValues.begin() + powerOffsets[variable];
+                *powerIt = variableValues[variable];
+                for (uint64_t exponent = 2; exponent <= maximalExponents[variable]; ++exponent, ++powerIt) {
+                    *(powerIt + 1) = *powerIt * variableValues[variable];
+                }
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            void CompiledFunctionEvaluator<FunctionType, ConstantType>::computeMonomialValue(uint64_t monomial, std::vector<CoefficientType> const& powerValues, std::vector<CoefficientType>& monomialValues) const {
+                if (monomialPrefixes[monomial] == noMonomial) {
+                    monomialValues[monomial] = powerValues[monomialPowers[monomial]];
+                } else {
+                    monomialValues[monomial] = monomialValues[monomialPrefixes[monomial]] * powerValues[monomialPowers[monomial]];
+                }
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            ConstantType CompiledFunctionEvaluator<FunctionType, ConstantType>::evaluateFunction(uint64_t function, std::vector<CoefficientType> const& monomialValues) const {
+                CoefficientType result = evaluateTerms(numeratorStarts[function], denominatorStarts[function], monomialValues);
+                if (denominatorStarts[function] != numeratorStarts[function + 1]) {
+                    result /= evaluateTerms(denominatorStarts[function], numeratorStarts[function + 1], monomialValues);
+                }
+                return storm::utility::convertNumber<ConstantType>(result);
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            typename CompiledFunctionEvaluator<FunctionType, ConstantType>::CoefficientType CompiledFunctionEvaluator<FunctionType, ConstantType>::evaluateTerms(uint64_t start, uint64_t end, std::vector<CoefficientType> const& monomialValues) const {
+                CoefficientType result = storm::utility::zero<CoefficientType>();
+                for (uint64_t term = start; term < end; ++term) {
+                    if (termMonomials[term] == noMonomial) {
+                        result += termCoefficients[term];
+                    } else {
+                        result += termCoefficients[term] * monomialValues[termMonomials[term]];
+                    }
+                }
+                return result;
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            void CompiledFunctionEvaluator<FunctionType, ConstantType>::evaluate(Valuation<FunctionType> const& valuation, std::vector<ConstantType>& result) const {
+                STORM_LOG_THROW(compiled, storm::exceptions::InvalidStateException, "Functions have to be compiled before they can be evaluated.");
+
+                std::vector<CoefficientType> variableValues;
+                variableValues.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    auto valuationIt = valuation.find(variable);
+                    STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to the variable " << variable << ".");
+                    variableValues.push_back(valuationIt->second);
+                }
+
+                // Compute the powers of each variable incrementally and then each monomial from its prefix.
+                std::vector<CoefficientType> powerValues(powerOffsets.empty() ? 0 : powerOffsets.back() + maximalExponents.back());
+                for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                    computePowerValues(variable, variableValues, powerValues);
+                }
+                std::vector<CoefficientType> monomialValues(monomialPrefixes.size());
+                for (uint64_t monomial = 0; monomial < monomialPrefixes.size(); ++monomial) {
+                    computeMonomialValue(monomial, powerValues, monomialValues);
+                }
+
+                result.resize(functions.size());
+                for (uint64_t function = 0; function < functions.size(); ++function) {
+                    result[function] = evaluateFunction(function, monomialValues);
+                }
+            }
+
+            template<typename FunctionType, typename ConstantType>
+            ConstantType CompiledFunctionEvaluator<FunctionType, ConstantType>::evaluate(uint64_t function, std::vector<CoefficientType> const& variableValues, std::vector<CoefficientType>& powerValues, std::vector<CoefficientType>& monomialValues) const {
+                STORM_LOG_THROW(compiled, storm::exceptions::InvalidStateException, "Functions have to be compiled before they can be evaluated.");
+                STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+
+                // Only the powers and monomials of the given function are computed. As the monomials are sorted, each
+                // prefix is computed before the monomials it belongs to.
+                powerValues.resize(powerOffsets.empty() ? 0 : powerOffsets.back() + maximalExponents.back());
+                monomialValues.resize(monomialPrefixes.size());
+                for (uint64_t index = functionVariableStarts[function]; index < functionVariableStarts[function + 1]; ++index) {
+                    computePowerValues(functionVariables[index], variableValues, powerValues);
+                }
+                for (uint64_t index = functionMonomialStarts[function]; index < functionMonomialStarts[function + 1]; ++index) {
+                    computeMonomialValue(functionMonomials[index], powerValues, monomialValues);
+                }
+                return evaluateFunction(function, monomialValues);
+            }
+
+#ifdef STORM_HAVE_CARL
+            template class CompiledFunctionEvaluator<storm::RationalFunction, double>;
+            template class CompiledFunctionEvaluator<storm::RationalFunction, storm::RationalNumber>;
+#endif
+        }
+    }
+}
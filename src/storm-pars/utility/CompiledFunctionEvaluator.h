@@ -0,0 +1,166 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * Evaluates a fixed set of functions for many different valuations.
+             * All added functions are compiled once into a flat evaluation program over the numbers of the given
+             * constant type: The powers of each variable are computed incrementally, each distinct monomial is
+             * computed with a single multiplication from a shared monomial prefix and a variable power, and the
+             * numerator and denominator of each function are sums of coefficients times monomials.
+             * Evaluating a function then no longer requires substitution in the underlying function representation.
+             * The program is evaluated exactly over the coefficient type of the functions and only the final values are
+             * converted to the constant type, so the results coincide with evaluating the functions and converting them.
+             */
+            template<typename FunctionType, typename ConstantType>
+            class CompiledFunctionEvaluator {
+            public:
+                typedef typename VariableType<FunctionType>::type VariableType;
+                typedef typename CoefficientType<FunctionType>::type CoefficientType;
+
+                CompiledFunctionEvaluator();
+
+                /*!
+                 * Adds the given function (if it was not added before). Adding functions invalidates the program.
+                 *
+                 * @return The index of the function.
+                 */
+                uint64_t addFunction(FunctionType const& function);
+
+                /*!
+                 * Retrieves the number of (distinct) added functions.
+                 */
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Compiles the added functions into the evaluation program.
+                 */
+                void compile();
+
+                /*!
+                 * Retrieves whether the program is compiled and covers all added functions.
+                 */
+                bool isCompiled() const;
+
+                /*!
+                 * Retrieves the variables occurring in the added functions. Values of variables are passed to the
+                 * evaluation methods in this order.
+                 */
+                std::vector<VariableType> const& getVariables() const;
+
+                /*!
+                 * Retrieves the index of the given variable in the vector of occurring variables.
+                 */
+                uint64_t getVariableIndex(VariableType const& variable) const;
+
+                /*!
+                 * Evaluates all added functions.
+                 *
+                 * @param valuation A valuation that assigns a value to all occurring variables.
+                 * @param result The values of the functions (in the order of their indices) are written to this vector.
+                 */
+                void evaluate(Valuation<FunctionType> const& valuation, std::vector<ConstantType>& result) const;
+
+                /*!
+                 * Evaluates the function with the given index. Only the powers and monomials occurring in the function
+                 * are computed.
+                 *
+                 * @param variableValues The values of the variables (in the order given by getVariables()). Only the
+                 * values of variables occurring in the function are considered.
+                 * @param powerValues Storage for the powers of the variables that can be reused across calls.
+                 * @param monomialValues Storage for the values of the monomials that can be reused across calls.
+                 */
+                ConstantType evaluate(uint64_t function, std::vector<CoefficientType> const& variableValues, std::vector<CoefficientType>& powerValues, std::vector<CoefficientType>& monomialValues) const;
+
+            private:
+                /*!
+                 * Adds the terms of the given polynomial to the program, where all coefficients are multiplied by the
+                 * given factor.
+                 */
+                template<typename PolynomialType>
+                void compilePolynomial(PolynomialType const& polynomial, CoefficientType const& factor);
+
+                /*!
+                 * Retrieves the index of the monomial with the given (sorted) factors, where each factor is given by
+                 * the index of a variable and an exponent. Missing prefixes of the monomial are added as well.
+                 */
+                uint64_t getMonomialIndex(std::vector<std::pair<uint64_t, uint64_t>> const& factors, uint64_t numberOfFactors);
+
+                /*!
+                 * Computes the powers of the given variable for the given values of the variables.
+                 */
+                void computePowerValues(uint64_t variable, std::vector<CoefficientType> const& variableValues, std::vector<CoefficientType>& powerValues) const;
+
+                /*!
+                 * Computes the value of the given monomial, assuming that the value of its prefix and the power of its
+                 * last variable are already computed.
+                 */
+                void computeMonomialValue(uint64_t monomial, std::vector<CoefficientType> const& powerValues, std::vector<CoefficientType>& monomialValues) const;
+
+                /*!
+                 * Computes the value of the function with the given index, assuming that the values of its monomials are
+                 * already computed.
+                 */
+                ConstantType evaluateFunction(uint64_t function, std::vector<CoefficientType> const& monomialValues) const;
+
+                /*!
+                 * Computes the value of the polynomial given by the terms in the given range.
+                 */
+                CoefficientType evaluateTerms(uint64_t start, uint64_t end, std::vector<CoefficientType> const& monomialValues) const;
+
+                // The distinct functions.
+                std::vector<FunctionType> functions;
+                std::unordered_map<FunctionType, uint64_t> functionToIndexMap;
+
+                // Whether the program covers all functions.
+                bool compiled;
+
+                // The occurring variables and the largest exponent with which they occur.
+                std::vector<VariableType> variables;
+                std::map<VariableType, uint64_t> variableToIndexMap;
+                std::vector<uint64_t> maximalExponents;
+
+                // For each variable, the index of its first power (i.e. the variable itself) in the vector of powers.
+                std::vector<uint64_t> powerOffsets;
+
+                // Each monomial is given by the index of its prefix (or noMonomial) and the index of its last power.
+                // Prefixes always precede the monomials they belong to.
+                std::map<std::vector<std::pair<uint64_t, uint64_t>>, uint64_t> monomialToIndexMap;
+                std::vector<uint64_t> monomialPrefixes;
+                std::vector<uint64_t> monomialPowers;
+                std::vector<std::pair<uint64_t, uint64_t>> monomialLastFactors;
+
+                // The terms of all numerators and denominators. Each term is given by its coefficient and the index of
+                // its monomial (or noMonomial for constant terms).
+                std::vector<CoefficientType> termCoefficients;
+                std::vector<uint64_t> termMonomials;
+
+                // For function i, the terms of the numerator are in [numeratorStarts[i], denominatorStarts[i]) and the
+                // terms of the denominator are in [denominatorStarts[i], numeratorStarts[i+1]). An empty denominator
+                // represents the constant one.
+                std::vector<uint64_t> numeratorStarts;
+                std::vector<uint64_t> denominatorStarts;
+
+                // For function i, the occurring variables are in [functionVariableStarts[i], functionVariableStarts[i+1])
+                // of functionVariables and the occurring monomials (including all prefixes, in ascending order) are in
+                // [functionMonomialStarts[i], functionMonomialStarts[i+1]) of functionMonomials.
+                std::vector<uint64_t> functionVariableStarts;
+                std::vector<uint64_t> functionVariables;
+                std::vector<uint64_t> functionMonomialStarts;
+                std::vector<uint64_t> functionMonomials;
+
+                static const uint64_t noMonomial;
+            };
+
+        }
+    }
+}
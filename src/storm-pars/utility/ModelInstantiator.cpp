@@ -21,6 +21,8 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+                
+                this->functions.compile();
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
@@ -86,10 +88,9 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType>& functions,
+                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint64_t>>& mapping,
                                              storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const{
-                ConstantType dummyValue = storm::utility::one<ConstantType>();
                 auto constantEntryIt = constantMatrix.begin();
                 auto parametricEntryIt = parametricMatrix.begin();
                 while(parametricEntryIt != parametricMatrix.end()){
@@ -99,9 +100,7 @@ namespace storm {
                         constantEntryIt->setValue(storm::utility::convertNumber<ConstantType>(parametricEntryIt->getValue()));
                     } else {
                         //insert the new function and store that the current constantMatrix entry needs to be set to the value of this function
-                        auto functionsIt = functions.insert(std::make_pair(parametricEntryIt->getValue(), dummyValue)).first;
-                        mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-                        //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+                        mapping.emplace_back(constantEntryIt, functions.addFunction(parametricEntryIt->getValue()));
                     }
                     ++constantEntryIt;
                     ++parametricEntryIt;
@@ -112,10 +111,9 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeVectorMapping(std::vector<ConstantType>& constantVector,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType>& functions,
+                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint64_t>>& mapping,
                                              std::vector<ParametricType> const& parametricVector) const{
-                ConstantType dummyValue = storm::utility::one<ConstantType>();
                 auto constantEntryIt = constantVector.begin();
                 auto parametricEntryIt = parametricVector.begin();
                 while(parametricEntryIt != parametricVector.end()){
@@ -124,9 +122,7 @@ namespace storm {
                         *constantEntryIt = storm::utility::convertNumber<ConstantType>(*parametricEntryIt);
                     } else {
                         //insert the new function and store that the current constantVector entry needs to be set to the value of this function
-                        auto functionsIt = functions.insert(std::make_pair(*parametricEntryIt, dummyValue)).first;
-                        mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-                        //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+                        mapping.emplace_back(constantEntryIt, functions.addFunction(*parametricEntryIt));
                     }
                     ++constantEntryIt;
                     ++parametricEntryIt;
@@ -136,18 +132,15 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
-                //Write results into the placeholders
-                for(auto& functionResult : this->functions){
-                    functionResult.second=storm::utility::convertNumber<ConstantType>(
-                            storm::utility::parametric::evaluate(functionResult.first, valuation));
-                }
+                //Evaluate all occurring functions at once
+                this->functions.evaluate(valuation, this->functionValues);
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
-                    entryValuePair.first->setValue(*(entryValuePair.second));
+                    entryValuePair.first->setValue(this->functionValues[entryValuePair.second]);
                 }
                 for(auto& entryValuePair : this->vectorMapping){
-                    *(entryValuePair.first)=*(entryValuePair.second);
+                    *(entryValuePair.first)=this->functionValues[entryValuePair.second];
                 }
                 
                 return *this->instantiatedModel;
@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -21,6 +22,9 @@ namespace storm {
          * This class allows efficient instantiation of the given parametric model.
          * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
          * instead of evaluating the same function for each occurrence in the model. 
+         * Moreover, the distinct functions are compiled once into an evaluation program that evaluates all of them
+         * exactly and without substitution in the underlying function representation.
+         * The evaluation is sequential as the exact number types can not be shared between threads.
          */
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             class ModelInstantiator {
@@ -135,13 +139,13 @@ namespace storm {
                  * @note constantMatrix and parametricMatrix should have entries at the same positions
                  * 
                  * @param constantMatrix The matrix to which the evaluation results are written
-                 * @param functions Occurring functions are inserted in this map
-                 * @param mapping The connections of functions to matrix entries are push_backed  into this
+                 * @param functions Occurring functions are added to this evaluator
+                 * @param mapping The connections of function indices to matrix entries are push_backed  into this
                  * @param parametricMatrix the source matrix with the functions to consider.
                  */
                 void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType>& functions,
+                                             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint64_t>>& mapping,
                                              storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const;
                 
                 /*!
@@ -150,23 +154,25 @@ namespace storm {
                  * @note constantVector and parametricVector should have the same size
                  * 
                  * @param constantVector The vector to which the evaluation results are written
-                 * @param functions Occurring functions with their placeholders are inserted in this map
-                 * @param mapping The connections of functions to vector entries are push_backed  into this
+                 * @param functions Occurring functions are added to this evaluator
+                 * @param mapping The connections of function indices to vector entries are push_backed  into this
                  * @param parametricVector the source vector with the functions to consider.
                  */
                 void initializeVectorMapping(std::vector<ConstantType>& constantVector,
-                                             std::unordered_map<ParametricType, ConstantType>& functions,
-                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
+                                             storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType>& functions,
+                                             std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint64_t>>& mapping,
                                              std::vector<ParametricType> const& parametricVector) const;
                 
                 /// The resulting model
                 std::shared_ptr<ConstantSparseModelType> instantiatedModel;
-                /// the occurring functions together with the corresponding placeholders for their evaluated result
-                std::unordered_map<ParametricType, ConstantType> functions; 
-                /// Connection of matrix entries with placeholders
-                std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
-                /// Connection of Vector entries with placeholders
-                std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// the occurring functions compiled into an evaluation program
+                storm::utility::parametric::CompiledFunctionEvaluator<ParametricType, ConstantType> functions;
+                /// the evaluated results of the occurring functions
+                std::vector<ConstantType> functionValues;
+                /// Connection of matrix entries with function indices
+                std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, uint64_t>> matrixMapping; 
+                /// Connection of Vector entries with function indices
+                std::vector<std::pair<typename std::vector<ConstantType>::iterator, uint64_t>> vectorMapping; 
                 
                 
             };
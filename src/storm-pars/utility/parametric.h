@@ -31,7 +31,9 @@ namespace storm {
             template<typename FunctionType> using Valuation = std::map<typename VariableType<FunctionType>::type, typename CoefficientType<FunctionType>::type>;
 
             /*!
-             * Evaluates the given function wrt. the given valuation
+             * Evaluates the given function wrt. the given valuation.
+             * As the caches of the underlying function representation are not thread-safe, concurrent workers have to
+             * evaluate functions via their own CompiledFunctionEvaluator instead.
              */
             template<typename FunctionType>
             typename CoefficientType<FunctionType>::type evaluate(FunctionType const& function, Valuation<FunctionType> const& valuation);
@@ -0,0 +1,58 @@
+#include "storm/abstraction/EnumeratedSolutions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidAccessException.h"
+
+namespace storm {
+    namespace abstraction {
+        
+        EnumeratedSolutions::EnumeratedSolutions(storm::expressions::ExpressionManager const& manager, std::vector<storm::expressions::Variable> const& variables) : manager(manager), variables(variables) {
+            for (uint_fast64_t position = 0; position < variables.size(); ++position) {
+                variableToPosition.emplace(variables[position], position);
+            }
+        }
+        
+        void EnumeratedSolutions::add(storm::solver::SmtSolver::ModelReference const& model) {
+            storm::storage::BitVector solution(variables.size());
+            for (uint_fast64_t position = 0; position < variables.size(); ++position) {
+                solution.set(position, model.getBooleanValue(variables[position]));
+            }
+            solutions.push_back(std::move(solution));
+        }
+        
+        uint_fast64_t EnumeratedSolutions::forEach(std::function<bool(storm::solver::SmtSolver::ModelReference&)> const& callback) const {
+            uint_fast64_t numberOfSolutions = 0;
+            for (auto const& solution : solutions) {
+                SolutionReference reference(manager, variableToPosition, solution);
+                ++numberOfSolutions;
+                if (!callback(reference)) {
+                    break;
+                }
+            }
+            return numberOfSolutions;
+        }
+        
+        uint_fast64_t EnumeratedSolutions::size() const {
+            return solutions.size();
+        }
+        
+        EnumeratedSolutions::SolutionReference::SolutionReference(storm::expressions::ExpressionManager const& manager, std::unordered_map<storm::expressions::Variable, uint_fast64_t> const& variableToPosition, storm::storage::BitVector const& solution) : storm::solver::SmtSolver::ModelReference(manager), variableToPosition(variableToPosition), solution(solution) {
+            // Intentionally left empty.
+        }
+        
+        bool EnumeratedSolutions::SolutionReference::getBooleanValue(storm::expressions::Variable const& variable) const {
+            auto positionIt = variableToPosition.find(variable);
+            STORM_LOG_THROW(positionIt != variableToPosition.end(), storm::exceptions::InvalidAccessException, "The value of variable '" << variable.getName() << "' was not stored.");
+            return solution.get(positionIt->second);
+        }
+        
+        int_fast64_t EnumeratedSolutions::SolutionReference::getIntegerValue(storm::expressions::Variable const&) const {
+            STORM_LOG_THROW(false, storm::exceptions::InvalidAccessException, "Only values of Boolean variables are stored.");
+        }
+        
+        double EnumeratedSolutions::SolutionReference::getRationalValue(storm::expressions::Variable const&) const {
+            STORM_LOG_THROW(false, storm::exceptions::InvalidAccessException, "Only values of Boolean variables are stored.");
+        }
+        
+    }
+}
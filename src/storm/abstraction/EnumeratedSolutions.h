@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/solver/SmtSolver.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace abstraction {
+        
+        /*!
+         * Stores the values that solutions of an SMT problem assign to a fixed set of Boolean variables. This allows
+         * to enumerate the solutions in advance (for example on another thread) and to process them later in the same
+         * way as the models reported by an AllSat call.
+         */
+        class EnumeratedSolutions {
+        public:
+            /*!
+             * Creates an empty set of solutions over the given variables.
+             *
+             * @param manager The manager responsible for the variables.
+             * @param variables The Boolean variables whose values are stored.
+             */
+            EnumeratedSolutions(storm::expressions::ExpressionManager const& manager, std::vector<storm::expressions::Variable> const& variables);
+            
+            /*!
+             * Adds the values of the given model as a new solution.
+             *
+             * @param model The model to add.
+             */
+            void add(storm::solver::SmtSolver::ModelReference const& model);
+            
+            /*!
+             * Calls the given callback for every stored solution (in the order of insertion) until it returns false.
+             *
+             * @param callback The callback to call for each solution. Only the values of the stored variables may be
+             * requested from the model reference.
+             * @return The number of solutions for which the callback was called.
+             */
+            uint_fast64_t forEach(std::function<bool(storm::solver::SmtSolver::ModelReference&)> const& callback) const;
+            
+            /*!
+             * Retrieves the number of stored solutions.
+             *
+             * @return The number of solutions.
+             */
+            uint_fast64_t size() const;
+            
+        private:
+            class SolutionReference : public storm::solver::SmtSolver::ModelReference {
+            public:
+                SolutionReference(storm::expressions::ExpressionManager const& manager, std::unordered_map<storm::expressions::Variable, uint_fast64_t> const& variableToPosition, storm::storage::BitVector const& solution);
+                
+                virtual bool getBooleanValue(storm::expressions::Variable const& variable) const override;
+                virtual int_fast64_t getIntegerValue(storm::expressions::Variable const& variable) const override;
+                virtual double getRationalValue(storm::expressions::Variable const& variable) const override;
+                
+            private:
+                // The position of each stored variable in the solutions.
+                std::unordered_map<storm::expressions::Variable, uint_fast64_t> const& variableToPosition;
+                
+                // The solution that is referenced.
+                storm::storage::BitVector const& solution;
+            };
+            
+            // The manager responsible for the variables.
+            std::reference_wrapper<storm::expressions::ExpressionManager const> manager;
+            
+            // The variables whose values are stored.
+            std::vector<storm::expressions::Variable> variables;
+            
+            // The position of each stored variable in the solutions.
+            std::unordered_map<storm::expressions::Variable, uint_fast64_t> variableToPosition;
+            
+            // The stored solutions.
+            std::vector<storm::storage::BitVector> solutions;
+        };
+        
+    }
+}
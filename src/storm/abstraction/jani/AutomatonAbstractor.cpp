@@ -1,5 +1,7 @@
 #include "storm/abstraction/jani/AutomatonAbstractor.h"
 
+#include <numeric>
+
 #include "storm/abstraction/BottomStateResult.h"
 #include "storm/abstraction/GameBddResult.h"
 #include "storm/abstraction/AbstractionInformation.h"
@@ -16,6 +18,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace abstraction {
@@ -24,7 +27,7 @@ namespace storm {
             using storm::settings::modules::AbstractionSettings;
             
             template <storm::dd::DdType DdType, typename ValueType>
-            AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton) {
+            AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton), numberOfThreads(storm::settings::getModule<AbstractionSettings>().getNumberOfThreads()) {
                 
                 // For each concrete command, we create an abstract counterpart.
                 uint64_t edgeId = 0;
@@ -58,6 +61,12 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
+                // If requested, the (expensive) enumeration of the SMT solutions is performed concurrently, such that only
+                // the construction of the BDDs, which needs the DD manager, remains sequential.
+                if (numberOfThreads > 1 && edges.size() > 1) {
+                    enumerateSolutionsConcurrently();
+                }
+                
                 // First, we retrieve the abstractions of all commands.
                 std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -75,6 +84,16 @@ namespace storm {
                 return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void AutomatonAbstractor<DdType, ValueType>::enumerateSolutionsConcurrently() {
+                // Every edge owns its SMT solver, so the threads can take edges independently of each other.
+                std::vector<uint64_t> edgeIndices(edges.size());
+                std::iota(edgeIndices.begin(), edgeIndices.end(), 0);
+                storm::utility::parallel::forEachConcurrently(edgeIndices, numberOfThreads, [this] (uint64_t edgeIndex) {
+                    edges[edgeIndex].enumerateSolutions();
+                });
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             BottomStateResult<DdType> AutomatonAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates, uint_fast64_t numberOfPlayer2Variables) {
                 BottomStateResult<DdType> result(this->getAbstractionInformation().getDdManager().getBddZero(), this->getAbstractionInformation().getDdManager().getBddZero());
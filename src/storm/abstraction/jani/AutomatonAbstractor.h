@@ -120,6 +120,11 @@ namespace storm {
                  */
                 AbstractionInformation<DdType> const& getAbstractionInformation() const;
                 
+                /*!
+                 * Enumerates the solutions of the edges that need to be recomputed using multiple threads.
+                 */
+                void enumerateSolutionsConcurrently();
+                
                 // A factory that can be used to create new SMT solvers.
                 std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
                 
@@ -132,6 +137,9 @@ namespace storm {
                 // The concrete module this abstract automaton refers to.
                 std::reference_wrapper<storm::jani::Automaton const> automaton;
                 
+                // The number of threads used to enumerate the solutions of the edges.
+                uint64_t numberOfThreads;
+                
                 // If the automaton has more than one location, we need variables to encode that.
                 boost::optional<std::pair<storm::expressions::Variable, storm::expressions::Variable>> locationVariables;
             };
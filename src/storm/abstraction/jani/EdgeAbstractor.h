@@ -5,9 +5,12 @@
 #include <set>
 #include <map>
 
+#include <boost/optional.hpp>
+
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
 #include "storm/abstraction/GameBddResult.h"
+#include "storm/abstraction/EnumeratedSolutions.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
@@ -86,6 +89,13 @@ namespace storm {
                  */
                 GameBddResult<DdType> abstract();
                 
+                /*!
+                 * Enumerates the solutions of the SMT problem of the edge if the abstraction needs to be recomputed
+                 * (and the decomposition is not used), such that a subsequent call to abstract only needs to build the
+                 * BDD. As this only uses the SMT solver of this edge, it may be called concurrently for different edges.
+                 */
+                void enumerateSolutions();
+                
                 /*!
                  * Retrieves the transitions to bottom states of this edge.
                  *
@@ -161,6 +171,13 @@ namespace storm {
                  */
                 storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
                 
+                /*!
+                 * Enumerates all solutions of the SMT problem wrt. the decision variables and stores their values.
+                 *
+                 * @return The solutions.
+                 */
+                EnumeratedSolutions computeSolutions();
+                
                 /*!
                  * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
                  */
@@ -254,6 +271,9 @@ namespace storm {
                 // A flag remembering whether we need to force recomputation of the BDD.
                 bool forceRecomputation;
                 
+                // The solutions that were enumerated in advance (if any) and are to be used by the next recomputation.
+                boost::optional<EnumeratedSolutions> enumeratedSolutions;
+                
                 // The abstract guard of the edge. This is only used if the guard is not a predicate, because it can
                 // then be used to constrain the bottom state abstractor.
                 storm::dd::Bdd<DdType> abstractGuard;
@@ -374,12 +374,19 @@ namespace storm {
                 
                 // Create a mapping from source state DDs to their distributions.
                 std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                uint64_t numberOfSolutions = 0;
-                smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
+                auto addSolution = [&sourceToDistributionsMap,this] (storm::solver::SmtSolver::ModelReference const& model) {
                     sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(getDistributionBdd(model, relevantPredicatesAndVariables.second));
-                    ++numberOfSolutions;
                     return true;
-                });
+                };
+                
+                // Use the solutions that were enumerated in advance if there are any and enumerate them now otherwise.
+                uint64_t numberOfSolutions;
+                if (enumeratedSolutions) {
+                    numberOfSolutions = enumeratedSolutions.get().forEach(addSolution);
+                    enumeratedSolutions = boost::none;
+                } else {
+                    numberOfSolutions = smtSolver->allSat(decisionVariables, addSolution);
+                }
                 
                 // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                 // need to encode the nondeterminism.
@@ -513,6 +520,23 @@ namespace storm {
                 }
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutions() {
+                if (forceRecomputation && !useDecomposition) {
+                    enumeratedSolutions = computeSolutions();
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            EnumeratedSolutions CommandAbstractor<DdType, ValueType>::computeSolutions() {
+                EnumeratedSolutions solutions(this->getAbstractionInformation().getExpressionManager(), decisionVariables);
+                smtSolver->allSat(decisionVariables, [&solutions] (storm::solver::SmtSolver::ModelReference const& model) {
+                    solutions.add(model);
+                    return true;
+                });
+                return solutions;
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
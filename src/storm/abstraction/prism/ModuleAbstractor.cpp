@@ -1,5 +1,7 @@
 #include "storm/abstraction/prism/ModuleAbstractor.h"
 
+#include <numeric>
+
 #include "storm/abstraction/AbstractionInformation.h"
 #include "storm/abstraction/BottomStateResult.h"
 #include "storm/abstraction/GameBddResult.h"
@@ -15,6 +17,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace abstraction {
@@ -23,7 +26,7 @@ namespace storm {
             using storm::settings::modules::AbstractionSettings;
             
             template <storm::dd::DdType DdType, typename ValueType>
-            ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module) {
+            ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module), numberOfThreads(storm::settings::getModule<AbstractionSettings>().getNumberOfThreads()) {
                 
                 // For each concrete command, we create an abstract counterpart.
                 for (auto const& command : module.getCommands()) {
@@ -52,6 +55,12 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+                // If requested, the (expensive) enumeration of the SMT solutions is performed concurrently, such that only
+                // the construction of the BDDs, which needs the DD manager, remains sequential.
+                if (numberOfThreads > 1 && commands.size() > 1) {
+                    enumerateSolutionsConcurrently();
+                }
+                
                 // First, we retrieve the abstractions of all commands.
                 std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -69,6 +78,16 @@ namespace storm {
                 return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void ModuleAbstractor<DdType, ValueType>::enumerateSolutionsConcurrently() {
+                // Every command owns its SMT solver, so the threads can take commands independently of each other.
+                std::vector<uint64_t> commandIndices(commands.size());
+                std::iota(commandIndices.begin(), commandIndices.end(), 0);
+                storm::utility::parallel::forEachConcurrently(commandIndices, numberOfThreads, [this] (uint64_t commandIndex) {
+                    commands[commandIndex].enumerateSolutions();
+                });
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             BottomStateResult<DdType> ModuleAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates, uint_fast64_t numberOfPlayer2Variables) {
                 BottomStateResult<DdType> result(this->getAbstractionInformation().getDdManager().getBddZero(), this->getAbstractionInformation().getDdManager().getBddZero());
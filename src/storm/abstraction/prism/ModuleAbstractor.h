@@ -111,6 +111,11 @@ namespace storm {
                  */
                 AbstractionInformation<DdType> const& getAbstractionInformation() const;
                 
+                /*!
+                 * Enumerates the solutions of the commands that need to be recomputed using multiple threads.
+                 */
+                void enumerateSolutionsConcurrently();
+                
                 // A factory that can be used to create new SMT solvers.
                 std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
                 
@@ -122,6 +127,9 @@ namespace storm {
                 
                 // The concrete module this abstract module refers to.
                 std::reference_wrapper<storm::prism::Module const> module;
+                
+                // The number of threads used to enumerate the solutions of the commands.
+                uint64_t numberOfThreads;
             };
         }
     }
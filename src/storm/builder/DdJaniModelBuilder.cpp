@@ -1,5 +1,6 @@
 #include "storm/builder/DdJaniModelBuilder.h"
 
+#include <numeric>
 #include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
@@ -17,6 +18,7 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 #include "storm/adapters/AddExpressionAdapter.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -29,6 +31,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
@@ -46,18 +49,18 @@ namespace storm {
     namespace builder {
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -261,7 +264,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, DdVariableOrdering const& variableOrdering) : model(model), automata(), actionInformation(actionInformation), variableOrdering(variableOrdering) {
                 // Intentionally left empty.
             }
             
@@ -327,12 +330,16 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Create the meta variables for all locations and non-transient variables in the order given by the
+                // selected heuristic.
+                createStateMetaVariables(result);
+                
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
                     
                     // Start by creating a meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = stateVariableToMetaVariablesMap.at(locationExpressionVariable);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
                     result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -397,6 +404,130 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Creates the meta variables for the locations of the automata and all non-transient variables in the
+             * order determined by the selected variable ordering heuristic. Note that the row and column variables of
+             * every location or variable are interleaved.
+             */
+            void createStateMetaVariables(CompositionVariables<Type, ValueType>& result) {
+                // Collect the locations and variables in the order in which they were created originally.
+                // Boolean variables have no bounds.
+                std::vector<storm::expressions::Variable> stateVariables;
+                std::vector<std::string> stateVariableNames;
+                std::vector<boost::optional<std::pair<int_fast64_t, int_fast64_t>>> stateVariableBounds;
+                for (auto const& automatonName : this->automata) {
+                    storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                    stateVariables.push_back(automaton.getLocationExpressionVariable());
+                    stateVariableNames.push_back("l_" + automaton.getName());
+                    stateVariableBounds.push_back(std::pair<int_fast64_t, int_fast64_t>(0, automaton.getNumberOfLocations() - 1));
+                }
+                auto addVariables = [&] (storm::jani::VariableSet const& variables) {
+                    for (auto const& variable : variables) {
+                        if (variable.isTransient()) {
+                            continue;
+                        }
+                        stateVariables.push_back(variable.getExpressionVariable());
+                        stateVariableNames.push_back(variable.getExpressionVariable().getName());
+                        if (variable.isBoundedIntegerVariable()) {
+                            stateVariableBounds.push_back(std::make_pair(variable.asBoundedIntegerVariable().getLowerBound().evaluateAsInt(), variable.asBoundedIntegerVariable().getUpperBound().evaluateAsInt()));
+                        } else {
+                            stateVariableBounds.push_back(boost::none);
+                        }
+                    }
+                };
+                addVariables(this->model.getGlobalVariables());
+                for (auto const& automaton : this->model.getAutomata()) {
+                    addVariables(automaton.getVariables());
+                }
+                
+                std::vector<uint64_t> order;
+                if (variableOrdering == DdVariableOrdering::Force) {
+                    order = computeForceOrder(stateVariables);
+                } else {
+                    order.resize(stateVariables.size());
+                    std::iota(order.begin(), order.end(), 0ull);
+                }
+                
+                for (auto const& variableIndex : order) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    if (stateVariableBounds[variableIndex]) {
+                        variablePair = result.manager->addMetaVariable(stateVariableNames[variableIndex], stateVariableBounds[variableIndex].get().first, stateVariableBounds[variableIndex].get().second);
+                    } else {
+                        variablePair = result.manager->addMetaVariable(stateVariableNames[variableIndex]);
+                    }
+                    stateVariableToMetaVariablesMap.emplace(stateVariables[variableIndex], variablePair);
+                }
+            }
+            
+            /*!
+             * Computes an order of the given locations and variables with the FORCE heuristic. The location of an
+             * automaton and the variables read or written by one of its edges (or by edges synchronizing on the same
+             * action) are considered to interact.
+             *
+             * @param stateVariables The expression variables of the locations and variables in their original order.
+             * @return The order, that is, the i-th entry is the index of the variable to put at position i.
+             */
+            std::vector<uint64_t> computeForceOrder(std::vector<storm::expressions::Variable> const& stateVariables) const {
+                std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+                for (uint64_t index = 0; index < stateVariables.size(); ++index) {
+                    variableToIndexMap.emplace(stateVariables[index], index);
+                }
+                
+                // Collect all variables that an edge refers to. Edges synchronizing on the same action are merged.
+                std::vector<std::set<uint64_t>> hyperedges;
+                std::map<uint64_t, uint64_t> actionIndexToHyperedgeMap;
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& edge : automaton.getEdges()) {
+                        std::set<storm::expressions::Variable> edgeVariables = edge.getGuard().getVariables();
+                        edgeVariables.insert(automaton.getLocationExpressionVariable());
+                        if (edge.hasRate()) {
+                            std::set<storm::expressions::Variable> rateVariables = edge.getRate().getVariables();
+                            edgeVariables.insert(rateVariables.begin(), rateVariables.end());
+                        }
+                        for (auto const& destination : edge.getDestinations()) {
+                            std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                            edgeVariables.insert(probabilityVariables.begin(), probabilityVariables.end());
+                            for (auto const& assignment : destination.getOrderedAssignments()) {
+                                edgeVariables.insert(assignment.getExpressionVariable());
+                                std::set<storm::expressions::Variable> assignmentVariables = assignment.getAssignedExpression().getVariables();
+                                edgeVariables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                            }
+                        }
+                        
+                        uint64_t hyperedgeIndex = hyperedges.size();
+                        if (actionInformation.getNonSilentActionIndices().count(edge.getActionIndex()) > 0) {
+                            hyperedgeIndex = actionIndexToHyperedgeMap.emplace(edge.getActionIndex(), hyperedgeIndex).first->second;
+                        }
+                        if (hyperedgeIndex == hyperedges.size()) {
+                            hyperedges.emplace_back();
+                        }
+                        
+                        for (auto const& variable : edgeVariables) {
+                            auto indexIt = variableToIndexMap.find(variable);
+                            if (indexIt != variableToIndexMap.end()) {
+                                hyperedges[hyperedgeIndex].insert(indexIt->second);
+                            }
+                        }
+                    }
+                }
+                
+                std::vector<std::vector<uint64_t>> hyperedgesAsVectors;
+                hyperedgesAsVectors.reserve(hyperedges.size());
+                for (auto const& hyperedge : hyperedges) {
+                    hyperedgesAsVectors.emplace_back(hyperedge.begin(), hyperedge.end());
+                }
+                
+                std::vector<uint64_t> result = storm::utility::dd::computeForceVariableOrder(stateVariables.size(), hyperedgesAsVectors);
+                
+                std::vector<std::string> orderedVariableNames;
+                for (auto const& variableIndex : result) {
+                    orderedVariableNames.push_back(stateVariables[variableIndex].getName());
+                }
+                STORM_LOG_DEBUG("FORCE heuristic ordered the locations and variables as " << boost::join(orderedVariableNames, ", ") << ".");
+                
+                return result;
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -408,9 +539,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BoundedIntegerVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                int_fast64_t low = variable.getLowerBound().evaluateAsInt();
-                int_fast64_t high = variable.getUpperBound().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = stateVariableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -430,7 +559,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BooleanVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = stateVariableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -453,6 +582,8 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            DdVariableOrdering variableOrdering;
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> stateVariableToMetaVariablesMap;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1974,6 +2105,7 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuilder<Type, ValueType>::build(storm::jani::Model const& model, Options const& options) {
+            storm::dd::DdOperationScope scope("DdJaniModelBuilder::build");
             if (!std::is_same<ValueType, storm::RationalFunction>::value && model.hasUndefinedConstants()) {
                 std::vector<std::reference_wrapper<storm::jani::Constant const>> undefinedConstants = model.getUndefinedConstants();
                 std::vector<std::string> strings;
@@ -2001,7 +2133,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.variableOrdering);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -3,6 +3,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/logic/Formula.h"
 
@@ -103,6 +104,9 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<storm::expressions::Expression> negatedTerminalStates;
+                
+                // The heuristic used to order the DD variables encoding the locations and variables of the automata.
+                DdVariableOrdering variableOrdering;
             };
                         
             /*!
@@ -1,5 +1,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
+#include <numeric>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/models/symbolic/Dtmc.h"
@@ -23,8 +25,10 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -92,7 +96,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, DdVariableOrdering const& variableOrdering) : program(program), variableOrdering(variableOrdering), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
                 createMetaVariablesAndIdentities();
@@ -108,6 +112,9 @@ namespace storm {
             // The program that is currently translated.
             storm::prism::Program const& program;
             
+            // The heuristic used to order the DD variables of the program variables.
+            DdVariableOrdering variableOrdering;
+            
             // The manager used to build the decision diagrams.
             std::shared_ptr<storm::dd::DdManager<Type>> manager;
             
@@ -175,11 +182,12 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Create the meta variables for all program variables in the order given by the selected heuristic.
+                std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> programVariableToMetaVariablesMap = createProgramMetaVariables();
+                
+                // Create identities for global program variables.
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = programVariableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -196,7 +204,7 @@ namespace storm {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = programVariableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -213,15 +221,13 @@ namespace storm {
                     allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Create identities for each of the modules' variables.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = programVariableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -238,7 +244,7 @@ namespace storm {
                         rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair = programVariableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -258,6 +264,119 @@ namespace storm {
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
                 }
             }
+            
+            /*!
+             * Creates the meta variables for all program variables in the order determined by the selected variable
+             * ordering heuristic. Note that the row and column variables of every program variable are interleaved.
+             *
+             * @return A mapping from the program variables to their row and column meta variables.
+             */
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createProgramMetaVariables() {
+                // Collect all program variables in the order of their declaration.
+                std::vector<std::reference_wrapper<storm::prism::Variable const>> programVariables;
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+                    programVariables.push_back(integerVariable);
+                }
+                for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
+                    programVariables.push_back(booleanVariable);
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        programVariables.push_back(integerVariable);
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                        programVariables.push_back(booleanVariable);
+                    }
+                }
+                
+                std::vector<uint64_t> order;
+                if (variableOrdering == DdVariableOrdering::Force) {
+                    order = computeForceOrder(programVariables);
+                } else {
+                    order.resize(programVariables.size());
+                    std::iota(order.begin(), order.end(), 0ull);
+                }
+                
+                std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> result;
+                for (auto const& variableIndex : order) {
+                    storm::prism::Variable const& variable = programVariables[variableIndex];
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    if (variable.getExpressionVariable().hasBooleanType()) {
+                        variablePair = manager->addMetaVariable(variable.getName());
+                    } else {
+                        storm::prism::IntegerVariable const& integerVariable = static_cast<storm::prism::IntegerVariable const&>(variable);
+                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
+                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
+                        variablePair = manager->addMetaVariable(variable.getName(), low, high);
+                    }
+                    result.emplace(variable.getExpressionVariable(), variablePair);
+                }
+                return result;
+            }
+            
+            /*!
+             * Computes an order of the given program variables with the FORCE heuristic. Variables that are read or
+             * written by the same command (or by commands synchronizing on the same action) are considered to interact.
+             *
+             * @param programVariables The program variables in the order of their declaration.
+             * @return The order, that is, the i-th entry is the index of the program variable to put at position i.
+             */
+            std::vector<uint64_t> computeForceOrder(std::vector<std::reference_wrapper<storm::prism::Variable const>> const& programVariables) const {
+                std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+                for (uint64_t index = 0; index < programVariables.size(); ++index) {
+                    variableToIndexMap.emplace(programVariables[index].get().getExpressionVariable(), index);
+                }
+                
+                // Collect all variables that a command refers to. Commands synchronizing on the same action are merged.
+                std::vector<std::set<uint64_t>> hyperedges;
+                std::map<uint_fast64_t, uint64_t> actionIndexToHyperedgeMap;
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::Command const& command : module.getCommands()) {
+                        std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+                        for (storm::prism::Update const& update : command.getUpdates()) {
+                            std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                            commandVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                            for (storm::prism::Assignment const& assignment : update.getAssignments()) {
+                                commandVariables.insert(assignment.getVariable());
+                                std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                                commandVariables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                            }
+                        }
+                        
+                        uint64_t hyperedgeIndex = hyperedges.size();
+                        if (command.isLabeled() && program.getSynchronizingActionIndices().count(command.getActionIndex()) > 0) {
+                            auto actionIt = actionIndexToHyperedgeMap.emplace(command.getActionIndex(), hyperedgeIndex).first;
+                            hyperedgeIndex = actionIt->second;
+                        }
+                        if (hyperedgeIndex == hyperedges.size()) {
+                            hyperedges.emplace_back();
+                        }
+                        
+                        for (auto const& variable : commandVariables) {
+                            auto indexIt = variableToIndexMap.find(variable);
+                            if (indexIt != variableToIndexMap.end()) {
+                                hyperedges[hyperedgeIndex].insert(indexIt->second);
+                            }
+                        }
+                    }
+                }
+                
+                std::vector<std::vector<uint64_t>> hyperedgesAsVectors;
+                hyperedgesAsVectors.reserve(hyperedges.size());
+                for (auto const& hyperedge : hyperedges) {
+                    hyperedgesAsVectors.emplace_back(hyperedge.begin(), hyperedge.end());
+                }
+                
+                std::vector<uint64_t> result = storm::utility::dd::computeForceVariableOrder(programVariables.size(), hyperedgesAsVectors);
+                
+                std::vector<std::string> orderedVariableNames;
+                for (auto const& variableIndex : result) {
+                    orderedVariableNames.push_back(programVariables[variableIndex].get().getName());
+                }
+                STORM_LOG_DEBUG("FORCE heuristic ordered the program variables as " << boost::join(orderedVariableNames, ", ") << ".");
+                
+                return result;
+            }
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -540,18 +659,18 @@ namespace storm {
         };
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -1322,6 +1441,7 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBuilder<Type, ValueType>::build(storm::prism::Program const& program, Options const& options) {
+            storm::dd::DdOperationScope scope("DdPrismModelBuilder::build");
             if (!std::is_same<ValueType, storm::RationalFunction>::value && program.hasUndefinedConstants()) {
                 std::vector<std::reference_wrapper<storm::prism::Constant const>> undefinedConstants = program.getUndefinedConstants();
                 std::stringstream stream;
@@ -1342,7 +1462,7 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options.variableOrdering);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -0,0 +1,22 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+namespace storm {
+    namespace builder {
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering) {
+            switch (ordering) {
+                case DdVariableOrdering::Program:
+                    out << "program";
+                    break;
+                case DdVariableOrdering::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+        
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef STORM_BUILDER_DDVARIABLEORDERING_H_
+#define STORM_BUILDER_DDVARIABLEORDERING_H_
+
+#include <ostream>
+
+namespace storm {
+    namespace builder {
+        
+        // An enum that contains all currently supported heuristics to order the DD variables of the symbolic builders.
+        enum class DdVariableOrdering { Program, Force };
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering);
+        
+    }
+}
+
+#endif /* STORM_BUILDER_DDVARIABLEORDERING_H_ */
@@ -3,6 +3,7 @@
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -12,7 +13,7 @@
 namespace storm {
     
     ModelCheckerEnvironment::ModelCheckerEnvironment() {
-        // Intentionally left empty
+        eliminationSccThreads = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfSccThreads();
     }
     
     ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -26,6 +27,14 @@ namespace storm {
     MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() const {
         return multiObjectiveModelCheckerEnvironment.get();
     }
+    
+    uint64_t const& ModelCheckerEnvironment::getNumberOfEliminationSccThreads() const {
+        return eliminationSccThreads;
+    }
+    
+    void ModelCheckerEnvironment::setNumberOfEliminationSccThreads(uint64_t value) {
+        eliminationSccThreads = value;
+    }
 }
     
 
@@ -19,10 +19,13 @@ namespace storm {
         
         MultiObjectiveModelCheckerEnvironment& multi();
         MultiObjectiveModelCheckerEnvironment const& multi() const;
-
+        
+        uint64_t const& getNumberOfEliminationSccThreads() const;
+        void setNumberOfEliminationSccThreads(uint64_t value);
     
     private:
         SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+        uint64_t eliminationSccThreads;
     };
 }
 
@@ -20,6 +20,7 @@ namespace storm {
         if (multiobjectiveSettings.isMaxStepsSet()) {
             maxSteps = multiobjectiveSettings.getMaxSteps();
         }
+        numberOfConcurrentSteps = multiobjectiveSettings.getNumberOfConcurrentSteps();
     }
     
     MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -97,4 +98,12 @@ namespace storm {
     void MultiObjectiveModelCheckerEnvironment::unsetMaxSteps() {
         maxSteps = boost::none;
     }
+    
+    uint64_t const& MultiObjectiveModelCheckerEnvironment::getNumberOfConcurrentSteps() const {
+        return numberOfConcurrentSteps;
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::setNumberOfConcurrentSteps(uint64_t const& value) {
+        numberOfConcurrentSteps = value;
+    }
 }
\ No newline at end of file
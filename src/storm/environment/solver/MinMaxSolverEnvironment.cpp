@@ -18,6 +18,8 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        symbolicFrontierIteration = minMaxSettings.isSymbolicFrontierIterationSet();
+        lraThreads = minMaxSettings.getNumberOfLraThreads();
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -77,4 +79,20 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    bool MinMaxSolverEnvironment::isSymbolicFrontierIterationSet() const {
+        return symbolicFrontierIteration;
+    }
+    
+    void MinMaxSolverEnvironment::setSymbolicFrontierIteration(bool value) {
+        symbolicFrontierIteration = value;
+    }
+    
+    uint64_t const& MinMaxSolverEnvironment::getNumberOfLraThreads() const {
+        return lraThreads;
+    }
+    
+    void MinMaxSolverEnvironment::setNumberOfLraThreads(uint64_t value) {
+        lraThreads = value;
+    }
+    
 }
@@ -29,6 +29,10 @@ namespace storm {
         void setForceBounds(bool value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isSymbolicFrontierIterationSet() const;
+        void setSymbolicFrontierIteration(bool value);
+        uint64_t const& getNumberOfLraThreads() const;
+        void setNumberOfLraThreads(uint64_t value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -39,6 +43,8 @@ namespace storm {
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool forceBounds;
         bool symmetricUpdates;
+        bool symbolicFrontierIteration;
+        uint64_t lraThreads;
     };
 }
 
@@ -19,6 +19,8 @@ namespace storm {
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        symbolicFrontierIteration = nativeSettings.isSymbolicFrontierIterationSet();
+        gaussSeidelThreads = nativeSettings.getNumberOfGaussSeidelThreads();
 
     }
 
@@ -86,5 +88,21 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    bool NativeSolverEnvironment::isSymbolicFrontierIterationSet() const {
+        return symbolicFrontierIteration;
+    }
+    
+    void NativeSolverEnvironment::setSymbolicFrontierIteration(bool value) {
+        symbolicFrontierIteration = value;
+    }
+    
+    uint64_t const& NativeSolverEnvironment::getNumberOfGaussSeidelThreads() const {
+        return gaussSeidelThreads;
+    }
+    
+    void NativeSolverEnvironment::setNumberOfGaussSeidelThreads(uint64_t value) {
+        gaussSeidelThreads = value;
+    }
   
 }
@@ -29,6 +29,10 @@ namespace storm {
         void setSorOmega(storm::RationalNumber const& value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isSymbolicFrontierIterationSet() const;
+        void setSymbolicFrontierIteration(bool value);
+        uint64_t const& getNumberOfGaussSeidelThreads() const;
+        void setNumberOfGaussSeidelThreads(uint64_t value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -39,6 +43,8 @@ namespace storm {
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
         bool symmetricUpdates;
+        bool symbolicFrontierIteration;
+        uint64_t gaussSeidelThreads;
     };
 }
 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <numeric>
+
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -16,6 +18,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/Expression.h"
@@ -647,28 +650,36 @@ namespace storm {
                 // Get some data members for convenience.
                 std::vector<uint64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
                 
-                // Now start with compute the long-run average for all end components in isolation.
-                std::vector<ValueType> lraValuesForEndComponents;
-                
-                // While doing so, we already gather some information for the following steps.
+                // Gather some information for the following steps.
                 std::vector<uint64_t> stateToMecIndexMap(numberOfStates);
                 storm::storage::BitVector statesInMecs(numberOfStates);
                 
                 for (uint64_t currentMecIndex = 0; currentMecIndex < mecDecomposition.size(); ++currentMecIndex) {
                     storm::storage::MaximalEndComponent const& mec = mecDecomposition[currentMecIndex];
                     
-                    // Gather information for later use.
                     for (auto const& stateChoicesPair : mec) {
                         uint64_t state = stateChoicesPair.first;
                         
                         statesInMecs.set(state);
                         stateToMecIndexMap[state] = currentMecIndex;
                     }
-                    
-                    // Compute the LRA value for the current MEC.
-                    lraValuesForEndComponents.push_back(computeLraForMaximalEndComponent(env, dir, transitionMatrix, exitRateVector, markovianStates, rewardModel, mec));
                 }
                 
+                // Now compute the long-run average for all end components in isolation.
+                std::vector<ValueType> lraValuesForEndComponents(mecDecomposition.size());
+                // As in the MDP case, the MECs are handed out to the threads largest first. This is only done for
+                // value iteration on doubles.
+                std::vector<uint64_t> mecOrder(mecDecomposition.size());
+                std::iota(mecOrder.begin(), mecOrder.end(), 0);
+                uint64_t numberOfThreads = 1;
+                if (std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getLraMethod() == storm::solver::LraMethod::ValueIteration) {
+                    numberOfThreads = env.solver().minMax().getNumberOfLraThreads();
+                    std::stable_sort(mecOrder.begin(), mecOrder.end(), [&mecDecomposition] (uint64_t first, uint64_t second) { return mecDecomposition[first].size() > mecDecomposition[second].size(); });
+                }
+                storm::utility::parallel::forEachConcurrently(mecOrder, numberOfThreads, [&] (uint64_t currentMecIndex) {
+                    lraValuesForEndComponents[currentMecIndex] = computeLraForMaximalEndComponent(env, dir, transitionMatrix, exitRateVector, markovianStates, rewardModel, mecDecomposition[currentMecIndex]);
+                });
+                
                 // For fast transition rewriting, we build some auxiliary data structures.
                 storm::storage::BitVector statesNotContainedInAnyMec = ~statesInMecs;
                 uint64_t firstAuxiliaryStateIndex = statesNotContainedInAnyMec.getNumberOfSetBits();
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <thread>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
@@ -61,11 +63,24 @@ namespace storm {
             explorationInformation.newRowGroup(0);
             
             std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-            StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionFormula.toExpression(program.getManager(), labelToExpressionMapping), targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
-            
+            storm::expressions::Expression conditionExpression = conditionFormula.toExpression(program.getManager(), labelToExpressionMapping);
+            storm::expressions::Expression targetExpression = targetFormula.toExpression(program.getManager(), labelToExpressionMapping);
+            StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionExpression, targetExpression);
             
             // Compute and return result.
-            std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+            std::tuple<StateType, ValueType, ValueType> boundsForInitialState;
+            uint_fast64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads();
+            if (numberOfThreads > 1) {
+                // Every additional thread expands states with its own generator. The generators are created upfront,
+                // such that the (shared) program is not accessed concurrently while doing so.
+                std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> threadStateGenerations;
+                for (uint_fast64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    threadStateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(program, explorationInformation, conditionExpression, targetExpression));
+                }
+                boundsForInitialState = performConcurrentExploration(stateGeneration, threadStateGenerations, explorationInformation);
+            } else {
+                boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+            }
             return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
         }
         
@@ -122,6 +137,150 @@ namespace storm {
             return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
         }
         
+        template<typename ModelType, typename StateType>
+        SparseExplorationModelChecker<ModelType, StateType>::ExplorationMutexes::ExplorationMutexes(uint_fast64_t numberOfBoundStripes) : waitingWriters(0), boundMutexes(numberOfBoundStripes) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration, std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>>& threadStateGenerations, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+            // Generate the initial state so we know where to start the simulation.
+            stateGeneration.computeInitialStates();
+            STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
+            StateType initialStateIndex = stateGeneration.getFirstInitialState();
+            
+            // The structures shared by all threads. The state generation of this thread registers the states that are
+            // discovered by any of the threads.
+            Bounds<StateType, ValueType> bounds;
+            Statistics<StateType, ValueType> stats;
+            uint_fast64_t numberOfThreads = threadStateGenerations.size() + 1;
+            ExplorationMutexes mutexes(64 * numberOfThreads);
+            std::atomic<bool> convergenceCriterionMet(false);
+            std::atomic<bool> failed(false);
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+            
+            // Every thread samples with its own random number generator.
+            std::vector<std::default_random_engine> generators;
+            for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+                generators.emplace_back(randomGenerator());
+            }
+            
+            auto worker = [&] (StateGeneration<StateType, ValueType>& threadStateGeneration, std::default_random_engine& generator) {
+                StateActionStack stack;
+                std::shared_lock<std::shared_timed_mutex> structureLock(mutexes.structureMutex, std::defer_lock);
+                while (!convergenceCriterionMet && !failed) {
+                    // Do not start a new path while another thread waits for exclusive access.
+                    while (mutexes.waitingWriters > 0) {
+                        std::this_thread::yield();
+                    }
+                    structureLock.lock();
+                    
+                    try {
+                        boost::optional<bool> result = samplePathFromInitialStateConcurrently(stateGeneration, threadStateGeneration, structureLock, mutexes, explorationInformation, stack, bounds, stats, generator);
+                        
+                        // Abandoned paths neither change the bounds nor count as sampled paths.
+                        if (result) {
+                            {
+                                std::lock_guard<std::mutex> statisticsLock(mutexes.statisticsMutex);
+                                stats.sampledPath();
+                                stats.updateMaxPathLength(stack.size());
+                            }
+                            
+                            // If a terminal state was found, we update the probabilities along the path contained in the stack.
+                            if (result.get()) {
+                                STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                                updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds, &mutexes.boundMutexes);
+                            } else {
+                                STORM_LOG_TRACE("Did not find terminal state.");
+                            }
+                            
+                            ValueType difference;
+                            {
+                                std::unique_lock<std::mutex> boundsLock = lockBoundsOfState(initialStateIndex, explorationInformation, &mutexes.boundMutexes);
+                                difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                            }
+                            STORM_LOG_DEBUG("Difference after a sampled path is " << difference << ".");
+                            if (comparator.isZero(difference)) {
+                                convergenceCriterionMet = true;
+                            }
+                            
+                            // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+                            bool performPrecomputationNow = false;
+                            if (!convergenceCriterionMet) {
+                                std::lock_guard<std::mutex> statisticsLock(mutexes.statisticsMutex);
+                                performPrecomputationNow = explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation);
+                            }
+                            if (performPrecomputationNow) {
+                                std::size_t numberOfPrecomputations = stats.numberOfPrecomputations;
+                                structureLock.unlock();
+                                std::unique_lock<std::shared_timed_mutex> exclusiveLock = lockStructureExclusively(mutexes);
+                                // Skip the precomputation if another thread performed one in the meantime.
+                                if (stats.numberOfPrecomputations == numberOfPrecomputations) {
+                                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                                }
+                                exclusiveLock.unlock();
+                                structureLock.lock();
+                            }
+                        }
+                    } catch (...) {
+                        std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                        failed = true;
+                    }
+                    stack.clear();
+                    
+                    // Give the other threads the opportunity to acquire exclusive access between two paths.
+                    if (structureLock.owns_lock()) {
+                        structureLock.unlock();
+                    }
+                }
+            };
+            
+            std::vector<std::thread> threads;
+            for (uint_fast64_t thread = 0; thread < threadStateGenerations.size(); ++thread) {
+                threads.emplace_back(worker, std::ref(*threadStateGenerations[thread]), std::ref(generators[thread + 1]));
+            }
+            worker(stateGeneration, generators.front());
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            
+            // Show statistics if required.
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                stats.printToStream(std::cout, explorationInformation);
+            }
+            
+            return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_lock<std::shared_timed_mutex> SparseExplorationModelChecker<ModelType, StateType>::lockStructureExclusively(ExplorationMutexes& mutexes) const {
+            ++mutexes.waitingWriters;
+            std::unique_lock<std::shared_timed_mutex> lock(mutexes.structureMutex);
+            --mutexes.waitingWriters;
+            return lock;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_lock<std::mutex> SparseExplorationModelChecker<ModelType, StateType>::lockBoundsOfRowGroup(StateType const& rowGroup, std::vector<std::mutex>* boundMutexes) const {
+            if (!boundMutexes) {
+                return std::unique_lock<std::mutex>();
+            }
+            return std::unique_lock<std::mutex>((*boundMutexes)[rowGroup % boundMutexes->size()]);
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_lock<std::mutex> SparseExplorationModelChecker<ModelType, StateType>::lockBoundsOfState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, std::vector<std::mutex>* boundMutexes) const {
+            // The bounds of unexplored states are constant, so locking the stripe of the unexplored marker is harmless.
+            return lockBoundsOfRowGroup(explorationInformation.getRowGroup(state), boundMutexes);
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             // Start the search from the initial state.
@@ -160,11 +319,11 @@ namespace storm {
                 if (!foundTerminalState) {
                     // At this point, we can be sure that the state was expanded and that we can sample according to the
                     // probabilities in the matrix.
-                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
                     stack.back().second = chosenAction;
                     STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
                     
-                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
                     STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
                     
                     // Put the successor state and a dummy action on top of the stack.
@@ -184,10 +343,133 @@ namespace storm {
             return foundTerminalState;
         }
         
+        template<typename ModelType, typename StateType>
+        boost::optional<bool> SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialStateConcurrently(StateGeneration<StateType, ValueType>& stateGeneration, StateGeneration<StateType, ValueType>& threadStateGeneration, std::shared_lock<std::shared_timed_mutex>& structureLock, ExplorationMutexes& mutexes, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& generator) const {
+            // Precomputations may collapse end components and thereby invalidate the actions on the stack, so we
+            // remember how many precomputations were performed when the path was started. As precomputations are only
+            // performed with exclusive access, this needs to be checked whenever the structure lock was reacquired.
+            std::size_t numberOfPrecomputations = stats.numberOfPrecomputations;
+            
+            // Start the search from the initial state.
+            stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+            
+            // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
+            bool foundTerminalState = false;
+            while (!foundTerminalState) {
+                StateType currentStateId = stack.back().first;
+                STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
+                
+                if (explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd()) {
+                    STORM_LOG_TRACE("State was not yet explored.");
+                    
+                    // Claim the state by removing it from the unexplored states. Until its behavior is added, other
+                    // threads that reach the state abandon their path.
+                    storm::generator::CompressedState compressedState;
+                    structureLock.unlock();
+                    {
+                        std::unique_lock<std::shared_timed_mutex> exclusiveLock = lockStructureExclusively(mutexes);
+                        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                        if (unexploredIt == explorationInformation.unexploredStatesEnd() || stats.numberOfPrecomputations != numberOfPrecomputations) {
+                            STORM_LOG_TRACE("Aborting the search, because another thread claimed the state or performed a precomputation.");
+                            exclusiveLock.unlock();
+                            structureLock.lock();
+                            stack.clear();
+                            return boost::none;
+                        }
+                        compressedState = unexploredIt->second;
+                        explorationInformation.removeUnexploredState(unexploredIt);
+                    }
+                    
+                    // Expand the state without holding any lock.
+                    threadStateGeneration.load(compressedState);
+                    bool isTargetState = threadStateGeneration.isTargetState();
+                    std::vector<storm::generator::CompressedState> successors;
+                    storm::generator::StateBehavior<ValueType, StateType> behavior;
+                    if (!isTargetState && threadStateGeneration.isConditionState()) {
+                        behavior = threadStateGeneration.expand(successors);
+                    }
+                    
+                    {
+                        std::unique_lock<std::shared_timed_mutex> exclusiveLock = lockStructureExclusively(mutexes);
+                        foundTerminalState = addExploredState(currentStateId, isTargetState, stateGeneration.registerSuccessors(behavior, successors), explorationInformation, bounds, stats);
+                    }
+                    structureLock.lock();
+                    if (stats.numberOfPrecomputations != numberOfPrecomputations) {
+                        STORM_LOG_TRACE("Aborting the search, because another thread performed a precomputation.");
+                        stack.clear();
+                        return boost::none;
+                    }
+                } else if (explorationInformation.isUnexplored(currentStateId)) {
+                    STORM_LOG_TRACE("Aborting the search, because the state is being explored by another thread.");
+                    stack.clear();
+                    return boost::none;
+                } else if (explorationInformation.isTerminal(currentStateId)) {
+                    STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
+                    foundTerminalState = true;
+                }
+                
+                // Notify the stats about the performed exploration step and check whether a precomputation is due.
+                bool performPrecomputationNow = false;
+                {
+                    std::lock_guard<std::mutex> statisticsLock(mutexes.statisticsMutex);
+                    stats.explorationStep();
+                    if (!foundTerminalState) {
+                        performPrecomputationNow = explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation);
+                    }
+                }
+                
+                // If the state was not a terminal state, we continue the path search and sample the next state.
+                if (!foundTerminalState) {
+                    ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator, &mutexes.boundMutexes);
+                    stack.back().second = chosenAction;
+                    STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
+                    
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator, &mutexes.boundMutexes);
+                    STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+                    stack.emplace_back(successor, 0);
+                    
+                    // If the number of exploration steps exceeds a certain threshold, do a precomputation.
+                    if (performPrecomputationNow) {
+                        structureLock.unlock();
+                        {
+                            std::unique_lock<std::shared_timed_mutex> exclusiveLock = lockStructureExclusively(mutexes);
+                            if (stats.numberOfPrecomputations == numberOfPrecomputations) {
+                                performPrecomputation(stack, explorationInformation, bounds, stats);
+                            }
+                        }
+                        structureLock.lock();
+                        
+                        STORM_LOG_TRACE("Aborting the search after precomputation.");
+                        stack.clear();
+                        break;
+                    }
+                }
+            }
+            
+            return foundTerminalState;
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+            // Before generating the behavior of the state, we need to determine whether it's a target state that
+            // does not need to be expanded.
+            stateGeneration.load(currentState);
+            bool isTargetState = stateGeneration.isTargetState();
+            
+            // If it needs to be expanded, we use the generator to retrieve the behavior of the new state. States that
+            // are neither target nor condition states are rejecting terminal states and thus keep an empty behavior.
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            if (!isTargetState && stateGeneration.isConditionState()) {
+                STORM_LOG_TRACE("Exploring state.");
+                behavior = stateGeneration.expand();
+            }
+            
+            return addExploredState(currentStateId, isTargetState, behavior, explorationInformation, bounds, stats);
+        }
+        
+        template<typename ModelType, typename StateType>
+        bool SparseExplorationModelChecker<ModelType, StateType>::addExploredState(StateType const& currentStateId, bool isTargetState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             bool isTerminalState = false;
-            bool isTargetState = false;
             
             ++stats.numberOfExploredStates;
             
@@ -199,18 +481,10 @@ namespace storm {
             // all states that have been assigned to a row-group.
             bounds.initializeBoundsForNextState();
             
-            // Before generating the behavior of the state, we need to determine whether it's a target state that
-            // does not need to be expanded.
-            stateGeneration.load(currentState);
-            if (stateGeneration.isTargetState()) {
+            if (isTargetState) {
                 ++stats.numberOfTargetStates;
-                isTargetState = true;
                 isTerminalState = true;
-            } else if (stateGeneration.isConditionState()) {
-                STORM_LOG_TRACE("Exploring state.");
-                
-                // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-                storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
+            } else {
                 STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
                 
                 // Clumsily check whether we have found a state that forms a trivial BMEC.
@@ -258,10 +532,6 @@ namespace storm {
                     bounds.setBoundsForState(currentStateId, explorationInformation, stateBounds);
                     STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation) << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
                 }
-            } else {
-                // In this case, the state is neither a target state nor a condition state and therefore a rejecting
-                // terminal state.
-                isTerminalState = true;
             }
             
             if (isTerminalState) {
@@ -287,7 +557,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator, std::vector<std::mutex>* boundMutexes) const {
             // Determine the values of all available actions.
             std::vector<std::pair<ActionType, ValueType>> actionValues;
             StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -300,8 +570,11 @@ namespace storm {
             // If there are more choices to consider, start by gathering the values of relevant actions.
             STORM_LOG_TRACE("Sampling from actions leaving the state.");
             
-            for (uint32_t row = explorationInformation.getStartRowOfGroup(rowGroup); row < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++row) {
-                actionValues.push_back(std::make_pair(row, bounds.getBoundForAction(explorationInformation.getOptimizationDirection(), row)));
+            {
+                std::unique_lock<std::mutex> boundsLock = lockBoundsOfRowGroup(rowGroup, boundMutexes);
+                for (uint32_t row = explorationInformation.getStartRowOfGroup(rowGroup); row < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++row) {
+                    actionValues.push_back(std::make_pair(row, bounds.getBoundForAction(explorationInformation.getOptimizationDirection(), row)));
+                }
             }
             
             STORM_LOG_ASSERT(!actionValues.empty(), "Values for actions must not be empty.");
@@ -321,11 +594,11 @@ namespace storm {
             
             // Now sample from all maximizing actions.
             std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-            return actionValues[distribution(randomGenerator)].first;
+            return actionValues[distribution(generator)].first;
         }
         
         template<typename ModelType, typename StateType>
-        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, std::vector<std::mutex>* boundMutexes) const {
             std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
             if (row.size() == 1) {
                 return row.front().getColumn();
@@ -336,7 +609,8 @@ namespace storm {
                 std::vector<ValueType> probabilities(row.size());
                 if (explorationInformation.useDifferenceProbabilitySumHeuristic()) {
                 std::transform(row.begin(), row.end(), probabilities.begin(),
-                               [&bounds, &explorationInformation] (storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
+                               [this, &bounds, &explorationInformation, boundMutexes] (storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
+                                   std::unique_lock<std::mutex> boundsLock = lockBoundsOfState(entry.getColumn(), explorationInformation, boundMutexes);
                                    return entry.getValue() + bounds.getDifferenceOfStateBounds(entry.getColumn(), explorationInformation);
                                });
                 } else if (explorationInformation.useProbabilityHeuristic()) {
@@ -348,11 +622,11 @@ namespace storm {
                 
                 // Now sample according to the probabilities.
                 std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             } else {
                 STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
                 std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             }
         }
         
@@ -572,28 +846,31 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeLowerBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeLowerBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes) const {
             ValueType result = storm::utility::zero<ValueType>();
             for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                std::unique_lock<std::mutex> boundsLock = lockBoundsOfState(element.getColumn(), explorationInformation, boundMutexes);
                 result += element.getValue() * bounds.getLowerBoundForState(element.getColumn(), explorationInformation);
             }
             return result;
         }
         
         template<typename ModelType, typename StateType>
-        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeUpperBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeUpperBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes) const {
             ValueType result = storm::utility::zero<ValueType>();
             for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                std::unique_lock<std::mutex> boundsLock = lockBoundsOfState(element.getColumn(), explorationInformation, boundMutexes);
                 result += element.getValue() * bounds.getUpperBoundForState(element.getColumn(), explorationInformation);
             }
             return result;
         }
         
         template<typename ModelType, typename StateType>
-        std::pair<typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::computeBoundsOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        std::pair<typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::computeBoundsOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes) const {
             // TODO: take into account self-loops?
             std::pair<ValueType, ValueType> result = std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
             for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                std::unique_lock<std::mutex> boundsLock = lockBoundsOfState(element.getColumn(), explorationInformation, boundMutexes);
                 result.first += element.getValue() * bounds.getLowerBoundForState(element.getColumn(), explorationInformation);
                 result.second += element.getValue() * bounds.getUpperBoundForState(element.getColumn(), explorationInformation);
             }
@@ -612,51 +889,65 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::vector<std::mutex>* boundMutexes) const {
             stack.pop_back();
             while (!stack.empty()) {
-                updateProbabilityOfAction(stack.back().first, stack.back().second, explorationInformation, bounds);
+                updateProbabilityOfAction(stack.back().first, stack.back().second, explorationInformation, bounds, boundMutexes);
                 stack.pop_back();
             }
         }
         
         template<typename ModelType, typename StateType>
-        void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityOfAction(StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityOfAction(StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::vector<std::mutex>* boundMutexes) const {
             // Compute the new lower/upper values of the action.
-            std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds);
+            std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds, boundMutexes);
             
-            // And set them as the current value.
+            // And set them as the current value. When exploring concurrently, the bounds of the row group are locked
+            // while they are accessed, but not while the bounds of other row groups are read, such that at most one
+            // lock is held at any time.
+            StateType rowGroup = explorationInformation.getRowGroup(state);
+            std::unique_lock<std::mutex> boundsLock = lockBoundsOfRowGroup(rowGroup, boundMutexes);
             bounds.setBoundsForAction(action, newBoundsForAction);
             
             // Check if we need to update the values for the states.
             if (explorationInformation.maximize()) {
                 bounds.setLowerBoundOfStateIfGreaterThanOld(state, explorationInformation, newBoundsForAction.first);
                 
-                StateType rowGroup = explorationInformation.getRowGroup(state);
                 if (newBoundsForAction.second < bounds.getUpperBoundForRowGroup(rowGroup)) {
                     if (explorationInformation.getRowGroupSize(rowGroup) > 1) {
-                        newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
+                        if (boundsLock.owns_lock()) {
+                            boundsLock.unlock();
+                        }
+                        newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds, boundMutexes));
+                        if (boundsLock.mutex()) {
+                            boundsLock.lock();
+                        }
                     }
                     
-                    bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+                    bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
                 }
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
                 
-                StateType rowGroup = explorationInformation.getRowGroup(state);
                 if (bounds.getLowerBoundForRowGroup(rowGroup) < newBoundsForAction.first) {
                     if (explorationInformation.getRowGroupSize(rowGroup) > 1) {
-                        ValueType min = computeBoundOverAllOtherActions(storm::OptimizationDirection::Minimize, state, action, explorationInformation, bounds);
+                        if (boundsLock.owns_lock()) {
+                            boundsLock.unlock();
+                        }
+                        ValueType min = computeBoundOverAllOtherActions(storm::OptimizationDirection::Minimize, state, action, explorationInformation, bounds, boundMutexes);
                         newBoundsForAction.first = std::min(newBoundsForAction.first, min);
+                        if (boundsLock.mutex()) {
+                            boundsLock.lock();
+                        }
                     }
                     
-                    bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+                    bounds.setLowerBoundOfStateIfGreaterThanOld(state, explorationInformation, newBoundsForAction.first);
                 }
             }
         }
         
         template<typename ModelType, typename StateType>
-        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeBoundOverAllOtherActions(storm::OptimizationDirection const& direction, StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeBoundOverAllOtherActions(storm::OptimizationDirection const& direction, StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes) const {
             ValueType bound = getLowestBound(explorationInformation.getOptimizationDirection());
             
             ActionType group = explorationInformation.getRowGroup(state);
@@ -666,9 +957,9 @@ namespace storm {
                 }
                 
                 if (direction == storm::OptimizationDirection::Maximize) {
-                    bound = std::max(bound, computeUpperBoundOfAction(currentAction, explorationInformation, bounds));
+                    bound = std::max(bound, computeUpperBoundOfAction(currentAction, explorationInformation, bounds, boundMutexes));
                 } else {
-                    bound = std::min(bound, computeLowerBoundOfAction(currentAction, explorationInformation, bounds));
+                    bound = std::min(bound, computeLowerBoundOfAction(currentAction, explorationInformation, bounds, boundMutexes));
                 }
             }
             return bound;
@@ -1,13 +1,21 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <random>
+#include <shared_mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
 #include "storm/storage/prism/Program.h"
 
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/StateBehavior.h"
 #include "storm/generator/VariableInformation.h"
 
 #include "storm/utility/ConstantsComparator.h"
@@ -47,29 +55,90 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
             
         private:
+            /*!
+             * The synchronization primitives shared by the threads of a concurrent exploration.
+             */
+            struct ExplorationMutexes {
+                ExplorationMutexes(uint_fast64_t numberOfBoundStripes);
+                
+                // Guards the structure of the explored fragment (the states, row groups and actions). It is held shared
+                // while sampling paths and updating bounds, and exclusively while states are added or a precomputation
+                // is performed.
+                std::shared_timed_mutex structureMutex;
+                
+                // The number of threads waiting for exclusive access to the structure. While it is non-zero, no new
+                // paths are started such that the waiting threads are not starved.
+                std::atomic<uint_fast64_t> waitingWriters;
+                
+                // Guard the bounds of the row groups and their actions. The row groups are distributed over the stripes
+                // and a thread holds at most one of them at any time.
+                std::vector<std::mutex> boundMutexes;
+                
+                // Guards the statistics that are updated while sampling.
+                std::mutex statisticsMutex;
+            };
+            
             std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+            /*!
+             * Performs the exploration with multiple threads that sample paths concurrently. All threads share the
+             * exploration information and the bounds. The structure of the explored fragment is guarded by a
+             * readers-writer lock, such that paths are sampled and bounds are updated concurrently, while states are
+             * expanded by each thread with its own state generation without holding any lock. The bounds are guarded
+             * by striped locks per row group.
+             */
+            std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration, std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>>& threadStateGenerations, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            
             bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
+            /*!
+             * Samples a path like samplePathFromInitialState, but expands states with the state generation of the thread
+             * without holding any lock. The given (shared) structure lock must be held when calling this function and
+             * is held again upon return. If another thread is expanding a state on the path or performs a
+             * precomputation in the meantime, the path is abandoned.
+             *
+             * @return True iff a terminal state was found or none if the path was abandoned.
+             */
+            boost::optional<bool> samplePathFromInitialStateConcurrently(StateGeneration<StateType, ValueType>& stateGeneration, StateGeneration<StateType, ValueType>& threadStateGeneration, std::shared_lock<std::shared_timed_mutex>& structureLock, ExplorationMutexes& mutexes, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& generator) const;
+            
+            /*!
+             * Acquires exclusive access to the structure of the explored fragment.
+             */
+            std::unique_lock<std::shared_timed_mutex> lockStructureExclusively(ExplorationMutexes& mutexes) const;
+            
+            /*!
+             * Locks the bounds of the given row group, if bound mutexes are given (i.e. if the exploration is
+             * concurrent). Otherwise, the returned lock is not associated with any mutex.
+             */
+            std::unique_lock<std::mutex> lockBoundsOfRowGroup(StateType const& rowGroup, std::vector<std::mutex>* boundMutexes) const;
+            std::unique_lock<std::mutex> lockBoundsOfState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, std::vector<std::mutex>* boundMutexes) const;
+            
             bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
-            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            /*!
+             * Stores the behavior of the given (freshly expanded) state and initializes its bounds.
+             *
+             * @return True iff the state is a terminal state.
+             */
+            bool addExploredState(StateType const& currentStateId, bool isTargetState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+            
+            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator, std::vector<std::mutex>* boundMutexes = nullptr) const;
 
-            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, std::vector<std::mutex>* boundMutexes = nullptr) const;
             
             bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
             void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
             
-            void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
 
-            void updateProbabilityOfAction(StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            void updateProbabilityOfAction(StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
             
-            std::pair<ValueType, ValueType> computeBoundsOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
-            ValueType computeBoundOverAllOtherActions(storm::OptimizationDirection const& direction, StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            std::pair<ValueType, ValueType> computeBoundsOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
+            ValueType computeBoundOverAllOtherActions(storm::OptimizationDirection const& direction, StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
             std::pair<ValueType, ValueType> computeBoundsOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
-            ValueType computeLowerBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
-            ValueType computeUpperBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            ValueType computeLowerBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
+            ValueType computeUpperBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::vector<std::mutex>* boundMutexes = nullptr) const;
             
             std::pair<ValueType, ValueType> getLowestBounds(storm::OptimizationDirection const& direction) const;
             ValueType getLowestBound(storm::OptimizationDirection const& direction) const;
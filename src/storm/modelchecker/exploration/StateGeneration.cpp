@@ -38,6 +38,42 @@ namespace storm {
                 return generator.expand(stateToIdCallback);
             }
             
+            template <typename StateType, typename ValueType>
+            storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand(std::vector<storm::generator::CompressedState>& successors) {
+                return generator.expand([&successors] (storm::generator::CompressedState const& state) -> StateType {
+                    successors.push_back(state);
+                    return successors.size() - 1;
+                });
+            }
+            
+            template <typename StateType, typename ValueType>
+            storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::registerSuccessors(storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<storm::generator::CompressedState> const& successors) {
+                std::vector<StateType> successorIds;
+                successorIds.reserve(successors.size());
+                for (auto const& successor : successors) {
+                    successorIds.push_back(stateToIdCallback(successor));
+                }
+                
+                storm::generator::StateBehavior<ValueType, StateType> result;
+                for (auto const& choice : behavior) {
+                    storm::generator::Choice<ValueType, StateType> newChoice(choice.getActionIndex(), choice.isMarkovian());
+                    for (auto const& entry : choice) {
+                        newChoice.addProbability(successorIds[entry.first], entry.second);
+                    }
+                    if (choice.hasLabels()) {
+                        newChoice.addLabels(choice.getLabels());
+                    }
+                    if (choice.hasOriginData()) {
+                        newChoice.addOriginData(choice.getOriginData());
+                    }
+                    newChoice.addRewards(std::vector<ValueType>(choice.getRewards()));
+                    result.addChoice(std::move(newChoice));
+                }
+                result.addStateRewards(std::vector<ValueType>(behavior.getStateRewards()));
+                result.setExpanded(behavior.wasExpanded());
+                return result;
+            }
+            
             template <typename StateType, typename ValueType>
             bool StateGeneration<StateType, ValueType>::isConditionState() const {
                 return generator.satisfies(conditionStateExpression);
@@ -29,6 +29,19 @@ namespace storm {
                 
                 storm::generator::StateBehavior<ValueType, StateType> expand();
                 
+                /*!
+                 * Expands the loaded state without registering its successors. Instead, the successors in the returned
+                 * behavior are indices into the given vector to which their compressed states are appended. This way,
+                 * states can be expanded concurrently by different state generations.
+                 */
+                storm::generator::StateBehavior<ValueType, StateType> expand(std::vector<storm::generator::CompressedState>& successors);
+                
+                /*!
+                 * Registers the successors of a behavior that was obtained by expanding a state without registering its
+                 * successors and replaces their indices by their ids. The labels, origin data and rewards are kept.
+                 */
+                storm::generator::StateBehavior<ValueType, StateType> registerSuccessors(storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<storm::generator::CompressedState> const& successors);
+                
                 void computeInitialStates();
                 
                 StateType getFirstInitialState() const;
@@ -30,6 +30,11 @@ namespace storm {
             storm::storage::Scheduler<typename PcaaWeightVectorChecker<ModelType>::ValueType> PcaaWeightVectorChecker<ModelType>::computeScheduler() const {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Scheduler generation is not supported in this setting.");
             }
+            
+            template <typename ModelType>
+            std::unique_ptr<PcaaWeightVectorChecker<ModelType>> PcaaWeightVectorChecker<ModelType>::clone() const {
+                return nullptr;
+            }
 
             template <class SparseModelType>
             boost::optional<typename SparseModelType::ValueType> PcaaWeightVectorChecker<SparseModelType>::computeWeightedResultBound(bool lower, std::vector<ValueType> const& weightVector, storm::storage::BitVector const& objectiveFilter) const {
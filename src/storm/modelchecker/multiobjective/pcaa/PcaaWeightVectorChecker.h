@@ -70,6 +70,14 @@ namespace storm {
                  */
                 virtual storm::storage::Scheduler<ValueType> computeScheduler() const;
                 
+                /*!
+                 * Creates a copy of this weight vector checker that checks weight vectors independently of (and possibly
+                 * concurrently to) this one.
+                 *
+                 * @return The copy or nullptr if this weight vector checker can not be copied.
+                 */
+                virtual std::unique_ptr<PcaaWeightVectorChecker<ModelType>> clone() const;
+                
                 
             protected:
             
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -58,27 +60,36 @@ namespace storm {
                 }
                 
                 while(!this->maxStepsPerformed(env)) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Get the halfspaces of the underApproximation together with their maximal distance to a vertex of the overApproximation
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType halfspaceDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
-                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                            if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
-                                farestDistance = distance;
-                            }
+                            halfspaceDistance = std::max(halfspaceDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+                        }
+                        if(halfspaceDistance >= storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+                            halfspaceDistances.emplace_back(halfspaceDistance, halfspaceIndex);
                         }
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+                    if(halfspaceDistances.empty()) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(env, std::move(direction));
+                    
+                    // Refine in the direction of the halfspaces with maximal distance. Stable sorting retains the first of several halfspaces with the same distance.
+                    std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [] (std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) { return lhs.first > rhs.first; });
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+                    uint_fast64_t numberOfSteps = std::min<uint_fast64_t>(env.modelchecker().multi().getNumberOfConcurrentSteps(), halfspaceDistances.size());
+                    if (env.modelchecker().multi().isMaxStepsSet()) {
+                        numberOfSteps = std::min<uint_fast64_t>(numberOfSteps, env.modelchecker().multi().getMaxSteps() - this->refinementSteps.size());
+                    }
+                    std::vector<WeightVector> directions;
+                    for(uint_fast64_t step = 0; step < numberOfSteps; ++step) {
+                        directions.push_back(underApproxHalfspaces[halfspaceDistances[step].second].normalVector());
+                    }
+                    this->performRefinementSteps(env, std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Exceeded maximum number of refinement steps");
             }
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <mutex>
+#include <thread>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -23,6 +26,8 @@ namespace storm {
                 originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
 
                 this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
+                // Numbers other than doubles might share (non thread-safe) data between copies.
+                this->concurrentChecksSupported = std::is_same<typename SparseModelType::ValueType, double>::value;
 
                 this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
                 this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
@@ -76,11 +81,80 @@ namespace storm {
                 // Normalize the direction vector so that the entries sum up to one
                 storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
                 weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                refinementSteps.push_back(createRefinementStep(std::move(direction), *weightVectorChecker));
+                
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+                // Make sure that there is a weight vector checker for each direction.
+                while (concurrentChecksSupported && directions.size() > additionalWeightVectorCheckers.size() + 1) {
+                    std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> checker = weightVectorChecker->clone();
+                    if (checker) {
+                        additionalWeightVectorCheckers.push_back(std::move(checker));
+                    } else {
+                        STORM_LOG_WARN("The weight vector checker can not be copied. Refinement steps are performed sequentially.");
+                        concurrentChecksSupported = false;
+                    }
+                }
+                if (!concurrentChecksSupported || directions.size() == 1) {
+                    for (auto& direction : directions) {
+                        performRefinementStep(env, std::move(direction));
+                    }
+                    return;
+                }
+                
+                // Normalize the direction vectors so that the entries sum up to one
+                std::vector<std::vector<typename SparseModelType::ValueType>> weightVectors;
+                std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+                for (uint_fast64_t index = 0; index < directions.size(); ++index) {
+                    storm::utility::vector::scaleVectorInPlace(directions[index], storm::utility::one<GeometryValueType>() / std::accumulate(directions[index].begin(), directions[index].end(), storm::utility::zero<GeometryValueType>()));
+                    weightVectors.push_back(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[index]));
+                    checkers.push_back(index == 0 ? weightVectorChecker.get() : additionalWeightVectorCheckers[index - 1].get());
+                }
+                
+                STORM_LOG_DEBUG("Checking " << directions.size() << " weight vectors concurrently.");
+                std::mutex exceptionMutex;
+                std::exception_ptr exception;
+                auto worker = [&] (uint_fast64_t index) {
+                    try {
+                        checkers[index]->check(env, weightVectors[index]);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(exceptionMutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (uint_fast64_t index = 1; index < directions.size(); ++index) {
+                    threads.emplace_back(worker, index);
+                }
+                worker(0);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+                
+                // Incorporate the results in the order of the directions.
+                for (uint_fast64_t index = 0; index < directions.size(); ++index) {
+                    refinementSteps.push_back(createRefinementStep(std::move(directions[index]), *checkers[index]));
+                    updateOverApproximation();
+                }
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::createRefinementStep(WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType> const& checker) const {
+                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
                 RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+                step.weightVector = std::move(direction);
+                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
                 // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -88,10 +162,7 @@ namespace storm {
                         step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
                     }
                 }
-                refinementSteps.push_back(std::move(step));
-                
-                updateOverApproximation();
-                updateUnderApproximation();
+                return step;
             }
             
             template <class SparseModelType, typename GeometryValueType>
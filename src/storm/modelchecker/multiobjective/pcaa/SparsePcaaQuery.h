@@ -70,6 +70,17 @@ namespace storm {
                  */
                 void performRefinementStep(Environment const& env, WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. the given direction vectors. The weight vectors are checked concurrently
+                 * by copies of the weight vector checker (if the model has floating point values and the checker can be copied).
+                 */
+                void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+                
+                /*
+                 * Creates the refinement step for the given (normalized) direction from the results of the given weight vector checker.
+                 */
+                RefinementStep createRefinementStep(WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType> const& checker) const;
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -103,6 +114,10 @@ namespace storm {
                 
                 // The corresponding weight vector checker
                 std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                // Copies of the weight vector checker that are used to check weight vectors concurrently
+                std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+                // Whether weight vectors can be checked concurrently
+                bool concurrentChecksSupported;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
@@ -29,24 +29,29 @@ namespace storm {
             }
             
             template <class SparseMaModelType>
-            void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSpecificData(SparseMaModelType const& model) {
+            std::unique_ptr<PcaaWeightVectorChecker<SparseMaModelType>> StandardMaPcaaWeightVectorChecker<SparseMaModelType>::clone() const {
+                return std::make_unique<StandardMaPcaaWeightVectorChecker<SparseMaModelType>>(*this);
+            }
+            
+            template <class SparseMaModelType>
+            void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSpecificData(SparseMaModelType const& model, typename StandardPcaaWeightVectorChecker<SparseMaModelType>::ModelData& modelData) {
                 
                 markovianStates = model.getMarkovianStates();
                 exitRates = model.getExitRates();
                 
                 // Set the (discretized) state action rewards.
-                this->actionRewards.resize(this->objectives.size());
+                modelData.actionRewards.resize(this->objectives.size());
                 for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     auto const& formula = *this->objectives[objIndex].formula;
                     STORM_LOG_THROW(formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().hasRewardModelName(), storm::exceptions::UnexpectedException, "Unexpected type of operator formula: " << formula);
                     typename SparseMaModelType::RewardModelType const& rewModel = model.getRewardModel(formula.asRewardOperatorFormula().getRewardModelName());
                     STORM_LOG_ASSERT(!rewModel.hasTransitionRewards(), "Preprocessed Reward model has transition rewards which is not expected.");
-                    this->actionRewards[objIndex] = rewModel.hasStateActionRewards() ? rewModel.getStateActionRewardVector() : std::vector<ValueType>(model.getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
+                    modelData.actionRewards[objIndex] = rewModel.hasStateActionRewards() ? rewModel.getStateActionRewardVector() : std::vector<ValueType>(model.getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
                     if (formula.getSubformula().isTotalRewardFormula()) {
                         if (rewModel.hasStateRewards()) {
                             // Note that state rewards are earned over time and thus play no role for probabilistic states
                             for (auto markovianState : markovianStates) {
-                                this->actionRewards[objIndex][model.getTransitionMatrix().getRowGroupIndices()[markovianState]] += rewModel.getStateReward(markovianState) / exitRates[markovianState];
+                                modelData.actionRewards[objIndex][model.getTransitionMatrix().getRowGroupIndices()[markovianState]] += rewModel.getStateReward(markovianState) / exitRates[markovianState];
                             }
                         }
                     } else {
@@ -121,19 +126,19 @@ namespace storm {
                 
                 storm::storage::BitVector probabilisticStates = ~markovianStates;
                 result.states = createMS ? markovianStates : probabilisticStates;
-                result.choices = this->transitionMatrix.getRowFilter(result.states);
+                result.choices = this->modelData->transitionMatrix.getRowFilter(result.states);
                 STORM_LOG_ASSERT(!createMS || result.states.getNumberOfSetBits() == result.choices.getNumberOfSetBits(), "row groups for Markovian states should consist of exactly one row");
                 
                 //We need to add diagonal entries for selfloops on Markovian states.
-                result.toMS = this->transitionMatrix.getSubmatrix(true, result.states, markovianStates, createMS);
-                result.toPS = this->transitionMatrix.getSubmatrix(true, result.states, probabilisticStates, false);
+                result.toMS = this->modelData->transitionMatrix.getSubmatrix(true, result.states, markovianStates, createMS);
+                result.toPS = this->modelData->transitionMatrix.getSubmatrix(true, result.states, probabilisticStates, false);
                 STORM_LOG_ASSERT(result.getNumberOfStates() == result.states.getNumberOfSetBits() && result.getNumberOfStates() == result.toMS.getRowGroupCount() && result.getNumberOfStates() == result.toPS.getRowGroupCount(), "Invalid state count for subsystem");
                 STORM_LOG_ASSERT(result.getNumberOfChoices() == result.choices.getNumberOfSetBits() && result.getNumberOfChoices() == result.toMS.getRowCount() && result.getNumberOfChoices() == result.toPS.getRowCount(), "Invalid choice count for subsystem");
                 
                 result.weightedRewardVector.resize(result.getNumberOfChoices());
                 storm::utility::vector::selectVectorValues(result.weightedRewardVector, result.choices, weightedRewardVector);
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-                    std::vector<ValueType> const& objRewards = this->actionRewards[objIndex];
+                    std::vector<ValueType> const& objRewards = this->modelData->actionRewards[objIndex];
                     std::vector<ValueType> subModelObjRewards;
                     subModelObjRewards.reserve(result.getNumberOfChoices());
                     for (auto const& choice : result.choices) {
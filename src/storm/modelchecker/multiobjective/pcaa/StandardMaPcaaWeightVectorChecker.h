@@ -27,9 +27,11 @@ namespace storm {
                 StandardMaPcaaWeightVectorChecker(SparseMultiObjectivePreprocessorResult<SparseMaModelType> const& preprocessorResult);
                 
                 virtual ~StandardMaPcaaWeightVectorChecker() = default;
+                
+                virtual std::unique_ptr<PcaaWeightVectorChecker<SparseMaModelType>> clone() const override;
 
             protected:
-                virtual void initializeModelTypeSpecificData(SparseMaModelType const& model) override;
+                virtual void initializeModelTypeSpecificData(SparseMaModelType const& model, typename StandardPcaaWeightVectorChecker<SparseMaModelType>::ModelData& modelData) override;
 
             private:
                 
@@ -35,9 +35,11 @@ namespace storm {
                 StandardMdpPcaaWeightVectorChecker(SparseMultiObjectivePreprocessorResult<SparseMdpModelType> const& preprocessorResult);
 
                 virtual ~StandardMdpPcaaWeightVectorChecker() = default;
+                
+                virtual std::unique_ptr<PcaaWeightVectorChecker<SparseMdpModelType>> clone() const override;
 
             protected:
-                virtual void initializeModelTypeSpecificData(SparseMdpModelType const& model) override;
+                virtual void initializeModelTypeSpecificData(SparseMdpModelType const& model, typename StandardPcaaWeightVectorChecker<SparseMdpModelType>::ModelData& modelData) override;
 
             private:
                 
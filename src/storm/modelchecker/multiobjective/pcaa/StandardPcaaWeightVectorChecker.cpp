@@ -52,43 +52,48 @@ namespace storm {
                 storm::transformer::GoalStateMerger<SparseModelType> merger(*preprocessorResult.preprocessedModel);
                 auto mergerResult = merger.mergeTargetAndSinkStates(maybeStates, preprocessorResult.reward0AStates, storm::storage::BitVector(maybeStates.size(), false), std::vector<std::string>(relevantRewardModels.begin(), relevantRewardModels.end()), finiteRewardChoices);
                 
+                // The model data is shared among all copies of this checker and not changed after its initialization
+                std::shared_ptr<ModelData> data = std::make_shared<ModelData>();
+                
                 // Initialize data specific for the considered model type
-                initializeModelTypeSpecificData(*mergerResult.model);
+                initializeModelTypeSpecificData(*mergerResult.model, *data);
                 
                 // Initilize general data of the model
-                transitionMatrix = std::move(mergerResult.model->getTransitionMatrix());
+                data->transitionMatrix = std::move(mergerResult.model->getTransitionMatrix());
                 initialState = *mergerResult.model->getInitialStates().begin();
-                reward0EStates = preprocessorResult.reward0EStates % maybeStates;
+                data->reward0EStates = preprocessorResult.reward0EStates % maybeStates;
                 if (mergerResult.targetState) {
                     // There is an additional state in the result
-                    reward0EStates.resize(reward0EStates.size() + 1, true);
+                    data->reward0EStates.resize(data->reward0EStates.size() + 1, true);
                     
                     // The overapproximation for the possible ec choices consists of the states that can reach the target states with prob. 0 and the target state itself.
-                    storm::storage::BitVector targetStateAsVector(transitionMatrix.getRowGroupCount(), false);
+                    storm::storage::BitVector targetStateAsVector(data->transitionMatrix.getRowGroupCount(), false);
                     targetStateAsVector.set(*mergerResult.targetState, true);
-                    ecChoicesHint = transitionMatrix.getRowFilter(storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), transitionMatrix.transpose(true), storm::storage::BitVector(targetStateAsVector.size(), true), targetStateAsVector));
-                    ecChoicesHint.set(transitionMatrix.getRowGroupIndices()[*mergerResult.targetState], true);
+                    data->ecChoicesHint = data->transitionMatrix.getRowFilter(storm::utility::graph::performProb0E(data->transitionMatrix, data->transitionMatrix.getRowGroupIndices(), data->transitionMatrix.transpose(true), storm::storage::BitVector(targetStateAsVector.size(), true), targetStateAsVector));
+                    data->ecChoicesHint.set(data->transitionMatrix.getRowGroupIndices()[*mergerResult.targetState], true);
                 } else {
-                    ecChoicesHint = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+                    data->ecChoicesHint = storm::storage::BitVector(data->transitionMatrix.getRowCount(), true);
                 }
                 
                 // set data for unbounded objectives
                 objectivesWithNoUpperTimeBound = storm::storage::BitVector(this->objectives.size(), false);
-                actionsWithoutRewardInUnboundedPhase = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+                data->actionsWithoutRewardInUnboundedPhase = storm::storage::BitVector(data->transitionMatrix.getRowCount(), true);
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     auto const& formula = *this->objectives[objIndex].formula;
                     if (formula.getSubformula().isTotalRewardFormula()) {
                         objectivesWithNoUpperTimeBound.set(objIndex, true);
-                        actionsWithoutRewardInUnboundedPhase &= storm::utility::vector::filterZero(actionRewards[objIndex]);
+                        data->actionsWithoutRewardInUnboundedPhase &= storm::utility::vector::filterZero(data->actionRewards[objIndex]);
                     }
                 }
                 
+                modelData = std::move(data);
+                
                 // initialize data for the results
                 checkHasBeenCalled = false;
                 objectiveResults.resize(this->objectives.size());
                 offsetsToUnderApproximation.resize(this->objectives.size(), storm::utility::zero<ValueType>());
                 offsetsToOverApproximation.resize(this->objectives.size(), storm::utility::zero<ValueType>());
-                optimalChoices.resize(transitionMatrix.getRowGroupCount(), 0);
+                optimalChoices.resize(modelData->transitionMatrix.getRowGroupCount(), 0);
             }
 
             
@@ -97,12 +102,12 @@ namespace storm {
                 checkHasBeenCalled = true;
                 STORM_LOG_INFO("Invoked WeightVectorChecker with weights " << std::endl << "\t" << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVector)));
                 
-                std::vector<ValueType> weightedRewardVector(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> weightedRewardVector(modelData->transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 for (auto objIndex : objectivesWithNoUpperTimeBound) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-                        storm::utility::vector::addScaledVector(weightedRewardVector, actionRewards[objIndex], -weightVector[objIndex]);
+                        storm::utility::vector::addScaledVector(weightedRewardVector, modelData->actionRewards[objIndex], -weightVector[objIndex]);
                     } else {
-                        storm::utility::vector::addScaledVector(weightedRewardVector, actionRewards[objIndex], weightVector[objIndex]);
+                        storm::utility::vector::addScaledVector(weightedRewardVector, modelData->actionRewards[objIndex], weightVector[objIndex]);
                     }
                 }
                 
@@ -165,14 +170,14 @@ namespace storm {
             void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(Environment const& env, std::vector<ValueType> const& weightedRewardVector, std::vector<ValueType> const& weightVector) {
                 
                 if (this->objectivesWithNoUpperTimeBound.empty() || !storm::utility::vector::hasNonZeroEntry(weightedRewardVector)) {
-                    this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                    this->optimalChoices = std::vector<uint_fast64_t>(transitionMatrix.getRowGroupCount(), 0);
+                    this->weightedResult = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                    this->optimalChoices = std::vector<uint_fast64_t>(modelData->transitionMatrix.getRowGroupCount(), 0);
                     return;
                 }
                 
                 updateEcQuotient(weightedRewardVector);
                 
-                storm::utility::vector::selectVectorValues(ecQuotient->auxChoiceValues, ecQuotient->ecqToOriginalChoiceMapping, weightedRewardVector);
+                storm::utility::vector::selectVectorValues(ecQuotientAuxChoiceValues, ecQuotient->ecqToOriginalChoiceMapping, weightedRewardVector);
                 
                 storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> solverFactory;
                 std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = solverFactory.create(env, ecQuotient->matrix);
@@ -180,7 +185,7 @@ namespace storm {
                 solver->setHasUniqueSolution(true);
                 solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
                 auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
-                setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix, ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
+                setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix, ecQuotient->rowsWithSumLessOne, ecQuotientAuxChoiceValues);
                 if (solver->hasLowerBound()) {
                     req.clearLowerBounds();
                 }
@@ -191,12 +196,12 @@ namespace storm {
                 solver->setRequirementsChecked(true);
                 
                 // Use the (0...0) vector as initial guess for the solution.
-                std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+                std::fill(ecQuotientAuxStateValues.begin(), ecQuotientAuxStateValues.end(), storm::utility::zero<ValueType>());
                 
-                solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
-                this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
+                solver->solveEquations(env, ecQuotientAuxStateValues, ecQuotientAuxChoiceValues);
+                this->weightedResult = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount());
                 
-                transformReducedSolutionToOriginalModel(ecQuotient->matrix, ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecQuotient->ecqToOriginalChoiceMapping, ecQuotient->originalToEcqStateMapping, this->weightedResult, this->optimalChoices);
+                transformReducedSolutionToOriginalModel(ecQuotient->matrix, ecQuotientAuxStateValues, solver->getSchedulerChoices(), ecQuotient->ecqToOriginalChoiceMapping, ecQuotient->originalToEcqStateMapping, this->weightedResult, this->optimalChoices);
             }
             
             template <class SparseModelType>
@@ -209,62 +214,94 @@ namespace storm {
                    }
                    for (uint_fast64_t objIndex2 = 0; objIndex2 < this->objectives.size(); ++objIndex2) {
                        if (objIndex != objIndex2) {
-                           objectiveResults[objIndex2] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                           objectiveResults[objIndex2] = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                        }
                    }
                 } else {
-                   storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, true);
+                   storm::storage::SparseMatrix<ValueType> deterministicMatrix = modelData->transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, true);
                    storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
-                   std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());
                    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                   bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                   // Objectives with the same maybestates share the equation system. If the solver does not need bounds
+                   // (which are specific to an objective), we solve them for all their right-hand sides at once.
+                   bool solveObjectivesJointly = !linearEquationSolverFactory.getRequirements(env).hasEnabledRequirement();
+
+                   // Compute the rewards of the induced DTMC and the states from which a state with reward is reachable.
+                   std::vector<std::vector<ValueType>> deterministicStateRewards(this->objectives.size());
+                   std::vector<storm::storage::BitVector> maybeStates(this->objectives.size());
+                   for (auto const& objIndex : objectivesWithNoUpperTimeBound) {
+                       offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
+                       offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
+                       deterministicStateRewards[objIndex].resize(deterministicMatrix.getRowCount());
+                       storm::utility::vector::selectVectorValues(deterministicStateRewards[objIndex], this->optimalChoices, modelData->transitionMatrix.getRowGroupIndices(), modelData->actionRewards[objIndex]);
+                       storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards[objIndex]);
+                       maybeStates[objIndex] = storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+                   }
 
                    // We compute an estimate for the results of the individual objectives which is obtained from the weighted result and the result of the objectives computed so far.
                    // Note that weightedResult = Sum_{i=1}^{n} w_i * objectiveResult_i.
                    std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
                    ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
-                   for (uint_fast64_t const &objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
-                       auto const& obj = this->objectives[objIndex];
-                       if (objectivesWithNoUpperTimeBound.get(objIndex)) {
-                           offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
-                           offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
-                           storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(), actionRewards[objIndex]);
-                           storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
-                           // As maybestates we pick the states from which a state with reward is reachable
-                           storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+                   std::vector<uint_fast64_t> sortedObjectiveIndices = storm::utility::vector::getSortedIndices(weightVector);
+                   storm::storage::BitVector checkedObjectives(this->objectives.size(), false);
+                   for (auto objIt = sortedObjectiveIndices.begin(); objIt != sortedObjectiveIndices.end(); ++objIt) {
+                       uint_fast64_t const& objIndex = *objIt;
+                       if (!objectivesWithNoUpperTimeBound.get(objIndex)) {
+                           objectiveResults[objIndex] = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                           continue;
+                       }
+                       if (checkedObjectives.get(objIndex)) {
+                           continue;
+                       }
+                       storm::storage::BitVector const& objMaybeStates = maybeStates[objIndex];
+
+                       // Gather the (unchecked) objectives that are checked together with this one.
+                       std::vector<uint64_t> objectivesToCheck = {objIndex};
+                       if (solveObjectivesJointly && !objMaybeStates.empty()) {
+                           for (auto otherObjIt = objIt + 1; otherObjIt != sortedObjectiveIndices.end(); ++otherObjIt) {
+                               if (objectivesWithNoUpperTimeBound.get(*otherObjIt) && !checkedObjectives.get(*otherObjIt) && maybeStates[*otherObjIt] == objMaybeStates) {
+                                   objectivesToCheck.push_back(*otherObjIt);
+                               }
+                           }
+                       }
 
+                       for (auto const& checkedObjIndex : objectivesToCheck) {
+                           checkedObjectives.set(checkedObjIndex, true);
+                           auto const& obj = this->objectives[checkedObjIndex];
                            // Compute the estimate for this objective
-                           if (!storm::utility::isZero(weightVector[objIndex])) {
-                               objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
+                           if (!storm::utility::isZero(weightVector[checkedObjIndex])) {
+                               objectiveResults[checkedObjIndex] = weightedSumOfUncheckedObjectives;
                                ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
                                if (storm::solver::minimize(obj.formula->getOptimalityType())) {
                                    scalingFactor *= -storm::utility::one<ValueType>();
                                }
-                               storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
-                               storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
+                               storm::utility::vector::scaleVectorInPlace(objectiveResults[checkedObjIndex], scalingFactor);
+                               storm::utility::vector::clip(objectiveResults[checkedObjIndex], obj.lowerResultBound, obj.upperResultBound);
                            }
                            // Make sure that the objectiveResult is initialized correctly
-                           objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                           objectiveResults[checkedObjIndex].resize(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                       }
 
-                           if (!maybeStates.empty()) {
-                               bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-                               storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(
-                                       true, maybeStates, maybeStates, needEquationSystem);
-                               if (needEquationSystem) {
-                                   // Converting the matrix from the fixpoint notation to the form needed for the equation
-                                   // system. That is, we go from x = A*x + b to (I-A)x = b.
-                                   submatrix.convertToEquationSystem();
-                               }
+                       if (!objMaybeStates.empty()) {
+                           storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(
+                                   true, objMaybeStates, objMaybeStates, needEquationSystem);
+                           if (needEquationSystem) {
+                               // Converting the matrix from the fixpoint notation to the form needed for the equation
+                               // system. That is, we go from x = A*x + b to (I-A)x = b.
+                               submatrix.convertToEquationSystem();
+                           }
 
+                           if (objectivesToCheck.size() == 1) {
                                // Prepare solution vector and rhs of the equation system.
-                               std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                               std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
+                               std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], objMaybeStates);
+                               std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards[objIndex], objMaybeStates);
 
                                // Now solve the resulting equation system.
                                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
                                auto req = solver->getRequirements(env);
                                solver->clearBounds();
-                               storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
+                               storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(objMaybeStates, objMaybeStates) % objMaybeStates;
                                submatrixRowsWithSumLessOne.complement();
                                this->setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), objIndex, submatrix, submatrixRowsWithSumLessOne, b);
                                if (solver->hasLowerBound()) {
@@ -276,17 +313,30 @@ namespace storm {
                                STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
                                solver->solveEquations(env, x, b);
                                // Set the result for this objective accordingly
-                               storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
+                               storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], objMaybeStates, x);
+                           } else {
+                               // Prepare the solution vectors and right-hand sides of all objectives and solve them at once.
+                               std::vector<std::vector<ValueType>> x, b;
+                               for (auto const& checkedObjIndex : objectivesToCheck) {
+                                   x.push_back(storm::utility::vector::filterVector(objectiveResults[checkedObjIndex], objMaybeStates));
+                                   b.push_back(storm::utility::vector::filterVector(deterministicStateRewards[checkedObjIndex], objMaybeStates));
+                               }
+                               std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(submatrix));
+                               solver->solveEquations(env, x, b);
+                               for (uint64_t i = 0; i < objectivesToCheck.size(); ++i) {
+                                   storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objectivesToCheck[i]], objMaybeStates, x[i]);
+                               }
                            }
-                           storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+                       }
+
+                       for (auto const& checkedObjIndex : objectivesToCheck) {
+                           storm::utility::vector::setVectorValues<ValueType>(objectiveResults[checkedObjIndex], ~objMaybeStates, storm::utility::zero<ValueType>());
 
                            // Update the estimate for the next objectives.
-                           if (!storm::utility::isZero(weightVector[objIndex])) {
-                               storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
-                               sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+                           if (!storm::utility::isZero(weightVector[checkedObjIndex])) {
+                               storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[checkedObjIndex], -weightVector[checkedObjIndex]);
+                               sumOfWeightsOfUncheckedObjectives -= weightVector[checkedObjIndex];
                            }
-                       } else {
-                           objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                        }
                    }
                }
@@ -299,23 +349,23 @@ namespace storm {
                 if (!ecQuotient || ecQuotient->origReward0Choices != newReward0Choices) {
                     
                     // It is sufficient to consider the states from which a transition with non-zero reward is reachable. (The remaining states always have reward zero).
-                    storm::storage::BitVector nonZeroRewardStates(transitionMatrix.getRowGroupCount(), false);
-                    for (uint_fast64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state){
-                        if (newReward0Choices.getNextUnsetIndex(transitionMatrix.getRowGroupIndices()[state]) < transitionMatrix.getRowGroupIndices()[state+1]) {
+                    storm::storage::BitVector nonZeroRewardStates(modelData->transitionMatrix.getRowGroupCount(), false);
+                    for (uint_fast64_t state = 0; state < modelData->transitionMatrix.getRowGroupCount(); ++state){
+                        if (newReward0Choices.getNextUnsetIndex(modelData->transitionMatrix.getRowGroupIndices()[state]) < modelData->transitionMatrix.getRowGroupIndices()[state+1]) {
                             nonZeroRewardStates.set(state);
                         }
                     }
-                    storm::storage::BitVector subsystemStates = storm::utility::graph::performProbGreater0E(transitionMatrix.transpose(true), storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), nonZeroRewardStates);
+                    storm::storage::BitVector subsystemStates = storm::utility::graph::performProbGreater0E(modelData->transitionMatrix.transpose(true), storm::storage::BitVector(modelData->transitionMatrix.getRowGroupCount(), true), nonZeroRewardStates);
                 
                     // Remove neutral end components, i.e., ECs in which no reward is earned.
-                    auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(transitionMatrix, subsystemStates, ecChoicesHint & newReward0Choices, reward0EStates);
+                    auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(modelData->transitionMatrix, subsystemStates, modelData->ecChoicesHint & newReward0Choices, modelData->reward0EStates);
                     
                     storm::storage::BitVector rowsWithSumLessOne(ecElimResult.matrix.getRowCount(), false);
                     for (uint64_t row = 0; row < rowsWithSumLessOne.size(); ++row) {
                         if (ecElimResult.matrix.getRow(row).getNumberOfEntries() == 0) {
                             rowsWithSumLessOne.set(row, true);
                         } else {
-                            for (auto const& entry : transitionMatrix.getRow(ecElimResult.newToOldRowMapping[row])) {
+                            for (auto const& entry : modelData->transitionMatrix.getRow(ecElimResult.newToOldRowMapping[row])) {
                                 if (!subsystemStates.get(entry.getColumn())) {
                                     rowsWithSumLessOne.set(row, true);
                                     break;
@@ -324,16 +374,18 @@ namespace storm {
                         }
                     }
                     
-                    ecQuotient = EcQuotient();
-                    ecQuotient->matrix = std::move(ecElimResult.matrix);
-                    ecQuotient->ecqToOriginalChoiceMapping = std::move(ecElimResult.newToOldRowMapping);
-                    ecQuotient->originalToEcqStateMapping = std::move(ecElimResult.oldToNewStateMapping);
-                    ecQuotient->origReward0Choices = std::move(newReward0Choices);
-                    ecQuotient->rowsWithSumLessOne = std::move(rowsWithSumLessOne);
-                    ecQuotient->auxStateValues.reserve(transitionMatrix.getRowGroupCount());
-                    ecQuotient->auxStateValues.resize(ecQuotient->matrix.getRowGroupCount());
-                    ecQuotient->auxChoiceValues.reserve(transitionMatrix.getRowCount());
-                    ecQuotient->auxChoiceValues.resize(ecQuotient->matrix.getRowCount());
+                    // The quotient is not changed afterwards, so copies of this checker can share it until they need a different one.
+                    std::shared_ptr<EcQuotient> newEcQuotient = std::make_shared<EcQuotient>();
+                    newEcQuotient->matrix = std::move(ecElimResult.matrix);
+                    newEcQuotient->ecqToOriginalChoiceMapping = std::move(ecElimResult.newToOldRowMapping);
+                    newEcQuotient->originalToEcqStateMapping = std::move(ecElimResult.oldToNewStateMapping);
+                    newEcQuotient->origReward0Choices = std::move(newReward0Choices);
+                    newEcQuotient->rowsWithSumLessOne = std::move(rowsWithSumLessOne);
+                    ecQuotient = std::move(newEcQuotient);
+                    ecQuotientAuxStateValues.reserve(modelData->transitionMatrix.getRowGroupCount());
+                    ecQuotientAuxStateValues.resize(ecQuotient->matrix.getRowGroupCount());
+                    ecQuotientAuxChoiceValues.reserve(modelData->transitionMatrix.getRowCount());
+                    ecQuotientAuxChoiceValues.resize(ecQuotient->matrix.getRowCount());
                 }
             }
 
@@ -432,13 +484,13 @@ namespace storm {
                                                          std::vector<ValueType>& originalSolution,
                                                          std::vector<uint_fast64_t>& originalOptimalChoices) const {
                 
-                storm::storage::BitVector bottomStates(transitionMatrix.getRowGroupCount(), false);
-                storm::storage::BitVector statesThatShouldStayInTheirEC(transitionMatrix.getRowGroupCount(), false);
-                storm::storage::BitVector statesWithUndefSched(transitionMatrix.getRowGroupCount(), false);
+                storm::storage::BitVector bottomStates(modelData->transitionMatrix.getRowGroupCount(), false);
+                storm::storage::BitVector statesThatShouldStayInTheirEC(modelData->transitionMatrix.getRowGroupCount(), false);
+                storm::storage::BitVector statesWithUndefSched(modelData->transitionMatrix.getRowGroupCount(), false);
                 
                 // Handle all the states for which the choice in the original model is uniquely given by the choice in the reduced model
                 // Also store some information regarding the remaining states
-                for (uint_fast64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                for (uint_fast64_t state = 0; state < modelData->transitionMatrix.getRowGroupCount(); ++state) {
                     // Check if the state exists in the reduced model, i.e., the mapping retrieves a valid index
                     uint_fast64_t stateInReducedModel = originalToReducedStateMapping[state];
                     if (stateInReducedModel < reducedMatrix.getRowGroupCount()) {
@@ -446,8 +498,8 @@ namespace storm {
                         uint_fast64_t chosenRowInReducedModel = reducedMatrix.getRowGroupIndices()[stateInReducedModel] + reducedOptimalChoices[stateInReducedModel];
                         uint_fast64_t chosenRowInOriginalModel = reducedToOriginalChoiceMapping[chosenRowInReducedModel];
                         // Check if the state is a bottom state, i.e., the chosen row stays inside its EC.
-                        bool stateIsBottom = reward0EStates.get(state);
-                        for (auto const& entry : transitionMatrix.getRow(chosenRowInOriginalModel)) {
+                        bool stateIsBottom = modelData->reward0EStates.get(state);
+                        for (auto const& entry : modelData->transitionMatrix.getRow(chosenRowInOriginalModel)) {
                             stateIsBottom &= originalToReducedStateMapping[entry.getColumn()] == stateInReducedModel;
                         }
                         if (stateIsBottom) {
@@ -455,9 +507,9 @@ namespace storm {
                             statesThatShouldStayInTheirEC.set(state);
                         } else {
                             // Check if the chosen row originaly belonged to the current state (and not to another state of the EC)
-                            if (chosenRowInOriginalModel >= transitionMatrix.getRowGroupIndices()[state] &&
-                               chosenRowInOriginalModel <  transitionMatrix.getRowGroupIndices()[state+1]) {
-                                originalOptimalChoices[state] = chosenRowInOriginalModel - transitionMatrix.getRowGroupIndices()[state];
+                            if (chosenRowInOriginalModel >= modelData->transitionMatrix.getRowGroupIndices()[state] &&
+                               chosenRowInOriginalModel <  modelData->transitionMatrix.getRowGroupIndices()[state+1]) {
+                                originalOptimalChoices[state] = chosenRowInOriginalModel - modelData->transitionMatrix.getRowGroupIndices()[state];
                             } else {
                                 statesWithUndefSched.set(state);
                                 statesThatShouldStayInTheirEC.set(state);
@@ -468,7 +520,7 @@ namespace storm {
                         originalSolution[state] = storm::utility::zero<ValueType>();
                         // However, it might be the case that infinite reward is induced for an objective with weight 0.
                         // To avoid this, all possible bottom states are made bottom and the remaining states have to reach a bottom state with prob. one
-                        if (reward0EStates.get(state)) {
+                        if (modelData->reward0EStates.get(state)) {
                             bottomStates.set(state);
                         } else {
                             statesWithUndefSched.set(state);
@@ -482,16 +534,16 @@ namespace storm {
                     // Find a row with zero rewards that only leads to bottom states.
                     // If the state should stay in its EC, we also need to make sure that all successors map to the same state in the reduced model
                     uint_fast64_t stateInReducedModel = originalToReducedStateMapping[state];
-                    for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state+1]; ++row) {
+                    for (uint_fast64_t row = modelData->transitionMatrix.getRowGroupIndices()[state]; row < modelData->transitionMatrix.getRowGroupIndices()[state+1]; ++row) {
                         bool rowOnlyLeadsToBottomStates = true;
                         bool rowStaysInEC = true;
-                        for ( auto const& entry : transitionMatrix.getRow(row)) {
+                        for ( auto const& entry : modelData->transitionMatrix.getRow(row)) {
                             rowOnlyLeadsToBottomStates &= bottomStates.get(entry.getColumn());
                             rowStaysInEC &= originalToReducedStateMapping[entry.getColumn()] == stateInReducedModel;
                         }
-                        if (rowOnlyLeadsToBottomStates && (rowStaysInEC || !statesThatShouldStayInTheirEC.get(state)) && actionsWithoutRewardInUnboundedPhase.get(row)) {
+                        if (rowOnlyLeadsToBottomStates && (rowStaysInEC || !statesThatShouldStayInTheirEC.get(state)) && modelData->actionsWithoutRewardInUnboundedPhase.get(row)) {
                             foundRowForState = true;
-                            originalOptimalChoices[state] = row - transitionMatrix.getRowGroupIndices()[state];
+                            originalOptimalChoices[state] = row - modelData->transitionMatrix.getRowGroupIndices()[state];
                             break;
                         }
                     }
@@ -503,15 +555,15 @@ namespace storm {
                     for (auto state : statesWithUndefSched) {
                         // Iteratively Try to find a choice such that at least one successor has a defined scheduler.
                         uint_fast64_t stateInReducedModel = originalToReducedStateMapping[state];
-                        for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state+1]; ++row) {
+                        for (uint_fast64_t row = modelData->transitionMatrix.getRowGroupIndices()[state]; row < modelData->transitionMatrix.getRowGroupIndices()[state+1]; ++row) {
                             bool rowStaysInEC = true;
                             bool rowLeadsToDefinedScheduler = false;
-                            for (auto const& entry : transitionMatrix.getRow(row)) {
+                            for (auto const& entry : modelData->transitionMatrix.getRow(row)) {
                                 rowStaysInEC &= ( stateInReducedModel == originalToReducedStateMapping[entry.getColumn()]);
                                 rowLeadsToDefinedScheduler |= !statesWithUndefSched.get(entry.getColumn());
                             }
                             if (rowLeadsToDefinedScheduler && (rowStaysInEC || !statesThatShouldStayInTheirEC.get(state))) {
-                                originalOptimalChoices[state] = row - transitionMatrix.getRowGroupIndices()[state];
+                                originalOptimalChoices[state] = row - modelData->transitionMatrix.getRowGroupIndices()[state];
                                 statesWithUndefSched.set(state, false);
                             }
                         }
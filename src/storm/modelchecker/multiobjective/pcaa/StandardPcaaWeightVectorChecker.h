@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/solver/AbstractEquationSolver.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -63,8 +65,29 @@ namespace storm {
                 
             protected:
                 
+                /*
+                 * Stores the data regarding the considered model. It is not changed after initialization and thus
+                 * shared among all copies of this checker.
+                 */
+                struct ModelData {
+                    // The transition matrix of the considered model
+                    storm::storage::SparseMatrix<ValueType> transitionMatrix;
+                    // Overapproximation of the set of choices that are part of an end component.
+                    storm::storage::BitVector ecChoicesHint;
+                    // The actions that have reward assigned for at least one objective without upper timeBound
+                    storm::storage::BitVector actionsWithoutRewardInUnboundedPhase;
+                    // The states for which there is a scheduler yielding reward 0 for each objective
+                    storm::storage::BitVector reward0EStates;
+                    // stores the state action rewards for each objective.
+                    std::vector<std::vector<ValueType>> actionRewards;
+                };
+                
                 void initialize(SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult);
-                virtual void initializeModelTypeSpecificData(SparseModelType const& model) = 0;
+                
+                /*!
+                 * Initializes the data specific for the considered model type, including the action rewards of the given model data.
+                 */
+                virtual void initializeModelTypeSpecificData(SparseModelType const& model, ModelData& modelData) = 0;
 
                 /*!
                  * Determines the scheduler that optimizes the weighted reward vector of the unbounded objectives
@@ -110,18 +133,9 @@ namespace storm {
                 
                 
                 // Data regarding the given model
-                // The transition matrix of the considered model
-                storm::storage::SparseMatrix<ValueType> transitionMatrix;
+                std::shared_ptr<ModelData const> modelData;
                 // The initial state of the considered model
                 uint64_t initialState;
-                // Overapproximation of the set of choices that are part of an end component.
-                storm::storage::BitVector ecChoicesHint;
-                // The actions that have reward assigned for at least one objective without upper timeBound
-                storm::storage::BitVector actionsWithoutRewardInUnboundedPhase;
-                // The states for which there is a scheduler yielding reward 0 for each objective
-                storm::storage::BitVector reward0EStates;
-                // stores the state action rewards for each objective.
-                std::vector<std::vector<ValueType>> actionRewards;
                 
                 // stores the indices of the objectives for which there is no upper time bound
                 storm::storage::BitVector objectivesWithNoUpperTimeBound;
@@ -146,13 +160,14 @@ namespace storm {
                     std::vector<uint_fast64_t> originalToEcqStateMapping;
                     storm::storage::BitVector origReward0Choices;
                     storm::storage::BitVector rowsWithSumLessOne;
-                    
-                    std::vector<ValueType> auxStateValues;
-                    std::vector<ValueType> auxChoiceValues;
-                    
                 };
                 
-                boost::optional<EcQuotient> ecQuotient;
+                // The most recent end component quotient. It is shared among copies of this checker until one of them requires a different one.
+                std::shared_ptr<EcQuotient const> ecQuotient;
+                
+                // Auxiliary values for the states and choices of the end component quotient
+                std::vector<ValueType> ecQuotientAuxStateValues;
+                std::vector<ValueType> ecQuotientAuxChoiceValues;
                 
             };
             
@@ -12,6 +12,10 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -30,6 +34,70 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
 
+            /*!
+             * Solves the equation system x = A x + b over the given maybe states by converting and solving the blocks
+             * of a topological decomposition one after another. This way, only the explicit representation of a
+             * single block has to be kept in memory at any time.
+             *
+             * @param submatrix The transition matrix restricted to the rows of maybe states.
+             * @param subvector The vector b.
+             * @param odd The ODD of the maybe states (which determines the order of the result).
+             * @param upperBound If given, an upper bound on the solution.
+             * @return The solution of the equation system.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::vector<ValueType> solveEquationSystemBlockwise(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Add<DdType, ValueType> const& subvector, storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Odd const& odd, boost::optional<ValueType> const& upperBound) {
+                storm::utility::Stopwatch decompositionWatch(true);
+                std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::graph::computeTopologicalBlocks(model, submatrix.notZero(), maybeStates, storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getHybridMinimalBlockSize());
+                decompositionWatch.stop();
+                STORM_LOG_INFO("Decomposed " << maybeStates.getNonZeroCount() << " maybe states into " << blocks.size() << " blocks in " << decompositionWatch.getTimeInMilliseconds() << "ms.");
+                
+                storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                
+                std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
+                storm::dd::Bdd<DdType> solvedStates = model.getManager().getBddZero();
+                storm::utility::Stopwatch conversionWatch;
+                for (auto const& block : blocks) {
+                    conversionWatch.start();
+                    storm::dd::Odd blockOdd = block.createOdd();
+                    storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> blockRows = submatrix * blockAdd;
+                    storm::dd::Add<DdType, ValueType> blockVector = subvector * blockAdd;
+                    
+                    // Add the contribution of the transitions to states of previously solved blocks to the vector.
+                    storm::dd::Bdd<DdType> solvedSuccessors = blockRows.notZero().existsAbstract(model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs()) && solvedStates;
+                    if (!solvedSuccessors.isZero()) {
+                        std::vector<ValueType> successorValues = storm::utility::vector::filterVector(x, solvedSuccessors.toVector(odd));
+                        storm::dd::Add<DdType, ValueType> successorValuesAsColumn = storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), successorValues, solvedSuccessors.createOdd(), model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs());
+                        blockVector += (blockRows * successorValuesAsColumn).sumAbstract(model.getColumnVariables());
+                    }
+                    
+                    storm::dd::Add<DdType, ValueType> blockMatrix = blockRows * blockAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    if (convertToEquationSystem) {
+                        blockMatrix = (model.getRowColumnIdentity() * blockAdd) - blockMatrix;
+                    }
+                    
+                    storm::storage::SparseMatrix<ValueType> explicitBlockMatrix = blockMatrix.toMatrix(blockOdd, blockOdd);
+                    std::vector<ValueType> b = blockVector.toVector(blockOdd);
+                    conversionWatch.stop();
+                    
+                    std::vector<ValueType> blockX(b.size(), storm::utility::convertNumber<ValueType>(0.5));
+                    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitBlockMatrix));
+                    solver->setLowerBound(storm::utility::zero<ValueType>());
+                    if (upperBound) {
+                        solver->setUpperBound(upperBound.get());
+                    }
+                    solver->solveEquations(env, blockX, b);
+                    
+                    storm::utility::vector::setVectorValues(x, block.toVector(odd), blockX);
+                    solvedStates |= block;
+                }
+                STORM_LOG_INFO("Converting symbolic matrix/vector blocks to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                
+                return x;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -74,6 +142,12 @@ namespace storm {
                         req.clearUpperBounds();
                         STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
                         
+                        // If requested, solve the equation system block by block to avoid converting it as a whole.
+                        if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isHybridBlockwiseSet()) {
+                            std::vector<ValueType> x = solveEquationSystemBlockwise(env, model, submatrix, subvector, maybeStates, odd, boost::make_optional(storm::utility::one<ValueType>()));
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), maybeStates, odd, x));
+                        }
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
@@ -294,6 +368,15 @@ namespace storm {
                         }
                         STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
                         
+                        // If requested, solve the equation system block by block to avoid converting it as a whole. As
+                        // the upper reward bounds are computed on the full system, we can only do so if they are not needed.
+                        bool solveBlockwise = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isHybridBlockwiseSet();
+                        STORM_LOG_WARN_COND(!solveBlockwise || !oneStepTargetProbs, "Unable to solve blockwise, because the solver requires upper reward bounds. Falling back to solving the full equation system.");
+                        if (solveBlockwise && !oneStepTargetProbs) {
+                            std::vector<ValueType> x = solveEquationSystemBlockwise(env, model, submatrix, subvector, maybeStates, odd, boost::optional<ValueType>());
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>()), maybeStates, odd, x));
+                        }
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
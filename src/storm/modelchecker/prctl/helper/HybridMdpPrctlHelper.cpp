@@ -10,6 +10,10 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -71,6 +75,72 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Solves the MinMax equation system over the given maybe states by converting and solving the blocks of a
+             * topological decomposition one after another. This way, only the explicit representation of a single
+             * block has to be kept in memory at any time.
+             *
+             * @param submatrix The transition matrix restricted to the rows of maybe states.
+             * @param subvector The vector b.
+             * @param odd The ODD of the maybe states (which determines the order of the result).
+             * @param requireInitialScheduler If set, a valid initial scheduler is computed for every block.
+             * @return The solution of the equation system.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::vector<ValueType> solveEquationSystemBlockwise(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Add<DdType, ValueType> const& subvector, storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Odd const& odd, bool uniqueSolution, bool requireInitialScheduler) {
+                storm::utility::Stopwatch decompositionWatch(true);
+                storm::dd::Bdd<DdType> transitionRelation = submatrix.notZero().existsAbstract(model.getNondeterminismVariables());
+                std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::graph::computeTopologicalBlocks(model, transitionRelation, maybeStates, storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getHybridMinimalBlockSize());
+                decompositionWatch.stop();
+                STORM_LOG_INFO("Decomposed " << maybeStates.getNonZeroCount() << " maybe states into " << blocks.size() << " blocks in " << decompositionWatch.getTimeInMilliseconds() << "ms.");
+                
+                storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                
+                std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
+                storm::dd::Bdd<DdType> solvedStates = model.getManager().getBddZero();
+                storm::utility::Stopwatch conversionWatch;
+                for (auto const& block : blocks) {
+                    conversionWatch.start();
+                    storm::dd::Odd blockOdd = block.createOdd();
+                    storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> blockRows = submatrix * blockAdd;
+                    storm::dd::Add<DdType, ValueType> blockVector = subvector * blockAdd;
+                    
+                    // Add the contribution of the transitions to states of previously solved blocks to the vector.
+                    storm::dd::Bdd<DdType> solvedSuccessors = (transitionRelation && block).existsAbstract(model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs()) && solvedStates;
+                    if (!solvedSuccessors.isZero()) {
+                        std::vector<ValueType> successorValues = storm::utility::vector::filterVector(x, solvedSuccessors.toVector(odd));
+                        storm::dd::Add<DdType, ValueType> successorValuesAsColumn = storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), successorValues, solvedSuccessors.createOdd(), model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs());
+                        blockVector += (blockRows * successorValuesAsColumn).sumAbstract(model.getColumnVariables());
+                    }
+                    
+                    storm::dd::Add<DdType, ValueType> blockMatrix = blockRows * blockAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = blockMatrix.toMatrixVector(blockVector, model.getNondeterminismVariables(), blockOdd, blockOdd);
+                    conversionWatch.stop();
+                    
+                    std::vector<ValueType> blockX(explicitRepresentation.first.getRowGroupCount(), storm::utility::zero<ValueType>());
+                    boost::optional<std::vector<uint64_t>> initialScheduler;
+                    if (requireInitialScheduler) {
+                        initialScheduler = computeValidInitialSchedulerForUntilProbabilities<ValueType>(explicitRepresentation.first, explicitRepresentation.second);
+                    }
+                    
+                    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitRepresentation.first));
+                    solver->setHasUniqueSolution(uniqueSolution);
+                    if (initialScheduler) {
+                        solver->setInitialScheduler(std::move(initialScheduler.get()));
+                    }
+                    solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                    solver->setRequirementsChecked();
+                    solver->solveEquations(env, dir, blockX, explicitRepresentation.second);
+                    
+                    storm::utility::vector::setVectorValues(x, block.toVector(odd), blockX);
+                    solvedStates |= block;
+                }
+                STORM_LOG_INFO("Converting symbolic matrix/vector blocks to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                
+                return x;
+            }
+            
             template <typename ValueType>
             void eliminateExtendedStatesFromExplicitRepresentation(std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>& explicitRepresentation, boost::optional<std::vector<uint64_t>>& scheduler, storm::storage::BitVector const& properMaybeStates) {
                 if (scheduler) {
@@ -220,6 +290,12 @@ namespace storm {
                             storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
                             subvector = subvector.sumAbstract(model.getColumnVariables());
                             
+                            // If requested, solve the equation system block by block to avoid converting it as a whole.
+                            if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isHybridBlockwiseSet()) {
+                                std::vector<ValueType> x = solveEquationSystemBlockwise(env, dir, model, submatrix, subvector, maybeStates, odd, uniqueSolution, requirements.validInitialScheduler());
+                                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), maybeStates, odd, x));
+                            }
+                            
                             // Finally cut away all columns targeting non-maybe states.
                             submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
                             
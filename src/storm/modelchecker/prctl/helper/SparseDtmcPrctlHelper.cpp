@@ -9,6 +9,7 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/storage/DynamicPriorityQueue.h"
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+#include "storm/storage/BitVectorRankIndex.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
@@ -574,11 +575,11 @@ namespace storm {
                     
                     // First, compute the relevant states and some offsets.
                     storm::storage::BitVector allStates(targetStates.size(), true);
-                    std::vector<uint_fast64_t> numberOfBeforeStatesUpToState = result.beforeStates.getNumberOfSetBitsBeforeIndices();
+                    storm::storage::BitVectorRankIndex numberOfBeforeStatesUpToState(result.beforeStates);
                     storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, targetStates);
                     statesWithProbabilityGreater0 &= storm::utility::graph::getReachableStates(transitionMatrix, conditionStates, allStates, targetStates);
                     uint_fast64_t normalStatesOffset = result.beforeStates.getNumberOfSetBits();
-                    std::vector<uint_fast64_t> numberOfNormalStatesUpToState = statesWithProbabilityGreater0.getNumberOfSetBitsBeforeIndices();
+                    storm::storage::BitVectorRankIndex numberOfNormalStatesUpToState(statesWithProbabilityGreater0);
                     
                     // All transitions going to states with probability zero, need to be redirected to a deadlock state.
                     bool addDeadlockState = false;
@@ -595,7 +596,7 @@ namespace storm {
                             ValueType zeroProbability = storm::utility::zero<ValueType>();
                             for (auto const& successorEntry : transitionMatrix.getRow(beforeState)) {
                                 if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
-                                    builder.addNextValue(currentRow, normalStatesOffset + numberOfNormalStatesUpToState[successorEntry.getColumn()], successorEntry.getValue());
+                                    builder.addNextValue(currentRow, normalStatesOffset + numberOfNormalStatesUpToState.rank(successorEntry.getColumn()), successorEntry.getValue());
                                 } else {
                                     zeroProbability += successorEntry.getValue();
                                 }
@@ -607,7 +608,7 @@ namespace storm {
                             // For non-condition states, we scale the probabilities going to other before states.
                             for (auto const& successorEntry : transitionMatrix.getRow(beforeState)) {
                                 if (result.beforeStates.get(successorEntry.getColumn())) {
-                                    builder.addNextValue(currentRow, numberOfBeforeStatesUpToState[successorEntry.getColumn()], successorEntry.getValue() * probabilitiesToReachConditionStates[numberOfBeforeStatesUpToState[successorEntry.getColumn()]] / probabilitiesToReachConditionStates[currentRow]);
+                                    builder.addNextValue(currentRow, numberOfBeforeStatesUpToState.rank(successorEntry.getColumn()), successorEntry.getValue() * probabilitiesToReachConditionStates[numberOfBeforeStatesUpToState.rank(successorEntry.getColumn())] / probabilitiesToReachConditionStates[currentRow]);
                                 }
                             }
                         }
@@ -619,7 +620,7 @@ namespace storm {
                         ValueType zeroProbability = storm::utility::zero<ValueType>();
                         for (auto const& successorEntry : transitionMatrix.getRow(state)) {
                             if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
-                                builder.addNextValue(currentRow, normalStatesOffset + numberOfNormalStatesUpToState[successorEntry.getColumn()], successorEntry.getValue());
+                                builder.addNextValue(currentRow, normalStatesOffset + numberOfNormalStatesUpToState.rank(successorEntry.getColumn()), successorEntry.getValue());
                             } else {
                                 zeroProbability += successorEntry.getValue();
                             }
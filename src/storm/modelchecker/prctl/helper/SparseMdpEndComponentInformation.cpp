@@ -1,6 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -14,7 +15,8 @@ namespace storm {
             SparseMdpEndComponentInformation<ValueType>::SparseMdpEndComponentInformation(storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition, storm::storage::BitVector const& maybeStates) : NOT_IN_EC(std::numeric_limits<uint64_t>::max()), eliminatedEndComponents(false), numberOfMaybeStatesInEc(0), numberOfMaybeStatesNotInEc(0), numberOfEc(endComponentDecomposition.size()) {
                 
                 // (1) Compute how many maybe states there are before each other maybe state.
-                maybeStatesBefore = maybeStates.getNumberOfSetBitsBeforeIndices();
+                indexedMaybeStates = std::make_shared<storm::storage::BitVector const>(maybeStates);
+                maybeStatesBefore = std::make_shared<storm::storage::BitVectorRankIndex const>(*indexedMaybeStates);
                 
                 // (2) Create mapping from maybe states to their MEC. If they are not contained in an MEC, their value
                 // is set to a special constant.
@@ -22,7 +24,7 @@ namespace storm {
                 uint64_t mecIndex = 0;
                 for (auto const& mec : endComponentDecomposition) {
                     for (auto const& stateActions : mec) {
-                        maybeStateToEc[maybeStatesBefore[stateActions.first]] = mecIndex;
+                        maybeStateToEc[maybeStatesBefore->rank(stateActions.first)] = mecIndex;
                         ++numberOfMaybeStatesInEc;
                     }
                     ++mecIndex;
@@ -52,7 +54,7 @@ namespace storm {
             
             template<typename ValueType>
             bool SparseMdpEndComponentInformation<ValueType>::isStateInEc(uint64_t state) const {
-                return maybeStateToEc[maybeStatesBefore[state]] != NOT_IN_EC;
+                return maybeStateToEc[maybeStatesBefore->rank(state)] != NOT_IN_EC;
             }
             
             template<typename ValueType>
@@ -67,7 +69,7 @@ namespace storm {
             
             template<typename ValueType>
             uint64_t SparseMdpEndComponentInformation<ValueType>::getEc(uint64_t state) const {
-                return maybeStateToEc[maybeStatesBefore[state]];
+                return maybeStateToEc[maybeStatesBefore->rank(state)];
             }
             
             template<typename ValueType>
@@ -75,7 +77,7 @@ namespace storm {
                 if (this->isStateInEc(state)) {
                     return numberOfMaybeStatesNotInEc + getEc(state);
                 } else {
-                    return maybeStatesNotInEcBefore[maybeStatesBefore[state]];
+                    return maybeStatesNotInEcBefore[maybeStatesBefore->rank(state)];
                 }
             }
             
@@ -139,7 +141,7 @@ namespace storm {
                                 } else if (maybeStates.get(e.getColumn())) {
                                     // If the target state of the transition is not contained in an EC, we can just add the entry.
                                     if (!result.isStateInEc(e.getColumn())) {
-                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore[e.getColumn()]], e.getValue());
+                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore->rank(e.getColumn())], e.getValue());
                                     } else {
                                         // Otherwise, we store the information that the state can go to a certain EC.
                                         ecValuePairs.emplace_back(result.getEc(e.getColumn()), e.getValue());
@@ -191,7 +193,7 @@ namespace storm {
                                 } else if (maybeStates.get(e.getColumn())) {
                                     // If the target state of the transition is not contained in an EC, we can just add the entry.
                                     if (!result.isStateInEc(e.getColumn())) {
-                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore[e.getColumn()]], e.getValue());
+                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore->rank(e.getColumn())], e.getValue());
                                     } else {
                                         // Otherwise, we store the information that the state can go to a certain EC.
                                         ecValuePairs.emplace_back(result.getEc(e.getColumn()), e.getValue());
@@ -247,7 +249,7 @@ namespace storm {
                                 if (maybeStates.get(e.getColumn())) {
                                     // If the target state of the transition is not contained in an EC, we can just add the entry.
                                     if (result.isStateInEc(e.getColumn())) {
-                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore[e.getColumn()]], e.getValue());
+                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore->rank(e.getColumn())], e.getValue());
                                     } else {
                                         // Otherwise, we store the information that the state can go to a certain EC.
                                         ecValuePairs.emplace_back(result.getEc(e.getColumn()), e.getValue());
@@ -288,7 +290,7 @@ namespace storm {
                                 if (maybeStates.get(e.getColumn())) {
                                     // If the target state of the transition is not contained in an EC, we can just add the entry.
                                     if (result.isStateInEc(e.getColumn())) {
-                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore[e.getColumn()]], e.getValue());
+                                        builder.addNextValue(currentRow, maybeStatesNotInEcBefore[result.maybeStatesBefore->rank(e.getColumn())], e.getValue());
                                     } else {
                                         // Otherwise, we store the information that the state can go to a certain EC.
                                         ecValuePairs.emplace_back(result.getEc(e.getColumn()), e.getValue());
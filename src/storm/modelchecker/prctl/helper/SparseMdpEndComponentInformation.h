@@ -2,10 +2,12 @@
 
 #include <vector>
 #include <cstdint>
+#include <memory>
 
 namespace storm {
     namespace storage {
         class BitVector;
+        class BitVectorRankIndex;
         
         template <typename ValueType>
         class SparseMatrix;
@@ -63,8 +65,10 @@ namespace storm {
                 // A flag storing whether end components have been eliminated.
                 bool eliminatedEndComponents;
 
-                // Data about end components.
-                std::vector<uint64_t> maybeStatesBefore;
+                // Data about end components. The maybe states are kept together with the index that yields the number
+                // of maybe states before each state. Both are shared among copies such that the index stays valid.
+                std::shared_ptr<storm::storage::BitVector const> indexedMaybeStates;
+                std::shared_ptr<storm::storage::BitVectorRankIndex const> maybeStatesBefore;
                 std::vector<uint64_t> maybeStatesNotInEcBefore;
                 uint64_t numberOfMaybeStatesInEc;
                 uint64_t numberOfMaybeStatesNotInEc;
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <numeric>
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -11,10 +13,12 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/BitVectorRankIndex.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/Expression.h"
@@ -1307,8 +1311,6 @@ namespace storm {
                 for (uint_fast64_t currentMecIndex = 0; currentMecIndex < mecDecomposition.size(); ++currentMecIndex) {
                     storm::storage::MaximalEndComponent const& mec = mecDecomposition[currentMecIndex];
                     
-                    lraValuesForEndComponents[currentMecIndex] = computeLraForMaximalEndComponent(env, goal.direction(), transitionMatrix, rewardModel, mec);
-                    
                     // Gather information for later use.
                     for (auto const& stateChoicesPair : mec) {
                         statesInMecs.set(stateChoicesPair.first);
@@ -1316,6 +1318,21 @@ namespace storm {
                     }
                 }
                 
+                // The values of the MECs are independent of each other, so they may be computed concurrently. This is
+                // only done for value iteration on doubles, as neither the LP solvers nor the exact arithmetic are
+                // thread-safe. The largest MECs are handed out first such that a large MEC does not delay the end of
+                // the computation.
+                std::vector<uint64_t> mecOrder(mecDecomposition.size());
+                std::iota(mecOrder.begin(), mecOrder.end(), 0);
+                uint64_t numberOfThreads = 1;
+                if (std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getLraMethod() == storm::solver::LraMethod::ValueIteration) {
+                    numberOfThreads = env.solver().minMax().getNumberOfLraThreads();
+                    std::stable_sort(mecOrder.begin(), mecOrder.end(), [&mecDecomposition] (uint64_t first, uint64_t second) { return mecDecomposition[first].size() > mecDecomposition[second].size(); });
+                }
+                storm::utility::parallel::forEachConcurrently(mecOrder, numberOfThreads, [&] (uint64_t currentMecIndex) {
+                    lraValuesForEndComponents[currentMecIndex] = computeLraForMaximalEndComponent(env, goal.direction(), transitionMatrix, rewardModel, mecDecomposition[currentMecIndex]);
+                });
+                
                 // For fast transition rewriting, we build some auxiliary data structures.
                 storm::storage::BitVector statesNotContainedInAnyMec = ~statesInMecs;
                 uint_fast64_t firstAuxiliaryStateIndex = statesNotContainedInAnyMec.getNumberOfSetBits();
@@ -1679,7 +1696,7 @@ namespace storm {
                 // Otherwise, we build the transformed MDP.
                 storm::storage::BitVector relevantStates = storm::utility::graph::getReachableStates(transitionMatrix, initialStatesBitVector, allStates, extendedConditionStates | fixedTargetStates | pureResetStates);
                 STORM_LOG_TRACE("Found " << relevantStates.getNumberOfSetBits() << " relevant states for conditional probability computation.");
-                std::vector<uint_fast64_t> numberOfStatesBeforeRelevantStates = relevantStates.getNumberOfSetBitsBeforeIndices();
+                storm::storage::BitVectorRankIndex numberOfStatesBeforeRelevantStates(relevantStates);
                 storm::storage::sparse::state_type newGoalState = relevantStates.getNumberOfSetBits();
                 storm::storage::sparse::state_type newStopState = newGoalState + 1;
                 storm::storage::sparse::state_type newFailState = newStopState + 1;
@@ -1706,17 +1723,17 @@ namespace storm {
                         }
                         ++currentRow;
                     } else if (pureResetStates.get(state)) {
-                        builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates[initialState], storm::utility::one<ValueType>());
+                        builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates.rank(initialState), storm::utility::one<ValueType>());
                         ++currentRow;
                     } else {
                         for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row) {
                             for (auto const& successorEntry : transitionMatrix.getRow(row)) {
-                                builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates[successorEntry.getColumn()], successorEntry.getValue());
+                                builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates.rank(successorEntry.getColumn()), successorEntry.getValue());
                             }
                             ++currentRow;
                         }
                         if (problematicStates.get(state)) {
-                            builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates[initialState], storm::utility::one<ValueType>());
+                            builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates.rank(initialState), storm::utility::one<ValueType>());
                             ++currentRow;
                         }
                     }
@@ -1730,7 +1747,7 @@ namespace storm {
                 builder.addNextValue(currentRow, newStopState, storm::utility::one<ValueType>());
                 ++currentRow;
                 builder.newRowGroup(currentRow);
-                builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates[initialState], storm::utility::one<ValueType>());
+                builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates.rank(initialState), storm::utility::one<ValueType>());
                 ++currentRow;
                 
                 std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
@@ -1754,7 +1771,7 @@ namespace storm {
                 std::chrono::high_resolution_clock::time_point conditionalEnd = std::chrono::high_resolution_clock::now();
                 STORM_LOG_DEBUG("Computed conditional probabilities in transformed model in " << std::chrono::duration_cast<std::chrono::milliseconds>(conditionalEnd - conditionalStart).count() << "ms.");
                 
-                return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, dir == OptimizationDirection::Maximize ? goalProbabilities[numberOfStatesBeforeRelevantStates[initialState]] : storm::utility::one<ValueType>() - goalProbabilities[numberOfStatesBeforeRelevantStates[initialState]]));
+                return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, dir == OptimizationDirection::Maximize ? goalProbabilities[numberOfStatesBeforeRelevantStates.rank(initialState)] : storm::utility::one<ValueType>() - goalProbabilities[numberOfStatesBeforeRelevantStates.rank(initialState)]));
             }
             
             template class SparseMdpPrctlHelper<double>;
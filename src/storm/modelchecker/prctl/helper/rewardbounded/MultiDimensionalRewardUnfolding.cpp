@@ -12,6 +12,7 @@
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/BitVectorRankIndex.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -525,9 +526,9 @@ namespace storm {
                     }
                     
                     std::vector<uint64_t> toEpochModelInStatesMap(productModel->getProduct().getNumberOfStates(), std::numeric_limits<uint64_t>::max());
-                    std::vector<uint64_t> epochModelStateToInStateMap = epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
+                    storm::storage::BitVectorRankIndex epochModelStateToInStateMap(epochModel.epochInStates);
                     for (auto const& productState : productInStates) {
-                        toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
+                        toEpochModelInStatesMap[productState] = epochModelStateToInStateMap.rank(productToEpochModelStateMapping[productState]);
                     }
                     productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
                     
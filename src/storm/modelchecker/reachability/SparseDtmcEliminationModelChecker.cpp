@@ -1,6 +1,8 @@
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <random>
 #include <chrono>
 
@@ -10,6 +12,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -29,6 +33,7 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -435,11 +440,11 @@ namespace storm {
             storm::storage::BitVector const& phiStates = leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
             storm::storage::BitVector const& psiStates = rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
             
-            return computeUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), phiStates, psiStates, checkTask.isOnlyInitialStatesRelevantSet());
+            return computeUntilProbabilities(env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), phiStates, psiStates, checkTask.isOnlyInitialStatesRelevantSet());
         }
         
         template<typename SparseDtmcModelType>
-        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool computeForInitialStatesOnly) {
+        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool computeForInitialStatesOnly) {
             
             // Then, compute the subset of states that has a probability of 0 or 1, respectively.
             std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
@@ -479,7 +484,7 @@ namespace storm {
                 storm::storage::SparseMatrix<ValueType> submatrix = probabilityMatrix.getSubmatrix(false, maybeStates, maybeStates);
                 storm::storage::SparseMatrix<ValueType> submatrixTransposed = submatrix.transpose();
                 
-                std::vector<ValueType> subresult = computeReachabilityValues(submatrix, oneStepProbabilities, submatrixTransposed, newInitialStates, computeForInitialStatesOnly, oneStepProbabilities);
+                std::vector<ValueType> subresult = computeReachabilityValues(env, submatrix, oneStepProbabilities, submatrixTransposed, newInitialStates, computeForInitialStatesOnly, oneStepProbabilities);
                 storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, subresult);
             }
             
@@ -512,7 +517,7 @@ namespace storm {
             RewardModelType const& rewardModel = this->getModel().getRewardModel(checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
             
             STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::IllegalArgumentException, "Input model does not have a reward model.");
-            return computeReachabilityRewards(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), targetStates,
+            return computeReachabilityRewards(env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), targetStates,
                                               [&] (uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) {
                                                   return rewardModel.getTotalRewardVector(numberOfRows, transitionMatrix, maybeStates);
                                               },
@@ -521,8 +526,8 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& targetStates, std::vector<ValueType>& stateRewardValues, bool computeForInitialStatesOnly) {
-            return computeReachabilityRewards(probabilityMatrix, backwardTransitions, initialStates, targetStates,
+        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityRewards(Environment const& env, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& targetStates, std::vector<ValueType>& stateRewardValues, bool computeForInitialStatesOnly) {
+            return computeReachabilityRewards(env, probabilityMatrix, backwardTransitions, initialStates, targetStates,
                                               [&] (uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const& maybeStates) {
                                                   std::vector<ValueType> result(numberOfRows);
                                                   storm::utility::vector::selectVectorValues(result, maybeStates, stateRewardValues);
@@ -532,7 +537,7 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& targetStates, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, bool computeForInitialStatesOnly) {
+        std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityRewards(Environment const& env, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& targetStates, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, bool computeForInitialStatesOnly) {
             
             uint_fast64_t numberOfStates = probabilityMatrix.getRowCount();
             
@@ -577,7 +582,7 @@ namespace storm {
                 // Project the state reward vector to all maybe-states.
                 std::vector<ValueType> stateRewardValues = totalStateRewardVectorGetter(submatrix.getRowCount(), probabilityMatrix, maybeStates);
                 
-                std::vector<ValueType> subresult = computeReachabilityValues(submatrix, stateRewardValues, submatrixTransposed, newInitialStates, computeForInitialStatesOnly, probabilityMatrix.getConstrainedRowSumVector(maybeStates, targetStates));
+                std::vector<ValueType> subresult = computeReachabilityValues(env, submatrix, stateRewardValues, submatrixTransposed, newInitialStates, computeForInitialStatesOnly, probabilityMatrix.getConstrainedRowSumVector(maybeStates, targetStates));
                 storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, subresult);
             }
             
@@ -836,11 +841,20 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHybridStateElimination(storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHybridStateElimination(Environment const& env, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
             // When using the hybrid technique, we recursively treat the SCCs up to some size.
             std::vector<storm::storage::sparse::state_type> entryStateQueue;
             STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique." << std::endl);
-            uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+            
+            // Exact numbers and rational functions are backed by carl whose global pools must not be accessed
+            // concurrently, so only SCCs of floating point models are treated concurrently.
+            uint_fast64_t numberOfThreads = 1;
+            if (std::is_same<ValueType, double>::value) {
+                numberOfThreads = env.modelchecker().getNumberOfEliminationSccThreads();
+            } else {
+                STORM_LOG_WARN_COND(env.modelchecker().getNumberOfEliminationSccThreads() <= 1, "Independent SCCs are only eliminated concurrently for floating point models. Falling back to sequential elimination.");
+            }
+            uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue, computeResultsForInitialStatesOnly, numberOfThreads, distanceBasedPriorities);
             
             // If the entry states were to be eliminated last, we need to do so now.
             if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
@@ -854,7 +868,7 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        std::vector<typename SparseDtmcEliminationModelChecker<SparseDtmcModelType>::ValueType> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityValues(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& values, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates,  bool computeResultsForInitialStatesOnly, std::vector<ValueType> const& oneStepProbabilitiesToTarget) {
+        std::vector<typename SparseDtmcEliminationModelChecker<SparseDtmcModelType>::ValueType> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityValues(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& values, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates,  bool computeResultsForInitialStatesOnly, std::vector<ValueType> const& oneStepProbabilitiesToTarget) {
             // Then, we convert the reduced matrix to a more flexible format to be able to perform state elimination more easily.
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(transitionMatrix);
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(backwardTransitions);
@@ -872,7 +886,7 @@ namespace storm {
             if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() == storm::settings::modules::EliminationSettings::EliminationMethod::State) {
                 performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
             } else if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() == storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid) {
-                uint64_t maximalDepth = performHybridStateElimination(transitionMatrix, flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
+                uint64_t maximalDepth = performHybridStateElimination(env, transitionMatrix, flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
                 STORM_LOG_TRACE("Maximal depth of decomposition was " << maximalDepth << ".");
             }
             
@@ -888,7 +902,7 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly, uint_fast64_t numberOfThreads, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
             uint_fast64_t maximalDepth = level;
             
             // If the SCCs are large enough, we try to split them further.
@@ -921,6 +935,15 @@ namespace storm {
                 
                 // And then recursively treat the remaining sub-SCCs.
                 STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
+                if (numberOfThreads > 1 && remainingSccs.getNumberOfSetBits() > 1) {
+                    std::vector<storm::storage::StronglyConnectedComponent const*> sccs;
+                    for (auto sccIndex : remainingSccs) {
+                        sccs.push_back(&decomposition.getBlock(sccIndex));
+                    }
+                    uint_fast64_t depth = treatSccsConcurrently(matrix, values, sccs, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(), level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, numberOfThreads, distanceBasedPriorities);
+                    maximalDepth = std::max(maximalDepth, depth);
+                    remainingSccs.clear();
+                }
                 for (auto sccIndex : remainingSccs) {
                     storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
                     
@@ -938,7 +961,7 @@ namespace storm {
                     }
                     
                     // Recursively descend in SCC-hierarchy.
-                    uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(), level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                    uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(), level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, numberOfThreads, distanceBasedPriorities);
                     maximalDepth = std::max(maximalDepth, depth);
                 }
             } else {
@@ -965,6 +988,102 @@ namespace storm {
             return maximalDepth;
         }
         
+        template<typename SparseDtmcModelType>
+        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatSccsConcurrently(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, std::vector<storm::storage::StronglyConnectedComponent const*> const& sccs, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly, uint_fast64_t numberOfThreads, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+            uint_fast64_t maximalDepth = level;
+            uint_fast64_t numberOfStates = forwardTransitions.getRowCount();
+            
+            uint_fast64_t const noScc = std::numeric_limits<uint_fast64_t>::max();
+            std::vector<uint_fast64_t> stateToScc(numberOfStates, noScc);
+            for (uint_fast64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+                for (auto const& state : *sccs[sccIndex]) {
+                    stateToScc[state] = sccIndex;
+                }
+            }
+            
+            struct SccTask {
+                uint_fast64_t sccIndex;
+                storm::storage::BitVector states;
+                storm::storage::BitVector entryStates;
+                std::vector<storm::storage::sparse::state_type> entryStateQueue;
+                uint_fast64_t depth;
+            };
+            
+            std::vector<uint_fast64_t> remainingSccs(sccs.size());
+            std::iota(remainingSccs.begin(), remainingSccs.end(), 0);
+            while (!remainingSccs.empty()) {
+                // Select the SCCs of this round. Eliminating the states of an SCC (except for its entry states) only
+                // affects the SCC itself and the backward transitions of its successors, so SCCs can be treated
+                // concurrently as long as these sets of states are disjoint.
+                std::vector<SccTask> tasks;
+                std::vector<uint_fast64_t> postponedSccs;
+                storm::storage::BitVector affectedStates(numberOfStates);
+                for (auto sccIndex : remainingSccs) {
+                    std::vector<storm::storage::sparse::state_type> sccAffectedStates(sccs[sccIndex]->begin(), sccs[sccIndex]->end());
+                    for (auto const& state : *sccs[sccIndex]) {
+                        for (auto const& successor : matrix.getRow(state)) {
+                            if (stateToScc[successor.getColumn()] != sccIndex) {
+                                sccAffectedStates.push_back(successor.getColumn());
+                            }
+                        }
+                    }
+                    if (std::any_of(sccAffectedStates.begin(), sccAffectedStates.end(), [&affectedStates] (storm::storage::sparse::state_type const& state) { return affectedStates.get(state); })) {
+                        postponedSccs.push_back(sccIndex);
+                        continue;
+                    }
+                    for (auto const& state : sccAffectedStates) {
+                        affectedStates.set(state);
+                    }
+                    
+                    SccTask task;
+                    task.sccIndex = sccIndex;
+                    task.states = storm::storage::BitVector(numberOfStates, sccs[sccIndex]->begin(), sccs[sccIndex]->end());
+                    task.entryStates = storm::storage::BitVector(numberOfStates);
+                    for (auto const& state : *sccs[sccIndex]) {
+                        for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                            if (predecessor.getValue() != storm::utility::zero<ValueType>() && !task.states.get(predecessor.getColumn())) {
+                                task.entryStates.set(state);
+                            }
+                        }
+                    }
+                    task.depth = level;
+                    tasks.push_back(std::move(task));
+                }
+                remainingSccs = std::move(postponedSccs);
+                
+                if (tasks.size() == 1) {
+                    // A single SCC is treated by this thread (and may itself be decomposed concurrently).
+                    SccTask& task = tasks.front();
+                    uint_fast64_t depth = treatScc(matrix, values, task.entryStates, task.states, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates, level, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, numberOfThreads, distanceBasedPriorities);
+                    maximalDepth = std::max(maximalDepth, depth);
+                    continue;
+                }
+                
+                STORM_LOG_TRACE("Eliminating " << tasks.size() << " SCCs concurrently on level " << level << ".");
+                
+                // The entry states of all SCCs are only treated after all SCCs of this round were treated.
+                std::vector<uint_fast64_t> taskIndices(tasks.size());
+                std::iota(taskIndices.begin(), taskIndices.end(), 0);
+                storm::utility::parallel::forEachConcurrently(taskIndices, numberOfThreads, [&] (uint_fast64_t taskIndex) {
+                    SccTask& task = tasks[taskIndex];
+                    task.depth = treatScc(matrix, values, task.entryStates, task.states, initialStates, forwardTransitions, backwardTransitions, false, level, maximalSccSize, task.entryStateQueue, computeResultsForInitialStatesOnly, 1, distanceBasedPriorities);
+                });
+                
+                for (auto& task : tasks) {
+                    maximalDepth = std::max(maximalDepth, task.depth);
+                    if (eliminateEntryStates) {
+                        storm::storage::BitVector entryStates(numberOfStates, task.entryStateQueue.begin(), task.entryStateQueue.end());
+                        std::shared_ptr<StatePriorityQueue> entryStatePriorities = createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, entryStates);
+                        performPrioritizedStateElimination(entryStatePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                    } else {
+                        entryStateQueue.insert(entryStateQueue.end(), task.entryStateQueue.begin(), task.entryStateQueue.end());
+                    }
+                }
+            }
+            
+            return maximalDepth;
+        }
+        
         template<typename SparseDtmcModelType>
         bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions) {
             for (uint_fast64_t forwardIndex = 0; forwardIndex < transitionMatrix.getRowCount(); ++forwardIndex) {
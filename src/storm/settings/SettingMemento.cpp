@@ -1,6 +1,8 @@
 #include "storm/settings/SettingMemento.h"
 
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/ArgumentBase.h"
 
 namespace storm {
     namespace settings {
@@ -8,10 +10,22 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        SettingMemento::SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, std::string const& argumentName, bool resetToState, boost::optional<std::string> const& resetToValue) : settings(settings), optionName(longOptionName), resetToState(resetToState), argumentName(argumentName), resetToValue(resetToValue) {
+            // Intentionally left empty.
+        }
+        
         /*!
          * Destructs the memento object and resets the value of the option to its original state.
          */
         SettingMemento::~SettingMemento() {
+            if (argumentName) {
+                ArgumentBase& argument = settings.getOption(optionName).getArgumentByName(argumentName.get());
+                if (resetToValue) {
+                    argument.setFromStringValue(resetToValue.get());
+                } else {
+                    argument.setFromDefaultValue();
+                }
+            }
             if (resetToState) {
                 settings.set(optionName);
             } else {
@@ -4,6 +4,8 @@
 #include <string>
 #include <memory>
 
+#include <boost/optional.hpp>
+
 
 namespace storm {
     namespace settings {
@@ -14,7 +16,8 @@ namespace storm {
         }
         
         /*!
-         * This class is used to reset the state of an option that was temporarily set to a different status.
+         * This class is used to reset the state of an option (and possibly the value of one of its arguments) that was
+         * temporarily set to a different status.
          */
         class SettingMemento {
 		public:
@@ -28,6 +31,19 @@ namespace storm {
              */
             SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, bool resetToState);
             
+            /*!
+             * Constructs a new memento for the specified argument of the specified option.
+             *
+             * @param settings The settings object in which to restore the state of the option.
+             * @param longOptionName The long name of the option.
+             * @param argumentName The name of the argument whose value is to be restored.
+             * @param resetToState A flag that indicates the status to which the option is to be reset upon
+             * deconstruction of this object.
+             * @param resetToValue The value to which the argument is to be reset upon deconstruction of this object. If
+             * none is given, the argument is reset to its default value.
+             */
+            SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, std::string const& argumentName, bool resetToState, boost::optional<std::string> const& resetToValue);
+            
             /*!
              * Destructs the memento object and resets the value of the option to its original state.
              */
@@ -42,6 +58,12 @@ namespace storm {
             
             // The state of the option before it was set.
 			bool resetToState;
+            
+            // If set, the name of the argument whose value was temporarily changed.
+            boost::optional<std::string> argumentName;
+            
+            // The value of the argument before it was changed. If none is given, it held its default value.
+            boost::optional<std::string> resetToValue;
         };
         
     } // namespace settings
@@ -516,10 +516,26 @@ namespace storm {
             return dynamic_cast<storm::settings::modules::IOSettings&>(mutableManager().getModule(storm::settings::modules::IOSettings::moduleName));
         }
         
+        storm::settings::modules::BuildSettings& mutableBuildSettings() {
+            return dynamic_cast<storm::settings::modules::BuildSettings&>(mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName));
+        }
+        
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
             return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
         }
         
+        storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings() {
+            return dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName));
+        }
+        
+        storm::settings::modules::EliminationSettings& mutableEliminationSettings() {
+            return dynamic_cast<storm::settings::modules::EliminationSettings&>(mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName));
+        }
+        
+        storm::settings::modules::ExplorationSettings& mutableExplorationSettings() {
+            return dynamic_cast<storm::settings::modules::ExplorationSettings&>(mutableManager().getModule(storm::settings::modules::ExplorationSettings::moduleName));
+        }
+        
         void initializeAll(std::string const& name, std::string const& executableName) {
             storm::settings::mutableManager().setName(name, executableName);
 
@@ -14,8 +14,12 @@ namespace storm {
         namespace modules {
             class CoreSettings;
             class IOSettings;
+            class BuildSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class ModelCheckerSettings;
+            class EliminationSettings;
+            class ExplorationSettings;
         }
         class Option;
         
@@ -285,6 +289,14 @@ namespace storm {
          * @return An object that allows accessing and modifying the IO settings.
          */
         storm::settings::modules::IOSettings& mutableIOSettings();
+
+        /*!
+         * Retrieves the build settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the build settings.
+         */
+        storm::settings::modules::BuildSettings& mutableBuildSettings();
         
         /*!
          * Retrieves the abstraction settings in a mutable form. This is only meant to be used for debug purposes or very
@@ -294,6 +306,30 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the model checker settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the model checker settings.
+         */
+        storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings();
+        
+        /*!
+         * Retrieves the elimination settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the elimination settings.
+         */
+        storm::settings::modules::EliminationSettings& mutableEliminationSettings();
+        
+        /*!
+         * Retrieves the exploration settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the exploration settings.
+         */
+        storm::settings::modules::ExplorationSettings& mutableExplorationSettings();
+        
     } // namespace settings
 } // namespace storm
 
@@ -100,6 +100,21 @@ namespace storm {
                  */
                 bool isRestrictToRelevantStatesSet() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently enumerate the abstractions of commands (or edges).
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Overrides the number of threads that concurrently enumerate the abstractions of commands (or edges).
+                 *
+                 * @param numberOfThreads The number of threads.
+                 * @return A pointer to an object that restores the previous number upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfThreads(uint_fast64_t numberOfThreads);
+                
                 const static std::string moduleName;
                 
             private:
@@ -112,6 +127,7 @@ namespace storm {
                 const static std::string pivotHeuristicOptionName;
                 const static std::string reuseResultsOptionName;
                 const static std::string restrictToRelevantStatesOptionName;
+                const static std::string threadsOptionName;
             };
             
         }
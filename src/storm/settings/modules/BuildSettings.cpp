@@ -30,6 +30,7 @@ namespace storm {
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
             const std::string buildOutOfBoundsStateOptionName = "buildoutofboundsstate";
+            const std::string ddVariableOrderingOptionName = "ddvarorder";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -45,6 +46,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").build());
 
+                std::vector<std::string> ddVariableOrderings = {"program", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets the heuristic used to order the variables of symbolic models (before building).")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. 'program' keeps the order of declaration, 'force' places interacting variables close to each other.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings)).setDefaultValueString("program").build()).build());
+
             }
 
 
@@ -91,6 +96,20 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
 
+            storm::builder::DdVariableOrdering BuildSettings::getDdVariableOrdering() const {
+                std::string ddVariableOrderingAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (ddVariableOrderingAsString == "program") {
+                    return storm::builder::DdVariableOrdering::Program;
+                } else if (ddVariableOrderingAsString == "force") {
+                    return storm::builder::DdVariableOrdering::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable ordering '" << ddVariableOrderingAsString << "'.");
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> BuildSettings::overrideDdVariableOrdering(storm::builder::DdVariableOrdering ordering) {
+                return this->overrideArgument(ddVariableOrderingOptionName, "name", ordering == storm::builder::DdVariableOrdering::Force ? "force" : "program");
+            }
+
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
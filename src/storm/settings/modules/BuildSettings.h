@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 namespace storm {
     namespace settings {
@@ -44,6 +45,21 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves the heuristic that is used to order the DD variables when building symbolic models.
+                 *
+                 * @return The chosen variable ordering.
+                 */
+                storm::builder::DdVariableOrdering getDdVariableOrdering() const;
+
+                /*!
+                 * Overrides the heuristic that is used to order the DD variables when building symbolic models.
+                 *
+                 * @param ordering The variable ordering to use.
+                 * @return A pointer to an object that restores the previous ordering upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideDdVariableOrdering(storm::builder::DdVariableOrdering ordering);
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
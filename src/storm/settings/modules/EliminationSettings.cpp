@@ -1,5 +1,6 @@
 #include "storm/settings/modules/EliminationSettings.h"
 
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
@@ -17,6 +18,7 @@ namespace storm {
             const std::string EliminationSettings::eliminationOrderOptionName = "order";
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
+            const std::string EliminationSettings::sccThreadsOptionName = "sccthreads";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
@@ -29,6 +31,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, entryStatesLastOptionName, true, "Sets whether the entry states are eliminated last.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).setIsOptional(true).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, sccThreadsOptionName, true, "Sets the number of threads that concurrently eliminate independent SCCs in the hybrid elimination technique (floating point models only).")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").build());
             }
             
@@ -43,6 +47,10 @@ namespace storm {
                 }
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideEliminationMethod(EliminationMethod method) {
+                return this->overrideArgument(eliminationMethodOptionName, "name", method == EliminationMethod::Hybrid ? "hybrid" : "state");
+            }
+            
             EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder() const {
                 std::string eliminationOrderAsString = this->getOption(eliminationOrderOptionName).getArgumentByName("name").getValueAsString();
                 if (eliminationOrderAsString == "fw") {
@@ -74,6 +82,14 @@ namespace storm {
                 return this->getOption(maximalSccSizeOptionName).getArgumentByName("maxsize").getValueAsUnsignedInteger();
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideMaximalSccSize(uint_fast64_t maximalSccSize) {
+                return this->overrideArgument(maximalSccSizeOptionName, "maxsize", std::to_string(maximalSccSize));
+            }
+            
+            uint_fast64_t EliminationSettings::getNumberOfSccThreads() const {
+                return this->getOption(sccThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
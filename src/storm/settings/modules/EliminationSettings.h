@@ -34,6 +34,14 @@ namespace storm {
                  */
                 EliminationMethod getEliminationMethod() const;
                 
+                /*!
+                 * Overrides the elimination method.
+                 *
+                 * @param method The elimination method to use.
+                 * @return A pointer to an object that restores the previous method upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideEliminationMethod(EliminationMethod method);
+                
                 /*!
                  * Retrieves the selected elimination order.
                  *
@@ -55,6 +63,22 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalSccSize() const;
                 
+                /*!
+                 * Overrides the maximal size of an SCC on which state elimination is to be directly applied.
+                 *
+                 * @param maximalSccSize The maximal size.
+                 * @return A pointer to an object that restores the previous size upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideMaximalSccSize(uint_fast64_t maximalSccSize);
+                
+                /*!
+                 * Retrieves the number of threads that eliminate independent SCCs concurrently (hybrid elimination of floating
+                 * point models only).
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfSccThreads() const;
+                
                 /*!
                  * Retrieves whether the dedicated model checker is to be used instead of the general on.
                  *
@@ -69,6 +93,7 @@ namespace storm {
                 const static std::string eliminationOrderOptionName;
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
+                const static std::string sccThreadsOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
             };
             
@@ -72,6 +72,21 @@ namespace storm {
                  */
                 NextStateHeuristic getNextStateHeuristic() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently sample paths.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Overrides the number of threads that concurrently sample paths.
+                 *
+                 * @param numberOfThreads The number of threads.
+                 * @return A pointer to an object that restores the previous number upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfThreads(uint_fast64_t numberOfThreads);
+                
                 /*!
                  * Retrieves the precision to use for numerical operations.
                  *
@@ -90,6 +105,7 @@ namespace storm {
                 static const std::string numberOfExplorationStepsUntilPrecomputationOptionName;
                 static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
                 static const std::string nextStateHeuristicOptionName;
+                static const std::string threadsOptionName;
                 static const std::string precisionOptionName;
                 static const std::string precisionOptionShortName;
             };
@@ -93,6 +93,14 @@ namespace storm {
                  */
                 storm::solver::LraMethod getLraMethod() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently compute the long run averages of the maximal end
+                 * components.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfLraThreads() const;
+                
                 /*!
                  * Retrieves the method to be used for bounded reachability on MAs.
                  *
@@ -112,6 +120,12 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether iterative methods of the symbolic solvers only update the frontier of states whose
+                 * successors changed their values in the previous iteration.
+                 */
+                bool isSymbolicFrontierIterationSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -122,9 +136,11 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string lraMethodOptionName;
+                static const std::string lraThreadsOptionName;
                 static const std::string markovAutomatonBoundedReachabilityMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string symbolicFrontierIterationOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -14,14 +14,33 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::hybridBlockwiseOptionName = "hybridblocks";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, hybridBlockwiseOptionName, false, "If set, the hybrid engine decomposes the maybe states into blocks and converts and solves them one after another in topological order instead of converting the full equation system.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("minsize", "The minimal number of states of a block. Smaller blocks are merged.").setDefaultValueUnsignedInteger(1000).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            bool ModelCheckerSettings::isHybridBlockwiseSet() const {
+                return this->getOption(hybridBlockwiseOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t ModelCheckerSettings::getHybridMinimalBlockSize() const {
+                return this->getOption(hybridBlockwiseOptionName).getArgumentByName("minsize").getValueAsUnsignedInteger();
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideHybridMinimalBlockSize(uint64_t minimalBlockSize) {
+                return this->overrideArgument(hybridBlockwiseOptionName, "minsize", std::to_string(minimalBlockSize));
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideHybridBlockwiseSet(bool stateToSet) {
+                return this->overrideOption(hybridBlockwiseOptionName, stateToSet);
+            }
             
         } // namespace modules
     } // namespace settings
@@ -22,12 +22,45 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves whether the hybrid engine is to convert and solve the equation systems block by block.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isHybridBlockwiseSet() const;
+
+                /*!
+                 * Retrieves the minimal number of states of a block when solving blockwise in the hybrid engine.
+                 *
+                 * @return The minimal number of states of a block.
+                 */
+                uint64_t getHybridMinimalBlockSize() const;
+
+                /*!
+                 * Overrides the minimal number of states of a block when solving blockwise in the hybrid engine. As soon
+                 * as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param minimalBlockSize The minimal number of states of a block.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideHybridMinimalBlockSize(uint64_t minimalBlockSize);
+
+                /*!
+                 * Overrides the option to solve blockwise in the hybrid engine by setting it to the specified value. As
+                 * soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideHybridBlockwiseSet(bool stateToSet);
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string hybridBlockwiseOptionName;
             };
 
         } // namespace modules
@@ -3,8 +3,10 @@
 #include "storm/utility/macros.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
+#include "storm/settings/ArgumentBase.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
 
 namespace storm {
     namespace settings {
@@ -58,6 +60,19 @@ namespace storm {
                 return std::unique_ptr<storm::settings::SettingMemento>(new storm::settings::SettingMemento(*this, name, currentStatus));
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> ModuleSettings::overrideArgument(std::string const& optionName, std::string const& argumentName, std::string const& value) {
+                Option& option = this->getOption(optionName);
+                ArgumentBase& argument = option.getArgumentByName(argumentName);
+                bool currentStatus = option.getHasOptionBeenSet();
+                boost::optional<std::string> currentValue;
+                if (argument.getHasBeenSet() || !argument.getHasDefaultValue()) {
+                    currentValue = argument.getValueAsString();
+                }
+                bool valueSet = argument.setFromStringValue(value);
+                STORM_LOG_THROW(valueSet, storm::exceptions::IllegalArgumentValueException, "Unable to set the argument '" << argumentName << "' of option '" << optionName << "' to the value '" << value << "'.");
+                return std::unique_ptr<storm::settings::SettingMemento>(new storm::settings::SettingMemento(*this, optionName, argumentName, currentStatus, currentValue));
+            }
+            
             bool ModuleSettings::isSet(std::string const& optionName) const {
                 return this->getOption(optionName).getHasOptionBeenSet();
             }
@@ -55,6 +55,18 @@ namespace storm {
                  */
                 std::unique_ptr<storm::settings::SettingMemento> overrideOption(std::string const& name, bool requiredStatus);
                 
+                /*!
+                 * Sets the argument of the option with the given name to the given value. As a result, a pointer to an
+                 * object is returned such that when the object is destroyed (i.e. the smart pointer goes out of scope),
+                 * the argument and the status of the option are reset to their original values.
+                 *
+                 * @param optionName The name of the option.
+                 * @param argumentName The name of the argument to set.
+                 * @param value The value to set, given as a string.
+                 * @return A pointer to an object that resets the change upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideArgument(std::string const& optionName, std::string const& argumentName, std::string const& value);
+                
                 /*!
                  * Retrieves the name of the module to which these settings belong.
                  *
@@ -24,6 +24,8 @@ namespace storm {
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
             const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string NativeEquationSolverSettings::symbolicFrontierIterationOptionName = "symbfrontier";
+            const std::string NativeEquationSolverSettings::gaussSeidelThreadsOptionName = "gsthreads";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "interval-iteration", "ii", "ratsearch" };
@@ -42,6 +44,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
                                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicFrontierIterationOptionName, true, "If set, the iterative methods of the dd engine only update states with a successor whose value changed in the previous iteration.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, gaussSeidelThreadsOptionName, true, "The number of threads that perform the sweeps of Gauss-Seidel and SOR (and Gauss-Seidel multiplications of the native multiplier). For more than one thread, the rows are processed along a multicoloring of the matrix.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -115,6 +121,14 @@ namespace storm {
             bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet() const {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
+            
+            bool NativeEquationSolverSettings::isSymbolicFrontierIterationSet() const {
+                return this->getOption(symbolicFrontierIterationOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t NativeEquationSolverSettings::getNumberOfGaussSeidelThreads() const {
+                return this->getOption(gaussSeidelThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
 
             bool NativeEquationSolverSettings::check() const {
                 // This list does not include the precision, because this option is shared with other modules.
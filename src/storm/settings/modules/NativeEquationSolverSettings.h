@@ -98,6 +98,19 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether iterative methods of the symbolic solvers only update the frontier of states whose
+                 * successors changed their values in the previous iteration.
+                 */
+                bool isSymbolicFrontierIterationSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that perform Gauss-Seidel sweeps concurrently.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfGaussSeidelThreads() const;
+                
                 /*!
                  * Retrieves the multiplication style to use in the power method.
                  *
@@ -124,6 +137,8 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string symbolicFrontierIterationOptionName;
+                static const std::string gaussSeidelThreadsOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
                 static const std::string forceBoundsOptionName;
 
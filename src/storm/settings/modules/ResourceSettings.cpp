@@ -15,11 +15,14 @@ namespace storm {
             const std::string ResourceSettings::timeoutOptionShortName = "t";
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
+            const std::string ResourceSettings::ddStatisticsOptionName = "ddstats";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setShortName(timeoutOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds after which to timeout.").setDefaultValueUnsignedInteger(0).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddStatisticsOptionName, false, "If given, statistics about the DD operations and the DD library caches are collected and written to the given file in JSON format.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the statistics are to be written.").build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -34,6 +37,14 @@ namespace storm {
                 return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
             }
 
+            bool ResourceSettings::isDdStatisticsSet() const {
+                return this->getOption(ddStatisticsOptionName).getHasOptionBeenSet();
+            }
+
+            std::string ResourceSettings::getDdStatisticsFilename() const {
+                return this->getOption(ddStatisticsOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
         }
     }
 }
@@ -39,6 +39,20 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves whether statistics about DD operations shall be collected and exported.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdStatisticsSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the DD operation statistics are to be exported.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getDdStatisticsFilename() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +62,7 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string ddStatisticsOptionName;
             };
         }
     }
@@ -49,7 +49,7 @@ namespace storm {
                 } else {
                     STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
                 }
-            } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
+            } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::OptimisticValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
                 if (env.solver().minMax().isMethodSetFromDefault()) {
                     STORM_LOG_INFO("Selecting 'sound value iteration' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
                     method = MinMaxMethod::SoundValueIteration;
@@ -57,7 +57,7 @@ namespace storm {
                     STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
                 }
             }
-            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
+            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
             return method;
         }
         
@@ -80,6 +80,9 @@ namespace storm {
                 case MinMaxMethod::SoundValueIteration:
                     result = solveEquationsSoundValueIteration(env, dir, x, b);
                     break;
+                case MinMaxMethod::OptimisticValueIteration:
+                    result = solveEquationsOptimisticValueIteration(env, dir, x, b);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
             }
@@ -265,6 +268,13 @@ namespace storm {
                     requirements.requireNoEndComponents();
                 }
                 requirements.requireBounds(false);
+            } else if (method == MinMaxMethod::OptimisticValueIteration) {
+                // Optimistic value iteration needs to approach the solution from below.
+                requirements.requireLowerBounds();
+                // As for rational search, the solution needs to be unique in case of minimizing or in cases where we want a scheduler.
+                if (!this->hasUniqueSolution() && (!direction || direction.get() == OptimizationDirection::Minimize || this->isTrackSchedulerSet())) {
+                    requirements.requireNoEndComponents();
+                }
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unsupported technique for iterative MinMax linear equation solver.");
             }
@@ -448,10 +458,15 @@ namespace storm {
             this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
+            // If both bounds are improved in one iteration, this is done in a single pass over the matrix, so a second
+            // auxiliary vector is needed.
             std::vector<ValueType>* tmp = nullptr;
+            std::vector<ValueType>* tmp2 = nullptr;
             if (!useGaussSeidelMultiplication) {
                 auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
+                auxiliaryRowGroupVector3 = std::make_unique<std::vector<ValueType>>(lowerX->size());
                 tmp = auxiliaryRowGroupVector2.get();
+                tmp2 = auxiliaryRowGroupVector3.get();
             }
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
@@ -461,8 +476,10 @@ namespace storm {
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues() && !env.solver().minMax().isSymmetricUpdatesSet();
             std::vector<ValueType> oldValues;
+            std::vector<ValueType> oldUpperValues;
             if (useGaussSeidelMultiplication && useDiffs) {
                 oldValues.resize(this->getRelevantValues().getNumberOfSetBits());
+                oldUpperValues.resize(this->getRelevantValues().getNumberOfSetBits());
             }
             ValueType maxLowerDiff = storm::utility::zero<ValueType>();
             ValueType maxUpperDiff = storm::utility::zero<ValueType>();
@@ -484,27 +501,21 @@ namespace storm {
                     if (useGaussSeidelMultiplication) {
                         if (useDiffs) {
                             preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
+                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
-                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                        this->multiplierA->multiplyAndReduceGaussSeidel2(env, dir, *lowerX, *upperX, &b);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
-                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
-                        }
-                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
                     } else {
-                        this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                        this->multiplierA->multiplyAndReduce2(env, dir, *lowerX, *upperX, &b, *tmp, *tmp2);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp2, this->getRelevantValues());
                         }
                         std::swap(lowerX, tmp);
-                        this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
-                        std::swap(upperX, tmp);
+                        std::swap(upperX, tmp2);
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
@@ -582,10 +593,8 @@ namespace storm {
             storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, *lowerX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
             
             // Since we shuffled the pointer around, we need to write the actual results to the input/output vector x.
-            if (&x == tmp) {
-                std::swap(x, *tmp);
-            } else if (&x == this->auxiliaryRowGroupVector.get()) {
-                std::swap(x, *this->auxiliaryRowGroupVector);
+            if (lowerX != &x) {
+                std::swap(x, *lowerX);
             }
             
             // If requested, we store the scheduler for retrieval.
@@ -666,6 +675,108 @@ namespace storm {
             return status == SolverStatus::Converged;
         }
         
+        /*!
+         * This version of value iteration is sound, but (unlike interval iteration) does not need an upper bound to
+         * start from. It approaches the solution from below with plain value iteration. Once this has (heuristically)
+         * converged, an upper bound is guessed by increasing the current values by the precision. The guess is verified
+         * by a single application of the Bellman operator: if no value increases, the guess is an upper bound of the
+         * solution. Otherwise, value iteration proceeds with a smaller precision. This technique is due to Hartmanns and
+         * Kaminski (Optimistic Value Iteration).
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            
+            if (!auxiliaryRowGroupVector) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            }
+            auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            auxiliaryRowGroupVector3 = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            
+            this->createLowerBoundsVector(x);
+            std::vector<ValueType>* currentX = &x;
+            std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
+            std::vector<ValueType>& upperX = *auxiliaryRowGroupVector2;
+            std::vector<ValueType>& newUpperX = *auxiliaryRowGroupVector3;
+            
+            // As we take the mean of the lower and the upper bound in the end, the bounds may be apart by twice the
+            // (absolute) precision.
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            if (!relative) {
+                precision *= storm::utility::convertNumber<ValueType>(2.0);
+            }
+            ValueType iterationPrecision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+            
+            SolverStatus status = SolverStatus::InProgress;
+            uint64_t iterations = 0;
+            uint64_t verifications = 0;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress) {
+                // Approach the solution from below until value iteration (heuristically) converges.
+                ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, iterationPrecision, relative, SolverGuarantee::LessOrEqual, iterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+                iterations += result.iterations;
+                if (result.status != SolverStatus::Converged) {
+                    status = result.status;
+                    break;
+                }
+                
+                // Guess an upper bound and check whether it is inductive, i.e. whether the Bellman operator does not
+                // increase any value. If so, the solution is below the guess and below its image.
+                ++verifications;
+                storm::utility::vector::applyPointwise<ValueType, ValueType>(*currentX, upperX, [&precision, &relative] (ValueType const& value) -> ValueType { return value + (relative ? storm::utility::abs<ValueType>(value) * precision : precision); });
+                this->multiplierA->multiplyAndReduce(env, dir, upperX, &b, newUpperX);
+                bool verified = true;
+                for (auto upperIt = upperX.begin(), newUpperIt = newUpperX.begin(); upperIt != upperX.end(); ++upperIt, ++newUpperIt) {
+                    if (*newUpperIt > *upperIt) {
+                        verified = false;
+                        break;
+                    }
+                }
+                
+                if (verified) {
+                    status = SolverStatus::Converged;
+                } else {
+                    // The guess was too optimistic, so we proceed with value iteration and a smaller precision.
+                    iterationPrecision /= two;
+                    STORM_LOG_TRACE("Guessed upper bound could not be verified after " << iterations << " iterations. Continuing with precision " << iterationPrecision << ".");
+                    if (iterations >= env.solver().minMax().getMaximalNumberOfIterations()) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                    }
+                }
+            }
+            
+            reportStatus(status, iterations);
+            STORM_LOG_DEBUG("Optimistic value iteration needed " << verifications << " verification step(s).");
+            
+            if (status == SolverStatus::Converged) {
+                // We take the means of the lower and the (verified) upper bound so we guarantee the desired precision.
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*currentX, newUpperX, *currentX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+            }
+            
+            // Since we shuffled the pointer around, we need to write the actual results to the input/output vector x.
+            if (currentX != &x) {
+                std::swap(x, *currentX);
+            }
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -1001,6 +1112,7 @@ namespace storm {
             multiplierA.reset();
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
+            auxiliaryRowGroupVector3.reset();
             soundValueIterationHelper.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
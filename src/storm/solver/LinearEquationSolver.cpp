@@ -30,6 +30,27 @@ namespace storm {
             return this->internalSolveEquations(env, x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_ASSERT(x.size() == b.size(), "The number of solution vectors does not match the number of right-hand sides.");
+            if (x.empty()) {
+                return true;
+            }
+            if (x.size() == 1) {
+                return this->internalSolveEquations(env, x.front(), b.front());
+            }
+            return this->internalSolveEquationsForMultipleRightHandSides(env, x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsForMultipleRightHandSides(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t index = 0; index < x.size(); ++index) {
+                result &= this->internalSolveEquations(env, x[index], b[index]);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const& env) const {
             return LinearEquationSolverRequirements();
@@ -48,6 +48,19 @@ namespace storm {
              */
             bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+            /*!
+             * Solves the equation system (in the format expected by the solver) for several right-hand sides at once.
+             * Solvers that support this traverse the matrix only once per iteration for all right-hand sides. Other
+             * solvers solve the equation systems one after the other.
+             *
+             * @param x The solution vectors that have to be computed. Each of them serves as the initial guess for the
+             * corresponding right-hand side. Their lengths must be equal to the number of rows of A.
+             * @param b The right-hand sides. Their number must match the number of solution vectors.
+             *
+             * @return true iff the equation systems for all right-hand sides could be solved.
+             */
+            bool solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+
             /*!
              * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
              * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -78,6 +91,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+
+            /*!
+             * Solves the equation system for several right-hand sides. By default, the systems are solved one after
+             * the other.
+             */
+            virtual bool internalSolveEquationsForMultipleRightHandSides(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
@@ -0,0 +1,117 @@
+#include "storm/solver/ModelMemoryProductMultiplier.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+
+#include "storm/storage/memorystructure/ImplicitSparseModelMemoryProduct.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        ModelMemoryProductMultiplier<ValueType>::ModelMemoryProductMultiplier(storm::storage::ImplicitSparseModelMemoryProduct<ValueType> const& product) : Multiplier<ValueType>(product.getModelTransitions()), product(product) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType>& ModelMemoryProductMultiplier<ValueType>::getCachedVector(uint64_t size) const {
+            if (this->cachedVector) {
+                this->cachedVector->resize(size);
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(size);
+            }
+            return *this->cachedVector;
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (&x == &result) {
+                std::vector<ValueType>& target = getCachedVector(product.getNumberOfRows());
+                product.multiply(x, b, target);
+                std::swap(result, target);
+            } else {
+                product.multiply(x, b, result);
+            }
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockWidth) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                target = &getCachedVector(x.size());
+            }
+            target->resize(product.getNumberOfRows() * blockWidth);
+
+            auto targetIt = target->begin();
+            for (uint64_t row = 0; row < product.getNumberOfRows(); ++row, targetIt += blockWidth) {
+                if (b) {
+                    std::copy(b->begin() + row * blockWidth, b->begin() + (row + 1) * blockWidth, targetIt);
+                } else {
+                    std::fill(targetIt, targetIt + blockWidth, storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : product.getRow(row)) {
+                    auto xIt = x.begin() + entry.getColumn() * blockWidth;
+                    for (auto valueIt = targetIt, valueIte = targetIt + blockWidth; valueIt != valueIte; ++valueIt, ++xIt) {
+                        *valueIt += entry.getValue() * (*xIt);
+                    }
+                }
+            }
+
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            product.multiplyGaussSeidel(x, b);
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(rowGroupIndices == product.getRowGroupIndices(), "The product multiplier only supports the row groups of the product.");
+            if (&x == &result) {
+                std::vector<ValueType>& target = getCachedVector(product.getNumberOfStates());
+                product.multiplyAndReduce(dir, x, b, target, choices);
+                std::swap(result, target);
+            } else {
+                product.multiplyAndReduce(dir, x, b, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(rowGroupIndices == product.getRowGroupIndices(), "The product multiplier only supports the row groups of the product.");
+            product.multiplyAndReduceGaussSeidel(dir, x, b, choices);
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            value += product.multiplyRow(rowIndex, x);
+        }
+
+        template<typename ValueType>
+        void ModelMemoryProductMultiplier<ValueType>::clearCache() const {
+            product.clearCache();
+            Multiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& ModelMemoryProductMultiplier<ValueType>::getRowGroupIndices() const {
+            return product.getRowGroupIndices();
+        }
+
+        template class ModelMemoryProductMultiplier<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class ModelMemoryProductMultiplier<storm::RationalNumber>;
+#endif
+
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class ImplicitSparseModelMemoryProduct;
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier that operates on the (implicit) product of a model and a memory structure, such that solvers
+         * relying on the multiplier interface can iterate on the product without building its matrix. The row groups
+         * of the multiplied matrix are the ones of the product (and not the ones of the model's transition matrix).
+         */
+        template<typename ValueType>
+        class ModelMemoryProductMultiplier : public Multiplier<ValueType> {
+        public:
+            /*!
+             * Creates a multiplier for the given product, which must outlive the multiplier.
+             */
+            ModelMemoryProductMultiplier(storm::storage::ImplicitSparseModelMemoryProduct<ValueType> const& product);
+            virtual ~ModelMemoryProductMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockWidth) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual void clearCache() const override;
+
+        protected:
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const override;
+
+        private:
+            // Retrieves the vector into which results are written if the input vector is also the result vector.
+            std::vector<ValueType>& getCachedVector(uint64_t size) const;
+
+            storm::storage::ImplicitSparseModelMemoryProduct<ValueType> const& product;
+        };
+
+    }
+}
@@ -7,6 +7,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
@@ -28,14 +29,81 @@ namespace storm {
         
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-            multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
+            multiplyAndReduce(env, dir, this->getRowGroupIndices(), x, b, result, choices);
         }
 
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
-            multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices);
+            multiplyAndReduceGaussSeidel(env, dir, this->getRowGroupIndices(), x, b, choices);
         }
     
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multiply(env, x1, b, result1);
+            multiply(env, x2, b, result2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyGaussSeidel2(Environment const& env, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b) const {
+            multiplyGaussSeidel(env, x1, b);
+            multiplyGaussSeidel(env, x2, b);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            multiplyAndReduce2(env, dir, this->getRowGroupIndices(), x1, x2, b, result1, result2, choices1, choices2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            multiplyAndReduce(env, dir, rowGroupIndices, x1, b, result1, choices1);
+            multiplyAndReduce(env, dir, rowGroupIndices, x2, b, result2, choices2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            multiplyAndReduceGaussSeidel2(env, dir, this->getRowGroupIndices(), x1, x2, b, choices1, choices2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x1, b, choices1);
+            multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x2, b, choices2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockWidth) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            target->resize(this->matrix.getRowCount() * blockWidth);
+            
+            auto targetIt = target->begin();
+            for (uint64_t row = 0; row < this->matrix.getRowCount(); ++row, targetIt += blockWidth) {
+                if (b) {
+                    std::copy(b->begin() + row * blockWidth, b->begin() + (row + 1) * blockWidth, targetIt);
+                } else {
+                    std::fill(targetIt, targetIt + blockWidth, storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : this->matrix.getRow(row)) {
+                    auto xIt = x.begin() + entry.getColumn() * blockWidth;
+                    for (auto valueIt = targetIt, valueIte = targetIt + blockWidth; valueIt != valueIte; ++valueIt, ++xIt) {
+                        *valueIt += entry.getValue() * (*xIt);
+                    }
+                }
+            }
+            
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
         template<typename ValueType>
         void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
             for (uint64_t i = 0; i < n; ++i) {
@@ -56,6 +124,11 @@ namespace storm {
             multiplyRow(rowIndex, x2, val2);
         }
         
+        template<typename ValueType>
+        std::vector<uint64_t> const& Multiplier<ValueType>::getRowGroupIndices() const {
+            return this->matrix.getRowGroupIndices();
+        }
+        
         template<typename ValueType>
         std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
             auto type = env.solver().multiplier().getType();
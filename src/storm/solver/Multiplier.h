@@ -41,6 +41,20 @@ namespace storm {
              * to the number of rows of A. Can be the same as the x vector.
              */
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const = 0;
+
+            /*!
+             * Performs a matrix-block multiplication X' = A*X + B, where X, B and X' are blocks with the given number of
+             * columns that are stored row-major, i.e. the entry of row i and column j is at position i * blockWidth + j.
+             * This multiplies the matrix with several vectors while traversing it only once.
+             *
+             * @param x The input block. Its length must be equal to the number of columns of A times the block width.
+             * @param b If non-null, this block is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A times the block width.
+             * @param result The target block into which to write the multiplication result. Its length must be equal
+             * to the number of rows of A times the block width. Can be the same as the x block.
+             * @param blockWidth The number of columns of the blocks.
+             */
+            virtual void multiplyBlock(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t blockWidth) const;
             
             /*!
              * Performs a matrix-vector multiplication in gauss-seidel style.
@@ -86,6 +100,67 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const = 0;
             
+            /*!
+             * Performs the matrix-vector multiplications x1' = A*x1 + b and x2' = A*x2 + b while traversing the matrix
+             * only once. This is used to improve a lower and an upper bound at the same time.
+             *
+             * @param x1 The first input vector. Its length must be equal to the number of columns of A.
+             * @param x2 The second input vector. Its length must be equal to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplications. If given, its length must be equal
+             * to the number of rows of A.
+             * @param result1 The target vector of the first multiplication. Its length must be equal to the number of
+             * rows of A. It must not coincide with one of the input vectors.
+             * @param result2 The target vector of the second multiplication. Its length must be equal to the number of
+             * rows of A. It must not coincide with one of the input vectors.
+             */
+            virtual void multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const;
+            
+            /*!
+             * Performs two matrix-vector multiplications in gauss-seidel style while traversing the matrix only once.
+             *
+             * @param x1 The first input/output vector. Its length must be equal to the number of columns of A.
+             * @param x2 The second input/output vector. Its length must be equal to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplications. If given, its length must be equal
+             * to the number of rows of A.
+             */
+            virtual void multiplyGaussSeidel2(Environment const& env, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b) const;
+            
+            /*!
+             * Performs the matrix-vector multiplications x1' = A*x1 + b and x2' = A*x2 + b and minimizes/maximizes both
+             * results over the row groups while traversing the matrix only once.
+             *
+             * @param dir The direction for the reduction steps.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x1 The first input vector. Its length must be equal to the number of columns of A.
+             * @param x2 The second input vector. Its length must be equal to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplications. If given, its length must be equal
+             * to the number of rows of A.
+             * @param result1 The target vector of the first multiplication. Its length must be equal to the number of
+             * row groups of A. It must not coincide with one of the input vectors.
+             * @param result2 The target vector of the second multiplication. Its length must be equal to the number of
+             * row groups of A. It must not coincide with one of the input vectors.
+             * @param choices1 If given, the choices made in the first reduction are written to this vector.
+             * @param choices2 If given, the choices made in the second reduction are written to this vector.
+             */
+            void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+            
+            /*!
+             * Performs two matrix-vector multiplications in gauss-seidel style and minimizes/maximizes both results over
+             * the row groups while traversing the matrix only once.
+             *
+             * @param dir The direction for the reduction steps.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x1 The first input/output vector. Its length must be equal to the number of columns of A.
+             * @param x2 The second input/output vector. Its length must be equal to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplications. If given, its length must be equal
+             * to the number of rows of A.
+             * @param choices1 If given, the choices made in the first reduction are written to this vector.
+             * @param choices2 If given, the choices made in the second reduction are written to this vector.
+             */
+            void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+            virtual void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -133,6 +208,12 @@ namespace storm {
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const;
             
         protected:
+            /*!
+             * Retrieves the row groups of the matrix that is multiplied. By default, these are the row groups of the
+             * given sparse matrix.
+             */
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const;
+            
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
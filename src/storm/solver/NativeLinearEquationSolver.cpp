@@ -11,6 +11,7 @@
 #include "storm/utility/vector.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -61,6 +62,13 @@ namespace storm {
             uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             bool relative = env.solver().native().getRelativeTerminationCriterion();
             
+            // With more than one thread, the rows of one color of a multicoloring are updated concurrently.
+            uint64_t numberOfThreads = env.solver().native().getNumberOfGaussSeidelThreads();
+            if (numberOfThreads > 1 && !this->multicolorGaussSeidelHelper) {
+                this->multicolorGaussSeidelHelper = std::make_unique<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>>(*A);
+                STORM_LOG_INFO("Performing the sweeps with " << numberOfThreads << " threads along a multicoloring with " << this->multicolorGaussSeidelHelper->getNumberOfColors() << " colors.");
+            }
+            
             // Set up additional environment variables.
             uint_fast64_t iterations = 0;
             bool converged = false;
@@ -68,7 +76,11 @@ namespace storm {
             
             this->startMeasureProgress();
             while (!converged && !terminate && iterations < maxIter) {
-                A->performSuccessiveOverRelaxationStep(omega, x, b);
+                if (numberOfThreads > 1) {
+                    this->multicolorGaussSeidelHelper->performSuccessiveOverRelaxationStep(omega, x, b, numberOfThreads);
+                } else {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b);
+                }
                 
                 // Now check if the process already converged within our precision.
                 converged = storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative);
@@ -181,7 +193,7 @@ namespace storm {
                     columnsWithNegativeEntries.set(e.getColumn());
                 }
             }
-            std::vector<uint64_t> columnsWithNegativeEntriesBefore = columnsWithNegativeEntries.getNumberOfSetBitsBeforeIndices();
+            storm::storage::BitVectorRankIndex columnsWithNegativeEntriesBefore(columnsWithNegativeEntries);
             
             // We now build an extended equation system matrix that only has non-negative coefficients.
             storm::storage::SparseMatrixBuilder<ValueType> builder;
@@ -190,7 +202,7 @@ namespace storm {
             for (; row < originalMatrix.getRowCount(); ++row) {
                 for (auto const& entry : originalMatrix.getRow(row)) {
                     if (entry.getValue() < zero) {
-                        builder.addNextValue(row, originalMatrix.getRowCount() + columnsWithNegativeEntriesBefore[entry.getColumn()], -entry.getValue());
+                        builder.addNextValue(row, originalMatrix.getRowCount() + columnsWithNegativeEntriesBefore.rank(entry.getColumn()), -entry.getValue());
                     } else {
                         builder.addNextValue(row, entry.getColumn(), entry.getValue());
                     }
@@ -199,7 +211,7 @@ namespace storm {
             ValueType one = storm::utility::one<ValueType>();
             for (auto column : columnsWithNegativeEntries) {
                 builder.addNextValue(row, column, one);
-                builder.addNextValue(row, originalMatrix.getRowCount() + columnsWithNegativeEntriesBefore[column], one);
+                builder.addNextValue(row, originalMatrix.getRowCount() + columnsWithNegativeEntriesBefore.rank(column), one);
                 ++row;
             }
             
@@ -377,6 +389,83 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsBlock(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b, bool useJacobi) const {
+            uint64_t const blockWidth = x.size();
+            uint64_t const rowCount = getMatrixRowCount();
+            STORM_LOG_INFO("Solving " << blockWidth << " linear equation systems (" << rowCount << " rows) with NativeLinearEquationSolver (" << (useJacobi ? "Jacobi" : "Power") << ")");
+            
+            storm::solver::Multiplier<ValueType> const* blockMultiplier;
+            if (useJacobi) {
+                if (!jacobiDecomposition) {
+                    jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, *A);
+                }
+                blockMultiplier = jacobiDecomposition->multiplier.get();
+            } else {
+                if (!this->multiplier) {
+                    this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                }
+                blockMultiplier = this->multiplier.get();
+            }
+            
+            // Arrange the solution vectors and the right-hand sides in row-major blocks.
+            std::vector<ValueType> currentX(rowCount * blockWidth);
+            std::vector<ValueType> blockB(rowCount * blockWidth);
+            for (uint64_t column = 0; column < blockWidth; ++column) {
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    currentX[row * blockWidth + column] = x[column][row];
+                    blockB[row * blockWidth + column] = b[column][row];
+                }
+            }
+            std::vector<ValueType> nextX(rowCount * blockWidth);
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            this->startMeasureProgress();
+            while (!converged && iterations < maxIter) {
+                if (useJacobi) {
+                    // Compute D^-1 * (B - LU * X) and store result in nextX.
+                    blockMultiplier->multiplyBlock(env, currentX, nullptr, nextX, blockWidth);
+                    auto nextIt = nextX.begin();
+                    auto bIt = blockB.begin();
+                    for (uint64_t row = 0; row < rowCount; ++row) {
+                        ValueType const& factor = jacobiDecomposition->DVector[row];
+                        for (uint64_t column = 0; column < blockWidth; ++column, ++nextIt, ++bIt) {
+                            *nextIt = factor * (*bIt - *nextIt);
+                        }
+                    }
+                } else {
+                    blockMultiplier->multiplyBlock(env, currentX, &blockB, nextX, blockWidth);
+                }
+                
+                // All systems have converged if every entry of the block has converged.
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(currentX, nextX, precision, relative);
+                std::swap(currentX, nextX);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                ++iterations;
+            }
+            
+            for (uint64_t column = 0; column < blockWidth; ++column) {
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    x[column][row] = currentX[row * blockWidth + column];
+                }
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, false, iterations);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -413,10 +502,16 @@ namespace storm {
             std::vector<ValueType>* upperX = this->cachedRowVector.get();
             
             bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
-            std::vector<ValueType>* tmp;
+            
+            // If both bounds are improved in one iteration, this is done in a single pass over the matrix, so a second
+            // auxiliary vector is needed.
+            std::vector<ValueType>* tmp = nullptr;
+            std::vector<ValueType>* tmp2 = nullptr;
             if (!useGaussSeidelMultiplication) {
                 cachedRowVector2 = std::make_unique<std::vector<ValueType>>(x.size());
+                cachedRowVector3 = std::make_unique<std::vector<ValueType>>(x.size());
                 tmp = cachedRowVector2.get();
+                tmp2 = cachedRowVector3.get();
             }
             
             if (!this->multiplier) {
@@ -429,8 +524,10 @@ namespace storm {
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues() && !env.solver().native().isSymmetricUpdatesSet();
             std::vector<ValueType> oldValues;
+            std::vector<ValueType> oldUpperValues;
             if (useGaussSeidelMultiplication && useDiffs) {
                 oldValues.resize(this->getRelevantValues().getNumberOfSetBits());
+                oldUpperValues.resize(this->getRelevantValues().getNumberOfSetBits());
             }
             ValueType maxLowerDiff = storm::utility::zero<ValueType>();
             ValueType maxUpperDiff = storm::utility::zero<ValueType>();
@@ -453,27 +550,21 @@ namespace storm {
                     if (useGaussSeidelMultiplication) {
                         if (useDiffs) {
                             preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
+                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
-                        this->multiplier->multiplyGaussSeidel(env, *lowerX, &b);
+                        this->multiplier->multiplyGaussSeidel2(env, *lowerX, *upperX, &b);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
-                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
-                        }
-                        this->multiplier->multiplyGaussSeidel(env, *upperX, &b);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
                     } else {
-                        this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                        this->multiplier->multiply2(env, *lowerX, *upperX, &b, *tmp, *tmp2);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp2, this->getRelevantValues());
                         }
                         std::swap(tmp, lowerX);
-                        this->multiplier->multiply(env, *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
-                        std::swap(tmp, upperX);
+                        std::swap(tmp2, upperX);
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
@@ -550,10 +641,8 @@ namespace storm {
             storm::utility::vector::applyPointwise(*lowerX, *upperX, *lowerX, [] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / storm::utility::convertNumber<ValueType>(2.0); });
 
             // Since we shuffled the pointer around, we need to write the actual results to the input/output vector x.
-            if (&x == tmp) {
-                std::swap(x, *tmp);
-            } else if (&x == this->cachedRowVector.get()) {
-                std::swap(x, *this->cachedRowVector);
+            if (lowerX != &x) {
+                std::swap(x, *lowerX);
             }
             
             if (!this->isCachingEnabled()) {
@@ -944,6 +1033,21 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsForMultipleRightHandSides(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Jacobi and (non-Gauss-Seidel) power iterations can be performed on all right-hand sides at once.
+            // Termination conditions are formulated over single vectors, so they prevent this.
+            if (!this->hasCustomTerminationCondition()) {
+                auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+                if (method == NativeLinearEquationSolverMethod::Jacobi) {
+                    return this->solveEquationsBlock(env, x, b, true);
+                } else if (method == NativeLinearEquationSolverMethod::Power && env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular) {
+                    return this->solveEquationsBlock(env, x, b, false);
+                }
+            }
+            return LinearEquationSolver<ValueType>::internalSolveEquationsForMultipleRightHandSides(env, x, b);
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
@@ -972,9 +1076,11 @@ namespace storm {
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
             cachedRowVector2.reset();
+            cachedRowVector3.reset();
             walkerChaeData.reset();
             multiplier.reset();
             soundValueIterationHelper.reset();
+            multicolorGaussSeidelHelper.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -8,6 +8,7 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/MulticolorGaussSeidelHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 
 #include "storm/utility/NumberTraits.h"
@@ -38,6 +39,7 @@ namespace storm {
 
         protected:
             virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsForMultipleRightHandSides(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
             
         private:
             struct PowerIterationResult {
@@ -69,6 +71,12 @@ namespace storm {
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+            /*!
+             * Solves the equation systems for all given right-hand sides simultaneously by iterating on a row-major
+             * block that holds all solution vectors. Depending on the flag, this performs Jacobi or power iterations.
+             */
+            bool solveEquationsBlock(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b, bool useJacobi) const;
+
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
             template<typename ImpreciseType>
@@ -94,7 +102,9 @@ namespace storm {
 
             // cached auxiliary data
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2; // A.getRowCount() rows
+            mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector3; // A.getRowCount() rows
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>> multicolorGaussSeidelHelper;
             
             struct JacobiDecomposition {
                 JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
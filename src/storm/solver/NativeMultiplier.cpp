@@ -3,6 +3,7 @@
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
@@ -11,8 +12,11 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace solver {
         
@@ -53,7 +57,15 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
-            this->matrix.multiplyWithVectorBackward(x, x, b);
+            uint64_t numberOfThreads = env.solver().native().getNumberOfGaussSeidelThreads();
+            if (numberOfThreads > 1) {
+                if (!multicolorRowHelper) {
+                    multicolorRowHelper = std::make_unique<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>>(this->matrix);
+                }
+                multicolorRowHelper->multiplyGaussSeidel(x, b, numberOfThreads);
+            } else {
+                this->matrix.multiplyWithVectorBackward(x, x, b);
+            }
         }
         
         template<typename ValueType>
@@ -79,7 +91,112 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
-            this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            uint64_t numberOfThreads = env.solver().native().getNumberOfGaussSeidelThreads();
+            if (numberOfThreads > 1) {
+                if (!multicolorRowGroupHelper || multicolorRowGroupHelper->getRowGroupIndices() != rowGroupIndices) {
+                    multicolorRowGroupHelper = std::make_unique<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>>(this->matrix, rowGroupIndices);
+                }
+                multicolorRowGroupHelper->multiplyAndReduceGaussSeidel(dir, x, b, choices, numberOfThreads);
+            } else {
+                this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            if (parallelize(env)) {
+                Multiplier<ValueType>::multiply2(env, x1, x2, b, result1, result2);
+                return;
+            }
+            STORM_LOG_ASSERT(&x1 != &result1 && &x1 != &result2 && &x2 != &result1 && &x2 != &result2, "The input and the result vectors must not coincide.");
+            for (uint64_t row = 0; row < this->matrix.getRowCount(); ++row) {
+                ValueType value1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                ValueType value2 = value1;
+                multiplyRow2(row, x1, value1, x2, value2);
+                result1[row] = std::move(value1);
+                result2[row] = std::move(value2);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyGaussSeidel2(Environment const& env, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b) const {
+            if (env.solver().native().getNumberOfGaussSeidelThreads() > 1) {
+                Multiplier<ValueType>::multiplyGaussSeidel2(env, x1, x2, b);
+                return;
+            }
+            // As in multiplyGaussSeidel, the rows are processed backwards.
+            for (uint64_t row = this->matrix.getRowCount(); row > 0;) {
+                --row;
+                ValueType value1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                ValueType value2 = value1;
+                multiplyRow2(row, x1, value1, x2, value2);
+                x1[row] = std::move(value1);
+                x2[row] = std::move(value2);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            if (parallelize(env)) {
+                Multiplier<ValueType>::multiplyAndReduce2(env, dir, rowGroupIndices, x1, x2, b, result1, result2, choices1, choices2);
+                return;
+            }
+            STORM_LOG_ASSERT(&x1 != &result1 && &x1 != &result2 && &x2 != &result1 && &x2 != &result2, "The input and the result vectors must not coincide.");
+            uint_fast64_t choice1, choice2;
+            for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+                multiplyAndReduceRowGroup2(dir, rowGroupIndices, group, x1, x2, b, result1[group], result2[group], choice1, choice2);
+                if (choices1) {
+                    (*choices1)[group] = choice1;
+                }
+                if (choices2) {
+                    (*choices2)[group] = choice2;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+            if (env.solver().native().getNumberOfGaussSeidelThreads() > 1) {
+                Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(env, dir, rowGroupIndices, x1, x2, b, choices1, choices2);
+                return;
+            }
+            // As in multiplyAndReduceGaussSeidel, the row groups are processed backwards.
+            ValueType value1, value2;
+            uint_fast64_t choice1, choice2;
+            for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+                --group;
+                multiplyAndReduceRowGroup2(dir, rowGroupIndices, group, x1, x2, b, value1, value2, choice1, choice2);
+                x1[group] = std::move(value1);
+                x2[group] = std::move(value2);
+                if (choices1) {
+                    (*choices1)[group] = choice1;
+                }
+                if (choices2) {
+                    (*choices2)[group] = choice2;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduceRowGroup2(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t group, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, ValueType& value1, ValueType& value2, uint_fast64_t& choice1, uint_fast64_t& choice2) const {
+            value1 = storm::utility::zero<ValueType>();
+            value2 = storm::utility::zero<ValueType>();
+            choice1 = 0;
+            choice2 = 0;
+            for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                ValueType newValue1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                ValueType newValue2 = newValue1;
+                multiplyRow2(row, x1, newValue1, x2, newValue2);
+                bool firstRow = row == rowGroupIndices[group];
+                if (firstRow || (dir == OptimizationDirection::Minimize && newValue1 < value1) || (dir == OptimizationDirection::Maximize && newValue1 > value1)) {
+                    value1 = std::move(newValue1);
+                    choice1 = row - rowGroupIndices[group];
+                }
+                if (firstRow || (dir == OptimizationDirection::Minimize && newValue2 < value2) || (dir == OptimizationDirection::Maximize && newValue2 > value2)) {
+                    value2 = std::move(newValue2);
+                    choice2 = row - rowGroupIndices[group];
+                }
+            }
         }
         
         template<typename ValueType>
@@ -98,6 +215,13 @@ namespace storm {
         }
 
 
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            multicolorRowHelper.reset();
+            multicolorRowGroupHelper.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             this->matrix.multiplyWithVector(x, result, b);
@@ -128,6 +252,24 @@ namespace storm {
 #endif
         }
 
+#ifdef STORM_HAVE_CARL
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multiplyGaussSeidel(Environment const& env, std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b) const {
+            // Rational functions are not processed concurrently.
+            this->matrix.multiplyWithVectorBackward(x, x, b);
+        }
+        
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multiplyAndReduceRowGroup2(OptimizationDirection const&, std::vector<uint64_t> const&, uint64_t, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, storm::RationalFunction&, storm::RationalFunction&, uint_fast64_t&, uint_fast64_t&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b, std::vector<uint_fast64_t>* choices) const {
+            this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+        }
+#endif
+        
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
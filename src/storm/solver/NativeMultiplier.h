@@ -3,6 +3,7 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/MulticolorGaussSeidelHelper.h"
 
 namespace storm {
     namespace storage {
@@ -22,8 +23,13 @@ namespace storm {
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const override;
+            virtual void multiplyGaussSeidel2(Environment const& env, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
 
         private:
             bool parallelize(Environment const& env) const;
@@ -35,6 +41,12 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            // Multiplies the rows of the given row group with both vectors and reduces the results (independently).
+            void multiplyAndReduceRowGroup2(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t group, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, ValueType& value1, ValueType& value2, uint_fast64_t& choice1, uint_fast64_t& choice2) const;
+            
+            // Multicolorings of the rows and of the row groups used for concurrent Gauss-Seidel multiplications.
+            mutable std::unique_ptr<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>> multicolorRowHelper;
+            mutable std::unique_ptr<storm::solver::helper::MulticolorGaussSeidelHelper<ValueType>> multicolorRowGroupHelper;
         };
         
     }
@@ -286,6 +286,14 @@ namespace storm {
              */
             virtual bool unsetTimeout();
             
+            /*!
+             * If supported by the solver, this interrupts the satisfiability query that is currently running (if any),
+             * which then yields an unknown result. This may be called from a thread other than the one using the solver.
+             *
+             * @return True iff the solver supports interruption.
+             */
+            virtual bool interrupt();
+            
 			/*!
 			 * If supported by the solver, this function returns the current assertions in the SMT-LIB format.
 			 *
@@ -4,6 +4,9 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
+
+#include "storm/solver/helper/SymbolicFrontierIterationHelper.h"
 
 #include "storm/utility/constants.h"
 
@@ -50,6 +53,7 @@ namespace storm {
 
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType>  SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquations(Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            storm::dd::DdOperationScope scope("SymbolicMinMaxLinearEquationSolver::solveEquations");
             STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
             
             switch (getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
@@ -69,18 +73,30 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, bool frontierIteration) const {
 
             // Set up local variables.
             storm::dd::Add<DdType, ValueType> localX = x;
             uint64_t iterations = 0;
             
+            // If requested, we only update the states having a successor whose value changed (by more than the precision)
+            // in the previous iteration. The values of all other states are frozen.
+            boost::optional<helper::SymbolicFrontierIterationHelper<DdType, ValueType>> frontier;
+            if (frontierIteration) {
+                frontier.emplace(this->A.notZero().existsAbstract(this->choiceVariables), this->allRows, this->rowColumnMetaVariablePairs, this->columnMetaVariables);
+            }
+            
             // Value iteration loop.
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && iterations < maximalIterations) {
                 // Compute tmp = A * x + b
                 storm::dd::Add<DdType, ValueType> localXAsColumn = localX.swapVariables(this->rowColumnMetaVariablePairs);
-                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(localXAsColumn, this->columnMetaVariables);
+                storm::dd::Add<DdType, ValueType> tmp;
+                if (frontier) {
+                    tmp = frontier->restrictToFrontier(this->A).multiplyMatrix(localXAsColumn, this->columnMetaVariables);
+                } else {
+                    tmp = this->A.multiplyMatrix(localXAsColumn, this->columnMetaVariables);
+                }
                 tmp += b;
                 
                 if (dir == storm::solver::OptimizationDirection::Minimize) {
@@ -90,9 +106,15 @@ namespace storm {
                     tmp = tmp.maxAbstract(this->choiceVariables);
                 }
                 
+                if (frontier) {
+                    tmp = frontier->freezeOutsideFrontier(tmp, localX);
+                }
+                
                 // Now check if the process already converged within our precision.
                 if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
                     status = SolverStatus::Converged;
+                } else if (frontier) {
+                    frontier->updateFrontier(tmp, localX, precision, relativeTerminationCriterion);
                 }
 
                 // Set up next iteration.
@@ -157,7 +179,7 @@ namespace storm {
             bool relative = env.solver().minMax().getRelativeTerminationCriterion();
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && overallIterations < maxIter) {
-                typename SymbolicMinMaxLinearEquationSolver<DdType, ImpreciseType>::ValueIterationResult viResult = impreciseSolver.performValueIteration(dir, currentX, b, storm::utility::convertNumber<ImpreciseType, ValueType>(precision), relative, maxIter);
+                typename SymbolicMinMaxLinearEquationSolver<DdType, ImpreciseType>::ValueIterationResult viResult = impreciseSolver.performValueIteration(dir, currentX, b, storm::utility::convertNumber<ImpreciseType, ValueType>(precision), relative, maxIter, env.solver().minMax().isSymbolicFrontierIterationSet());
                 
                 ++valueIterationInvocations;
                 STORM_LOG_TRACE("Completed " << valueIterationInvocations << " value iteration invocations, the last one with precision " << precision << " completed in " << viResult.iterations << " iterations.");
@@ -273,7 +295,7 @@ namespace storm {
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().isSymbolicFrontierIterationSet());
             
             if (viResult.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
@@ -2,6 +2,9 @@
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
+
+#include "storm/solver/helper/SymbolicFrontierIterationHelper.h"
 
 #include "storm/utility/dd.h"
 #include "storm/utility/constants.h"
@@ -58,6 +61,7 @@ namespace storm {
 
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType>  SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquations(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            storm::dd::DdOperationScope scope("SymbolicNativeLinearEquationSolver::solveEquations");
             switch(getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
                 case NativeLinearEquationSolverMethod::Jacobi:
                     return solveEquationsJacobi(env, x, b);
@@ -97,13 +101,28 @@ namespace storm {
             uint_fast64_t iterationCount = 0;
             bool converged = false;
             
+            // If requested, we only update the rows having a successor whose value changed (by more than the precision)
+            // in the previous iteration.
+            boost::optional<helper::SymbolicFrontierIterationHelper<DdType, ValueType>> frontier;
+            if (env.solver().native().isSymbolicFrontierIterationSet()) {
+                frontier.emplace(scaledLu.notZero(), this->allRows, this->rowColumnMetaVariablePairs, this->columnMetaVariables);
+            }
+            
             while (!converged && iterationCount < maxIter) {
                 storm::dd::Add<DdType, ValueType> xCopyAsColumn = xCopy.swapVariables(this->rowColumnMetaVariablePairs);
-                storm::dd::Add<DdType, ValueType> tmp = scaledB - scaledLu.multiplyMatrix(xCopyAsColumn, this->columnMetaVariables);
+                storm::dd::Add<DdType, ValueType> tmp;
+                if (frontier) {
+                    tmp = frontier->freezeOutsideFrontier(scaledB - frontier->restrictToFrontier(scaledLu).multiplyMatrix(xCopyAsColumn, this->columnMetaVariables), xCopy);
+                } else {
+                    tmp = scaledB - scaledLu.multiplyMatrix(xCopyAsColumn, this->columnMetaVariables);
+                }
                 
                 // Now check if the process already converged within our precision.
                 converged = tmp.equalModuloPrecision(xCopy, precision, relative);
                 
+                if (frontier && !converged) {
+                    frontier->updateFrontier(tmp, xCopy, precision, relative);
+                }
                 xCopy = tmp;
                 
                 // Increase iteration count so we can abort if convergence is too slow.
@@ -120,20 +139,34 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, bool frontierIteration) const {
             
             // Set up additional environment variables.
             storm::dd::Add<DdType, ValueType> currentX = x;
             uint_fast64_t iterations = 0;
             SolverStatus status = SolverStatus::InProgress;
             
+            // If requested, we only update the rows having a successor whose value changed (by more than the precision)
+            // in the previous iteration.
+            boost::optional<helper::SymbolicFrontierIterationHelper<DdType, ValueType>> frontier;
+            if (frontierIteration) {
+                frontier.emplace(this->A.notZero(), this->allRows, this->rowColumnMetaVariablePairs, this->columnMetaVariables);
+            }
+            
             while (status == SolverStatus::InProgress && iterations < maximalIterations) {
                 storm::dd::Add<DdType, ValueType> currentXAsColumn = currentX.swapVariables(this->rowColumnMetaVariablePairs);
-                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b;
+                storm::dd::Add<DdType, ValueType> tmp;
+                if (frontier) {
+                    tmp = frontier->freezeOutsideFrontier(frontier->restrictToFrontier(this->A).multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b, currentX);
+                } else {
+                    tmp = this->A.multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b;
+                }
                 
                 // Now check if the process already converged within our precision.
                 if (tmp.equalModuloPrecision(currentX, precision, relativeTerminationCriterion)) {
                     status = SolverStatus::Converged;
+                } else if (frontier) {
+                    frontier->updateFrontier(tmp, currentX, precision, relativeTerminationCriterion);
                 }
                 
                 // Set up next iteration.
@@ -148,7 +181,7 @@ namespace storm {
         storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), env.solver().native().isSymbolicFrontierIterationSet());
             
             if (result.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
@@ -202,7 +235,7 @@ namespace storm {
             bool relative = env.solver().native().getRelativeTerminationCriterion();
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && overallIterations < maxIter) {
-                typename SymbolicNativeLinearEquationSolver<DdType, ImpreciseType>::PowerIterationResult result = impreciseSolver.performPowerIteration(currentX, b, storm::utility::convertNumber<ImpreciseType, ValueType>(precision), relative, maxIter - overallIterations);
+                typename SymbolicNativeLinearEquationSolver<DdType, ImpreciseType>::PowerIterationResult result = impreciseSolver.performPowerIteration(currentX, b, storm::utility::convertNumber<ImpreciseType, ValueType>(precision), relative, maxIter - overallIterations, env.solver().native().isSymbolicFrontierIterationSet());
                 
                 ++powerIterationInvocations;
                 STORM_LOG_TRACE("Completed " << powerIterationInvocations << " power iteration invocations, the last one with precision " << precision << " completed in " << result.iterations << " iterations.");
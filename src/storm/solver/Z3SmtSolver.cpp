@@ -360,6 +360,15 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
 #endif
         }
+        
+        bool Z3SmtSolver::interrupt() {
+#ifdef STORM_HAVE_Z3
+            context->interrupt();
+            return true;
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
+#endif
+        }
 		
 		std::string Z3SmtSolver::getSmtLibString() const {
 #ifdef STORM_HAVE_Z3
@@ -70,6 +70,8 @@ namespace storm {
             virtual bool setTimeout(uint_fast64_t milliseconds) override;
             
             virtual bool unsetTimeout() override;
+            
+            virtual bool interrupt() override;
 			
 			virtual std::string getSmtLibString() const override;
             
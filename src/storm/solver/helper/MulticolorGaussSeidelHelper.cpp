@@ -0,0 +1,321 @@
+#include "storm/solver/helper/MulticolorGaussSeidelHelper.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace {
+                // Blocks the threads of a sweep until all of them are done with the current color.
+                class ColorBarrier {
+                public:
+                    ColorBarrier(uint64_t numberOfThreads) : numberOfThreads(numberOfThreads), numberOfWaitingThreads(0), generation(0) {
+                        // Intentionally left empty.
+                    }
+
+                    void wait() {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        uint64_t currentGeneration = generation;
+                        if (++numberOfWaitingThreads == numberOfThreads) {
+                            numberOfWaitingThreads = 0;
+                            ++generation;
+                            lock.unlock();
+                            condition.notify_all();
+                        } else {
+                            condition.wait(lock, [&] { return generation != currentGeneration; });
+                        }
+                    }
+
+                private:
+                    uint64_t const numberOfThreads;
+                    uint64_t numberOfWaitingThreads;
+                    uint64_t generation;
+                    std::mutex mutex;
+                    std::condition_variable condition;
+                };
+            }
+
+            /*!
+             * A fixed set of threads that repeatedly perform work together with the calling thread.
+             */
+            class SweepWorkers {
+            public:
+                /*!
+                 * Starts the given number of threads minus one, as the calling thread participates in the work.
+                 */
+                SweepWorkers(uint64_t numberOfThreads) : numberOfThreads(numberOfThreads), barrier(numberOfThreads), generation(0), numberOfBusyWorkers(0), stop(false), currentWork(nullptr) {
+                    for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                        threads.emplace_back([this, threadIndex] { this->run(threadIndex); });
+                    }
+                }
+
+                ~SweepWorkers() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stop = true;
+                    }
+                    startCondition.notify_all();
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+                }
+
+                uint64_t getNumberOfThreads() const {
+                    return numberOfThreads;
+                }
+
+                /*!
+                 * Retrieves a barrier for all threads (including the calling thread).
+                 */
+                ColorBarrier& getBarrier() {
+                    return barrier;
+                }
+
+                /*!
+                 * Calls the given work with the index of each thread, where the calling thread has index zero, and
+                 * returns as soon as all threads are done.
+                 */
+                void perform(std::function<void(uint64_t)> const& work) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        currentWork = &work;
+                        numberOfBusyWorkers = numberOfThreads - 1;
+                        ++generation;
+                    }
+                    startCondition.notify_all();
+                    work(0);
+                    std::unique_lock<std::mutex> lock(mutex);
+                    doneCondition.wait(lock, [&] { return numberOfBusyWorkers == 0; });
+                    currentWork = nullptr;
+                }
+
+            private:
+                void run(uint64_t threadIndex) {
+                    uint64_t lastGeneration = 0;
+                    while (true) {
+                        std::function<void(uint64_t)> const* work;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            startCondition.wait(lock, [&] { return stop || generation != lastGeneration; });
+                            if (stop) {
+                                return;
+                            }
+                            lastGeneration = generation;
+                            work = currentWork;
+                        }
+                        (*work)(threadIndex);
+                        std::unique_lock<std::mutex> lock(mutex);
+                        if (--numberOfBusyWorkers == 0) {
+                            lock.unlock();
+                            doneCondition.notify_one();
+                        }
+                    }
+                }
+
+                uint64_t const numberOfThreads;
+                ColorBarrier barrier;
+                std::vector<std::thread> threads;
+
+                // The state below is guarded by the mutex.
+                std::mutex mutex;
+                std::condition_variable startCondition;
+                std::condition_variable doneCondition;
+                uint64_t generation;
+                uint64_t numberOfBusyWorkers;
+                bool stop;
+                std::function<void(uint64_t)> const* currentWork;
+            };
+
+            template<typename ValueType>
+            MulticolorGaussSeidelHelper<ValueType>::MulticolorGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix), rowGroupIndices(matrix.getRowCount() + 1) {
+                std::iota(rowGroupIndices.begin(), rowGroupIndices.end(), 0);
+                computeColoring();
+            }
+
+            template<typename ValueType>
+            MulticolorGaussSeidelHelper<ValueType>::MulticolorGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices) : matrix(matrix), rowGroupIndices(rowGroupIndices) {
+                computeColoring();
+            }
+
+            template<typename ValueType>
+            MulticolorGaussSeidelHelper<ValueType>::~MulticolorGaussSeidelHelper() = default;
+
+            template<typename ValueType>
+            std::vector<uint64_t> const& MulticolorGaussSeidelHelper<ValueType>::getRowGroupIndices() const {
+                return rowGroupIndices;
+            }
+
+            template<typename ValueType>
+            uint64_t MulticolorGaussSeidelHelper<ValueType>::getNumberOfColors() const {
+                return colorIndications.size() - 1;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> MulticolorGaussSeidelHelper<ValueType>::getRowGroupsOfColor(uint64_t color) const {
+                STORM_LOG_ASSERT(color < getNumberOfColors(), "Invalid color: " << color << ".");
+                return std::vector<uint64_t>(groupsByColor.begin() + colorIndications[color], groupsByColor.begin() + colorIndications[color + 1]);
+            }
+
+            template<typename ValueType>
+            void MulticolorGaussSeidelHelper<ValueType>::computeColoring() {
+                uint64_t numberOfGroups = rowGroupIndices.size() - 1;
+                STORM_LOG_ASSERT(matrix.getColumnCount() <= numberOfGroups, "The columns of the matrix do not refer to row groups.");
+
+                // Collect for each row group the row groups it reads from or that read from it. The (undirected) edges
+                // are stored twice, once for each end.
+                std::vector<uint64_t> neighborIndications(numberOfGroups + 1, 0);
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    for (auto entryIt = matrix.begin(rowGroupIndices[group]), entryIte = matrix.begin(rowGroupIndices[group + 1]); entryIt != entryIte; ++entryIt) {
+                        if (entryIt->getColumn() != group) {
+                            ++neighborIndications[group + 1];
+                            ++neighborIndications[entryIt->getColumn() + 1];
+                        }
+                    }
+                }
+                std::partial_sum(neighborIndications.begin(), neighborIndications.end(), neighborIndications.begin());
+                std::vector<uint64_t> neighbors(neighborIndications.back());
+                std::vector<uint64_t> nextNeighborPosition(neighborIndications.begin(), neighborIndications.end() - 1);
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    for (auto entryIt = matrix.begin(rowGroupIndices[group]), entryIte = matrix.begin(rowGroupIndices[group + 1]); entryIt != entryIte; ++entryIt) {
+                        if (entryIt->getColumn() != group) {
+                            neighbors[nextNeighborPosition[group]++] = entryIt->getColumn();
+                            neighbors[nextNeighborPosition[entryIt->getColumn()]++] = group;
+                        }
+                    }
+                }
+
+                // Assign to each row group the smallest color that none of its (already colored) neighbors has. A color
+                // is forbidden for the current group iff it is marked with the index of the group.
+                std::vector<uint64_t> colors(numberOfGroups);
+                std::vector<uint64_t> forbiddingGroup;
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    for (uint64_t neighborIndex = neighborIndications[group]; neighborIndex < neighborIndications[group + 1]; ++neighborIndex) {
+                        if (neighbors[neighborIndex] < group) {
+                            forbiddingGroup[colors[neighbors[neighborIndex]]] = group;
+                        }
+                    }
+                    uint64_t color = 0;
+                    while (color < forbiddingGroup.size() && forbiddingGroup[color] == group) {
+                        ++color;
+                    }
+                    if (color == forbiddingGroup.size()) {
+                        forbiddingGroup.push_back(numberOfGroups);
+                    }
+                    colors[group] = color;
+                }
+
+                // Sort the row groups by their color. Within a color, the groups keep their order.
+                colorIndications.assign(forbiddingGroup.size() + 1, 0);
+                for (auto const& color : colors) {
+                    ++colorIndications[color + 1];
+                }
+                std::partial_sum(colorIndications.begin(), colorIndications.end(), colorIndications.begin());
+                groupsByColor.resize(numberOfGroups);
+                std::vector<uint64_t> nextGroupPosition(colorIndications.begin(), colorIndications.end() - 1);
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    groupsByColor[nextGroupPosition[colors[group]]++] = group;
+                }
+                STORM_LOG_DEBUG("Colored " << numberOfGroups << " row groups with " << getNumberOfColors() << " colors.");
+            }
+
+            template<typename ValueType>
+            template<typename GroupOperation>
+            void MulticolorGaussSeidelHelper<ValueType>::sweep(GroupOperation const& operation, uint64_t numberOfThreads) const {
+                if (numberOfThreads <= 1) {
+                    for (auto const& group : groupsByColor) {
+                        operation(group);
+                    }
+                    return;
+                }
+
+                if (!workers || workers->getNumberOfThreads() != numberOfThreads) {
+                    workers.reset();
+                    workers = std::make_unique<SweepWorkers>(numberOfThreads);
+                }
+
+                // The threads wait for each other after each color but the last one, as the sweep only returns once all
+                // threads are done.
+                uint64_t numberOfColors = getNumberOfColors();
+                ColorBarrier& barrier = workers->getBarrier();
+                workers->perform([&] (uint64_t threadIndex) {
+                    for (uint64_t color = 0; color < numberOfColors; ++color) {
+                        if (color > 0) {
+                            barrier.wait();
+                        }
+                        uint64_t colorBegin = colorIndications[color];
+                        uint64_t colorSize = colorIndications[color + 1] - colorBegin;
+                        for (uint64_t index = colorBegin + colorSize * threadIndex / numberOfThreads, end = colorBegin + colorSize * (threadIndex + 1) / numberOfThreads; index < end; ++index) {
+                            operation(groupsByColor[index]);
+                        }
+                    }
+                });
+            }
+
+            template<typename ValueType>
+            void MulticolorGaussSeidelHelper<ValueType>::performSuccessiveOverRelaxationStep(ValueType const& omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfThreads) const {
+                STORM_LOG_ASSERT(matrix.getRowCount() == rowGroupIndices.size() - 1, "SOR requires a trivial row grouping.");
+                ValueType oneMinusOmega = storm::utility::one<ValueType>() - omega;
+                sweep([&] (uint64_t row) {
+                    ValueType tmpValue = storm::utility::zero<ValueType>();
+                    ValueType diagonalElement = storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != row) {
+                            tmpValue += entry.getValue() * x[entry.getColumn()];
+                        } else {
+                            diagonalElement += entry.getValue();
+                        }
+                    }
+                    STORM_LOG_ASSERT(!storm::utility::isZero(diagonalElement), "Row " << row << " has no diagonal element.");
+                    x[row] = (oneMinusOmega * x[row]) + (omega / diagonalElement) * (b[row] - tmpValue);
+                }, numberOfThreads);
+            }
+
+            template<typename ValueType>
+            void MulticolorGaussSeidelHelper<ValueType>::multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfThreads) const {
+                STORM_LOG_ASSERT(matrix.getRowCount() == rowGroupIndices.size() - 1, "Gauss-Seidel multiplication requires a trivial row grouping.");
+                sweep([&] (uint64_t row) {
+                    ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        newValue += entry.getValue() * x[entry.getColumn()];
+                    }
+                    x[row] = std::move(newValue);
+                }, numberOfThreads);
+            }
+
+            template<typename ValueType>
+            void MulticolorGaussSeidelHelper<ValueType>::multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const {
+                sweep([&] (uint64_t group) {
+                    ValueType currentValue = storm::utility::zero<ValueType>();
+                    uint_fast64_t currentChoice = 0;
+                    for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                        ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                        for (auto const& entry : matrix.getRow(row)) {
+                            newValue += entry.getValue() * x[entry.getColumn()];
+                        }
+                        if (row == rowGroupIndices[group] || (dir == OptimizationDirection::Minimize && newValue < currentValue) || (dir == OptimizationDirection::Maximize && newValue > currentValue)) {
+                            currentValue = std::move(newValue);
+                            currentChoice = row - rowGroupIndices[group];
+                        }
+                    }
+                    x[group] = std::move(currentValue);
+                    if (choices) {
+                        (*choices)[group] = currentChoice;
+                    }
+                }, numberOfThreads);
+            }
+
+            template class MulticolorGaussSeidelHelper<double>;
+            template class MulticolorGaussSeidelHelper<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            class SweepWorkers;
+
+            /*!
+             * Performs Gauss-Seidel sweeps concurrently by means of a multicoloring of the matrix: The row groups are
+             * colored such that no row group reads the value of another row group of the same color. The row groups of
+             * one color can thus be updated concurrently and a sweep over the colors (one after another) coincides with a
+             * sequential Gauss-Seidel sweep in which the row groups are ordered by their color. As the outcome of a sweep
+             * does not depend on the number of threads, the convergence properties of (sequential) Gauss-Seidel and SOR
+             * carry over.
+             * The threads that perform the sweeps are created by the first concurrent sweep and are reused by all
+             * further sweeps until the helper is destroyed.
+             */
+            template<typename ValueType>
+            class MulticolorGaussSeidelHelper {
+            public:
+                /*!
+                 * Colors the rows of the given (square) matrix.
+                 */
+                MulticolorGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Colors the row groups of the given matrix w.r.t. the given row grouping. The column of an entry refers
+                 * to the row group whose value is read.
+                 */
+                MulticolorGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices);
+
+                ~MulticolorGaussSeidelHelper();
+
+                /*!
+                 * Retrieves the row grouping w.r.t. which the coloring was computed.
+                 */
+                std::vector<uint64_t> const& getRowGroupIndices() const;
+
+                uint64_t getNumberOfColors() const;
+
+                /*!
+                 * Retrieves the row groups that have the given color.
+                 */
+                std::vector<uint64_t> getRowGroupsOfColor(uint64_t color) const;
+
+                /*!
+                 * Performs one SOR step for the system Ax = b, where A is the (square) matrix of this helper. This is the
+                 * counterpart of SparseMatrix::performSuccessiveOverRelaxationStep.
+                 */
+                void performSuccessiveOverRelaxationStep(ValueType const& omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfThreads) const;
+
+                /*!
+                 * Performs the Gauss-Seidel multiplication x = Ax + b. This is the counterpart of
+                 * Multiplier::multiplyGaussSeidel.
+                 */
+                void multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfThreads) const;
+
+                /*!
+                 * Performs the Gauss-Seidel multiplication x = Ax + b and reduces each row group to its minimal (or
+                 * maximal) value. This is the counterpart of Multiplier::multiplyAndReduceGaussSeidel.
+                 */
+                void multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const;
+
+            private:
+                // Greedily colors the row groups, such that row groups that read each other's values get distinct colors.
+                void computeColoring();
+
+                // Applies the given operation to all row groups, color by color. The row groups of one color are
+                // distributed among the given number of threads, which wait for each other before the next color.
+                template<typename GroupOperation>
+                void sweep(GroupOperation const& operation, uint64_t numberOfThreads) const;
+
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::vector<uint64_t> rowGroupIndices;
+
+                // The row groups sorted by their color. The row groups of color c are stored in the range
+                // [colorIndications[c], colorIndications[c + 1]).
+                std::vector<uint64_t> colorIndications;
+                std::vector<uint64_t> groupsByColor;
+
+                // The threads that perform the concurrent sweeps (together with the calling thread).
+                mutable std::unique_ptr<SweepWorkers> workers;
+            };
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "storm/solver/helper/SymbolicFrontierIterationHelper.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            SymbolicFrontierIterationHelper<DdType, ValueType>::SymbolicFrontierIterationHelper(storm::dd::Bdd<DdType> const& transitions, storm::dd::Bdd<DdType> const& allRows, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, std::set<storm::expressions::Variable> const& columnMetaVariables) : transitions(transitions), rowsWithTransitions(transitions.existsAbstract(columnMetaVariables)), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), columnMetaVariables(columnMetaVariables), frontier(allRows), frontierFull(true) {
+                // Intentionally left empty.
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            bool SymbolicFrontierIterationHelper<DdType, ValueType>::isFrontierFull() const {
+                return frontierFull;
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> SymbolicFrontierIterationHelper<DdType, ValueType>::restrictToFrontier(storm::dd::Add<DdType, ValueType> const& matrix) const {
+                if (frontierFull) {
+                    return matrix;
+                }
+                return frontier.ite(matrix, frontier.getDdManager().template getAddZero<ValueType>());
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> SymbolicFrontierIterationHelper<DdType, ValueType>::freezeOutsideFrontier(storm::dd::Add<DdType, ValueType> const& newValues, storm::dd::Add<DdType, ValueType> const& oldValues) const {
+                if (frontierFull) {
+                    return newValues;
+                }
+                return frontier.ite(newValues, oldValues);
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            void SymbolicFrontierIterationHelper<DdType, ValueType>::updateFrontier(storm::dd::Add<DdType, ValueType> const& newValues, storm::dd::Add<DdType, ValueType> const& oldValues, ValueType const& precision, bool relative) {
+                storm::dd::Add<DdType, ValueType> difference = newValues - oldValues;
+                difference = difference.maximum(-difference);
+                storm::dd::Bdd<DdType> changedStates;
+                if (relative) {
+                    changedStates = difference.greater(newValues.maximum(-newValues) * frontier.getDdManager().template getConstant<ValueType>(precision));
+                } else {
+                    changedStates = difference.greater(precision);
+                }
+
+                frontier = transitions.andExists(changedStates.swapVariables(rowColumnMetaVariablePairs), columnMetaVariables);
+                
+                // Rows without transitions keep their value anyway, so the frontier is full if it covers all other rows.
+                frontierFull = frontier == rowsWithTransitions;
+            }
+
+            template class SymbolicFrontierIterationHelper<storm::dd::DdType::CUDD, double>;
+            template class SymbolicFrontierIterationHelper<storm::dd::DdType::CUDD, storm::RationalNumber>;
+            template class SymbolicFrontierIterationHelper<storm::dd::DdType::Sylvan, double>;
+            template class SymbolicFrontierIterationHelper<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Keeps track of the frontier of a symbolic fixed point iteration, i.e. the rows that have a successor whose
+             * value changed (by more than the precision) in the previous iteration. The values of all other rows cannot
+             * change (noticeably) in the next iteration, so they are frozen and only the frontier rows are updated.
+             * As long as the frontier comprises all rows, the iteration proceeds unrestricted and no additional DD
+             * operations are performed.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            class SymbolicFrontierIterationHelper {
+            public:
+                /*!
+                 * Creates a helper whose frontier initially consists of all rows.
+                 *
+                 * @param transitions The non-zero entries of the iterated matrix (without any nondeterminism variables).
+                 * @param allRows All rows of the iterated matrix.
+                 * @param rowColumnMetaVariablePairs The pairs of row and column meta variables.
+                 * @param columnMetaVariables The column meta variables.
+                 */
+                SymbolicFrontierIterationHelper(storm::dd::Bdd<DdType> const& transitions, storm::dd::Bdd<DdType> const& allRows, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, std::set<storm::expressions::Variable> const& columnMetaVariables);
+
+                /*!
+                 * Retrieves whether the frontier consists of all rows.
+                 */
+                bool isFrontierFull() const;
+
+                /*!
+                 * Restricts the given matrix (or vector) to the rows in the frontier.
+                 */
+                storm::dd::Add<DdType, ValueType> restrictToFrontier(storm::dd::Add<DdType, ValueType> const& matrix) const;
+
+                /*!
+                 * Takes the new values of the rows in the frontier and the old values of all other rows.
+                 */
+                storm::dd::Add<DdType, ValueType> freezeOutsideFrontier(storm::dd::Add<DdType, ValueType> const& newValues, storm::dd::Add<DdType, ValueType> const& oldValues) const;
+
+                /*!
+                 * Computes the frontier for the next iteration from the values of the current one. A row is considered
+                 * changed if its value differs by more than the given precision (in the sense of the termination
+                 * criterion), so rows whose successors all converged are frozen.
+                 */
+                void updateFrontier(storm::dd::Add<DdType, ValueType> const& newValues, storm::dd::Add<DdType, ValueType> const& oldValues, ValueType const& precision, bool relative);
+
+            private:
+                // The non-zero entries of the iterated matrix.
+                storm::dd::Bdd<DdType> transitions;
+
+                // The rows of the iterated matrix that have at least one non-zero entry.
+                storm::dd::Bdd<DdType> rowsWithTransitions;
+
+                // The pairs of row and column meta variables.
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs;
+
+                // The column meta variables.
+                std::set<storm::expressions::Variable> const& columnMetaVariables;
+
+                // The rows that are updated in the next iteration.
+                storm::dd::Bdd<DdType> frontier;
+
+                // A flag indicating whether the frontier consists of all rows.
+                bool frontierFull;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include "storm/solver/helper/ValueIterationHelper.h"
+
+#include "storm-config.h"
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+            
+            template<typename ValueType>
+            ValueIterationHelper<ValueType>::ValueIterationHelper(storm::solver::Multiplier<ValueType> const& multiplier) : multiplier(multiplier), iterations(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType>
+            SolverStatus ValueIterationHelper<ValueType>::solveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) {
+                std::vector<ValueType> auxiliaryX(x.size());
+                std::vector<ValueType>* currentX = &x;
+                std::vector<ValueType>* newX = &auxiliaryX;
+                
+                iterations = 0;
+                SolverStatus status = SolverStatus::InProgress;
+                while (status == SolverStatus::InProgress) {
+                    // Compute x' = min/max(A*x + b).
+                    if (multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel) {
+                        // Copy over the current vector so we can modify it in-place.
+                        *newX = *currentX;
+                        multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, b);
+                    } else {
+                        multiplier.multiplyAndReduce(env, dir, *currentX, b, *newX);
+                    }
+                    
+                    if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                        status = SolverStatus::Converged;
+                    }
+                    std::swap(currentX, newX);
+                    ++iterations;
+                    if (status != SolverStatus::Converged && iterations >= maximalNumberOfIterations) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                    }
+                }
+                
+                // Swap the last iterate into the output x.
+                if (currentX == &auxiliaryX) {
+                    std::swap(x, auxiliaryX);
+                }
+                
+                STORM_LOG_INFO("Value iteration " << (status == SolverStatus::Converged ? "converged" : "did not converge") << " after " << iterations << " iterations.");
+                return status;
+            }
+            
+            template<typename ValueType>
+            uint64_t ValueIterationHelper<ValueType>::getNumberOfIterations() const {
+                return iterations;
+            }
+            
+            template class ValueIterationHelper<double>;
+            
+#ifdef STORM_HAVE_CARL
+            template class ValueIterationHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+    
+    class Environment;
+    
+    namespace solver {
+        template<typename ValueType>
+        class Multiplier;
+        
+        namespace helper {
+            
+            /*!
+             * Performs value iteration solely through the given multiplier, i.e. without access to the (explicit)
+             * matrix. This allows to iterate on matrices that are never built, e.g. the implicit product of a model
+             * and a memory structure (see ModelMemoryProductMultiplier).
+             */
+            template<typename ValueType>
+            class ValueIterationHelper {
+            public:
+                /*!
+                 * Creates a helper for the given multiplier, which must outlive the helper.
+                 */
+                ValueIterationHelper(storm::solver::Multiplier<ValueType> const& multiplier);
+                
+                /*!
+                 * Iterates x' = min/max(A*x + b) until two consecutive iterates are equal modulo the given precision or
+                 * the maximal number of iterations is reached.
+                 *
+                 * @param x The initial vector. After the call, it holds the last iterate.
+                 * @param b If non-null, this vector is added after each multiplication.
+                 * @return The status of the iteration.
+                 */
+                SolverStatus solveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle);
+                
+                /*!
+                 * Retrieves the number of iterations performed by the last call to solveEquations.
+                 */
+                uint64_t getNumberOfIterations() const;
+                
+            private:
+                storm::solver::Multiplier<ValueType> const& multiplier;
+                uint64_t iterations;
+            };
+        }
+    }
+}
@@ -78,6 +78,10 @@ namespace storm {
                     backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
+                // The buffer into which new rows are merged. After a merge, the buffer is swapped with the row, such that
+                // the memory of the old row is reused for the next merge.
+                FlexibleRowType mergeBuffer;
+                
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
                 // the elements of this row unless the elimination is filtered.
                 for (auto const& predecessorEntry : elementsWithEntryInColumnEqualRow) {
@@ -114,9 +118,10 @@ namespace storm {
                     FlexibleRowIterator first2 = entriesInRow.begin();
                     FlexibleRowIterator last2 = entriesInRow.end();
                     
-                    FlexibleRowType newSuccessors;
+                    FlexibleRowType& newSuccessors = mergeBuffer;
+                    newSuccessors.clear();
                     newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    std::back_insert_iterator<FlexibleRowType> result(newSuccessors);
                     
                     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
                     // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -166,7 +171,7 @@ namespace storm {
                     }
                     
                     // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    predecessorForwardTransitions.swap(newSuccessors);
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -197,9 +202,10 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
+                    FlexibleRowType& newPredecessors = mergeBuffer;
+                    newPredecessors.clear();
                     newPredecessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+                    std::back_insert_iterator<FlexibleRowType> result(newPredecessors);
                     
                     for (; first1 != last1; ++result) {
                         if (first2 == last2) {
@@ -230,7 +236,7 @@ namespace storm {
                         std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
                     }
                     // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
+                    successorBackwardTransitions.swap(newPredecessors);
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
@@ -323,11 +324,12 @@ namespace storm {
                     ++position;
                 }
             } else {
-                // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-                // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+                // If the given bit vector had much fewer elements, we iterate over its elements and retrieve their
+                // positions from a rank index of the filter.
+                BitVectorRankIndex filterRanks(filter);
                 for (auto bit : (*this)) {
                     if (filter[bit]) {
-                        result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                        result.set(filterRanks.rank(bit));
                     }
                 }
             }
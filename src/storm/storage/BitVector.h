@@ -514,6 +514,7 @@ namespace storm {
             friend std::ostream& operator<<(std::ostream& out, BitVector const& bitVector);
             friend struct std::hash<storm::storage::BitVector>;
             friend struct FNV1aBitVectorHash;
+            friend class BitVectorRankIndex;
             
             template<typename StateType>
             friend struct Murmur3BitVectorHash;
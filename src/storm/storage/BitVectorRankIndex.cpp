@@ -0,0 +1,118 @@
+#include "storm/storage/BitVectorRankIndex.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            uint64_t popcount(uint64_t bucket) {
+#if (defined (__GNUG__) || defined(__clang__))
+                return __builtin_popcountll(bucket);
+#else
+                uint64_t count = 0;
+                for (; bucket; ++count) {
+                    bucket &= bucket - 1;
+                }
+                return count;
+#endif
+            }
+
+            // Note that the bit with the smallest index is the most significant bit of a bucket.
+            uint64_t getBitsBeforeOffset(uint64_t bucket, uint64_t offset) {
+                return offset == 0 ? 0 : (bucket & ~((1ull << (64 - offset)) - 1ull));
+            }
+        }
+
+        BitVectorRankIndex::BitVectorRankIndex(BitVector const& bitVector) : bitVector(bitVector) {
+            uint64_t bucketCount = bitVector.bucketCount();
+            // We add a trailing block such that the rank of the size of the bit vector can be queried.
+            uint64_t blockCount = bucketCount / bucketsPerBlock + 1;
+            blockRanks.resize(blockCount);
+            superblockRanks.resize((blockCount + blocksPerSuperblock - 1) / blocksPerSuperblock);
+
+            uint64_t count = 0;
+            uint64_t superblockCount = 0;
+            for (uint64_t block = 0; block < blockCount; ++block) {
+                if (block % blocksPerSuperblock == 0) {
+                    superblockRanks[block / blocksPerSuperblock] = count;
+                    superblockCount = count;
+                }
+                blockRanks[block] = static_cast<uint16_t>(count - superblockCount);
+                for (uint64_t bucket = block * bucketsPerBlock, bucketEnd = std::min(bucket + bucketsPerBlock, bucketCount); bucket < bucketEnd; ++bucket) {
+                    count += popcount(bitVector.buckets[bucket]);
+                }
+            }
+            numberOfSetBits = count;
+        }
+
+        uint64_t BitVectorRankIndex::rank(uint64_t index) const {
+            STORM_LOG_ASSERT(index <= bitVector.size(), "Index " << index << " is out of range.");
+            uint64_t bucket = index >> 6;
+            uint64_t block = bucket / bucketsPerBlock;
+            uint64_t result = superblockRanks[block / blocksPerSuperblock] + blockRanks[block];
+            for (uint64_t currentBucket = block * bucketsPerBlock; currentBucket < bucket; ++currentBucket) {
+                result += popcount(bitVector.buckets[currentBucket]);
+            }
+            uint64_t offset = index & 63;
+            if (offset != 0) {
+                result += popcount(getBitsBeforeOffset(bitVector.buckets[bucket], offset));
+            }
+            return result;
+        }
+
+        uint64_t BitVectorRankIndex::select(uint64_t rank) const {
+            if (rank >= numberOfSetBits) {
+                return bitVector.size();
+            }
+
+            // Find the last superblock and then the last block within it that have at most the given rank.
+            uint64_t superblock = std::upper_bound(superblockRanks.begin(), superblockRanks.end(), rank) - superblockRanks.begin() - 1;
+            uint64_t remaining = rank - superblockRanks[superblock];
+            uint64_t block = superblock * blocksPerSuperblock;
+            uint64_t blockEnd = std::min(block + blocksPerSuperblock, static_cast<uint64_t>(blockRanks.size()));
+            while (block + 1 < blockEnd && blockRanks[block + 1] <= remaining) {
+                ++block;
+            }
+            remaining -= blockRanks[block];
+
+            // Scan the buckets of the block.
+            uint64_t bucket = block * bucketsPerBlock;
+            uint64_t bucketValue = bitVector.buckets[bucket];
+            uint64_t bucketPopcount = popcount(bucketValue);
+            while (remaining >= bucketPopcount) {
+                remaining -= bucketPopcount;
+                ++bucket;
+                bucketValue = bitVector.buckets[bucket];
+                bucketPopcount = popcount(bucketValue);
+            }
+
+            // Find the bit within the bucket.
+            uint64_t offset = 0;
+            for (uint64_t mask = 1ull << 63; ; mask >>= 1, ++offset) {
+                if (bucketValue & mask) {
+                    if (remaining == 0) {
+                        break;
+                    }
+                    --remaining;
+                }
+            }
+            return (bucket << 6) + offset;
+        }
+
+        uint64_t BitVectorRankIndex::getNumberOfSetBits() const {
+            return numberOfSetBits;
+        }
+
+        BitVector const& BitVectorRankIndex::getBitVector() const {
+            return bitVector;
+        }
+
+        std::size_t BitVectorRankIndex::getSizeInBytes() const {
+            return sizeof(*this) + sizeof(uint64_t) * superblockRanks.size() + sizeof(uint16_t) * blockRanks.size();
+        }
+
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A succinct index over a bit vector that answers rank queries (the number of set bits before an index) in
+         * constant time and select queries (the index of the i-th set bit) in logarithmic time. The index stores the
+         * number of set bits before every superblock of 4096 bits and, relative to that, before every block of 512
+         * bits, which amounts to less than five percent of the size of the bit vector. It thus replaces the vectors
+         * obtained from getNumberOfSetBitsBeforeIndices, which need 64 bits per index.
+         *
+         * The index refers to the given bit vector, which must neither be modified nor destroyed while the index is
+         * in use.
+         */
+        class BitVectorRankIndex {
+        public:
+            /*!
+             * Builds the index for the given bit vector.
+             */
+            explicit BitVectorRankIndex(BitVector const& bitVector);
+
+            /*!
+             * Retrieves the number of bits set in the bit vector with an index strictly smaller than the given one.
+             * This coincides with BitVector::getNumberOfSetBitsBeforeIndex.
+             *
+             * @param index The index, which must not exceed the size of the bit vector.
+             */
+            uint64_t rank(uint64_t index) const;
+
+            /*!
+             * Retrieves the index of the set bit that has the given number of set bits before it, i.e. the inverse of
+             * rank on the set bits.
+             *
+             * @param rank The number of set bits before the desired index.
+             * @return The index of the set bit or the size of the bit vector if there are not enough set bits.
+             */
+            uint64_t select(uint64_t rank) const;
+
+            /*!
+             * Retrieves the number of bits set in the bit vector.
+             */
+            uint64_t getNumberOfSetBits() const;
+
+            /*!
+             * Retrieves the bit vector to which this index refers.
+             */
+            BitVector const& getBitVector() const;
+
+            /*!
+             * Retrieves the number of bytes that this index occupies in addition to the bit vector.
+             */
+            std::size_t getSizeInBytes() const;
+
+        private:
+            static const uint64_t bucketsPerBlock = 8;
+            static const uint64_t blocksPerSuperblock = 8;
+
+            // The bit vector to which this index refers.
+            BitVector const& bitVector;
+
+            // The number of set bits before each superblock.
+            std::vector<uint64_t> superblockRanks;
+
+            // The number of set bits before each block, counted from the start of its superblock.
+            std::vector<uint16_t> blockRanks;
+
+            // The total number of set bits.
+            uint64_t numberOfSetBits;
+        };
+
+    }
+}
@@ -0,0 +1,125 @@
+#include "storm/storage/FlexibleRowAllocator.h"
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+
+            namespace {
+                // The smallest size class holds blocks of 2^minimalSizeClassBits bytes. Each further class doubles the size.
+                std::size_t const minimalSizeClassBits = 5;
+                std::size_t const numberOfSizeClasses = 16;
+
+                // The maximal number of bytes that are kept in the free lists. Blocks freed beyond that are released.
+                std::size_t const maximalFreeBytes = 64ull << 20;
+
+                struct FreeBlock {
+                    FreeBlock* next;
+                };
+
+                struct PoolState {
+                    PoolState() : freeBytes(0) {
+                        for (auto& freeList : freeLists) {
+                            freeList = nullptr;
+                        }
+                    }
+
+                    void release() {
+                        for (auto& freeList : freeLists) {
+                            while (freeList) {
+                                FreeBlock* next = freeList->next;
+                                ::operator delete(freeList);
+                                freeList = next;
+                            }
+                        }
+                        freeBytes = 0;
+                    }
+
+                    FreeBlock* freeLists[numberOfSizeClasses];
+                    std::size_t freeBytes;
+                };
+
+                // The pool of the current thread and a flag that indicates whether the pool was already destroyed,
+                // which happens at thread exit. Both are trivially destructible, such that they remain accessible
+                // for rows that are destroyed afterwards.
+                thread_local PoolState* threadPool = nullptr;
+                thread_local bool threadPoolDestroyed = false;
+
+                struct PoolGuard {
+                    ~PoolGuard() {
+                        if (threadPool) {
+                            threadPool->release();
+                            delete threadPool;
+                            threadPool = nullptr;
+                        }
+                        threadPoolDestroyed = true;
+                    }
+                };
+
+                PoolState* getPool() {
+                    if (!threadPool && !threadPoolDestroyed) {
+                        static thread_local PoolGuard guard;
+                        threadPool = new PoolState();
+                    }
+                    return threadPool;
+                }
+
+                // Retrieves the size class for the given number of bytes or numberOfSizeClasses if the size exceeds
+                // all size classes.
+                std::size_t getSizeClass(std::size_t bytes) {
+                    std::size_t sizeClass = 0;
+                    std::size_t classSize = std::size_t(1) << minimalSizeClassBits;
+                    while (classSize < bytes && sizeClass < numberOfSizeClasses) {
+                        classSize <<= 1;
+                        ++sizeClass;
+                    }
+                    return sizeClass;
+                }
+
+                std::size_t getClassSize(std::size_t sizeClass) {
+                    return std::size_t(1) << (minimalSizeClassBits + sizeClass);
+                }
+            }
+
+            void* FlexibleRowPool::allocate(std::size_t bytes) {
+                std::size_t sizeClass = getSizeClass(bytes);
+                if (sizeClass == numberOfSizeClasses) {
+                    return ::operator new(bytes);
+                }
+
+                PoolState* pool = getPool();
+                if (pool && pool->freeLists[sizeClass]) {
+                    FreeBlock* block = pool->freeLists[sizeClass];
+                    pool->freeLists[sizeClass] = block->next;
+                    pool->freeBytes -= getClassSize(sizeClass);
+                    return block;
+                }
+                return ::operator new(getClassSize(sizeClass));
+            }
+
+            void FlexibleRowPool::deallocate(void* block, std::size_t bytes) {
+                std::size_t sizeClass = getSizeClass(bytes);
+                PoolState* pool = sizeClass == numberOfSizeClasses ? nullptr : getPool();
+                if (!pool || pool->freeBytes + getClassSize(sizeClass) > maximalFreeBytes) {
+                    ::operator delete(block);
+                    return;
+                }
+
+                FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+                freeBlock->next = pool->freeLists[sizeClass];
+                pool->freeLists[sizeClass] = freeBlock;
+                pool->freeBytes += getClassSize(sizeClass);
+            }
+
+            void FlexibleRowPool::releaseFreeBlocks() {
+                if (threadPool) {
+                    threadPool->release();
+                }
+            }
+
+            std::size_t FlexibleRowPool::getNumberOfFreeBytes() {
+                return threadPool ? threadPool->freeBytes : 0;
+            }
+
+        }
+    }
+}
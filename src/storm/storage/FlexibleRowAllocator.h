@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+
+            /*!
+             * A per-thread pool of memory blocks for the rows of flexible sparse matrices. Blocks are grouped into size
+             * classes (powers of two) and freed blocks are kept in a free list per size class, such that rows that are
+             * constantly rewritten (as during state elimination) reuse the memory of previously freed rows instead of
+             * going through the general-purpose allocator.
+             */
+            class FlexibleRowPool {
+            public:
+                /*!
+                 * Allocates a block with at least the given number of bytes.
+                 */
+                static void* allocate(std::size_t bytes);
+
+                /*!
+                 * Returns the block that was obtained by allocating the given number of bytes to the pool.
+                 */
+                static void deallocate(void* block, std::size_t bytes);
+
+                /*!
+                 * Releases all blocks currently held in the free lists of the pool of the calling thread.
+                 */
+                static void releaseFreeBlocks();
+
+                /*!
+                 * Retrieves the number of bytes currently held in the free lists of the pool of the calling thread.
+                 */
+                static std::size_t getNumberOfFreeBytes();
+            };
+
+            /*!
+             * An allocator that obtains its memory from the flexible row pool. As the pool is global (per thread), all
+             * instances of this allocator are interchangeable.
+             */
+            template<typename T>
+            class FlexibleRowAllocator {
+            public:
+                typedef T value_type;
+
+                FlexibleRowAllocator() = default;
+
+                template<typename U>
+                FlexibleRowAllocator(FlexibleRowAllocator<U> const&) {
+                    // Intentionally left empty.
+                }
+
+                T* allocate(std::size_t n) {
+                    return static_cast<T*>(FlexibleRowPool::allocate(n * sizeof(T)));
+                }
+
+                void deallocate(T* block, std::size_t n) {
+                    FlexibleRowPool::deallocate(block, n * sizeof(T));
+                }
+
+                template<typename U>
+                bool operator==(FlexibleRowAllocator<U> const&) const {
+                    return true;
+                }
+
+                template<typename U>
+                bool operator!=(FlexibleRowAllocator<U> const&) const {
+                    return false;
+                }
+            };
+
+        }
+    }
+}
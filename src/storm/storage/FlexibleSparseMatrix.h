@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "storm/storage/sparse/StateType.h"
+#include "storm/storage/FlexibleRowAllocator.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace storm {
@@ -25,7 +26,8 @@ namespace storm {
             
             typedef uint_fast64_t index_type;
             typedef ValueType value_type;
-            typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>> row_type;
+            // The rows obtain their memory from a pool, because they are constantly rewritten during state elimination.
+            typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>, detail::FlexibleRowAllocator<storm::storage::MatrixEntry<index_type, value_type>>> row_type;
             typedef typename row_type::iterator iterator;
             typedef typename row_type::const_iterator const_iterator;
             
@@ -12,6 +12,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/vector.h"
@@ -918,14 +919,10 @@ namespace storm {
             STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
             uint_fast64_t submatrixColumnCount = columnConstraint.getNumberOfSetBits();
             
-            // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
-            // bits that were set before that particular index.
-            std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
-            std::unique_ptr<std::vector<index_type>> tmp;
-            if (rowGroupConstraint != columnConstraint) {
-                tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
-            }
-            std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
+            // Start by creating an index that yields for each index whose bit is set to true the number of bits that
+            // were set before that particular index. Note that the row group with the given index becomes the row group
+            // with the index rowGroupCount in the submatrix, so we do not need such an index for the row groups.
+            storm::storage::BitVectorRankIndex columnRanks(columnConstraint);
             
             // Then, we need to determine the number of entries and the number of rows of the submatrix.
             index_type subEntries = 0;
@@ -940,7 +937,7 @@ namespace storm {
                         if (columnConstraint.get(it->getColumn())) {
                             ++subEntries;
                             
-                            if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
+                            if (columnRanks.rank(it->getColumn()) == rowGroupCount) {
                                 foundDiagonalElement = true;
                             }
                         }
@@ -969,13 +966,14 @@ namespace storm {
                     
                     for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
                         if (columnConstraint.get(it->getColumn())) {
-                            if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
+                            index_type column = columnRanks.rank(it->getColumn());
+                            if (column == rowGroupCount) {
                                 insertedDiagonalElement = true;
-                            } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[it->getColumn()] > rowBitsSetBeforeIndex[index]) {
+                            } else if (insertDiagonalEntries && !insertedDiagonalElement && column > rowGroupCount) {
                                 matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
                                 insertedDiagonalElement = true;
                             }
-                            matrixBuilder.addNextValue(rowCount, columnBitsSetBeforeIndex[it->getColumn()], it->getValue());
+                            matrixBuilder.addNextValue(rowCount, column, it->getValue());
                         }
                     }
                     if (insertDiagonalEntries && !insertedDiagonalElement && rowGroupCount < submatrixColumnCount) {
@@ -8,6 +8,7 @@
 
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/storage/BitVector.h"
@@ -141,13 +142,13 @@ namespace storm {
         template<DdType LibraryType>
         Bdd<LibraryType> Bdd<LibraryType>::existsAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
             Bdd<LibraryType> cube = getCube(this->getDdManager(), metaVariables);
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
+            return recordDdOperation(DdOperationType::ExistsAbstract, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube)); });
         }
         
         template<DdType LibraryType>
         Bdd<LibraryType> Bdd<LibraryType>::existsAbstractRepresentative(std::set<storm::expressions::Variable> const& metaVariables) const {
             Bdd<LibraryType> cube = getCube(this->getDdManager(), metaVariables);
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstractRepresentative(cube.getInternalBdd()), this->getContainedMetaVariables());
+            return recordDdOperation(DdOperationType::ExistsAbstractRepresentative, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstractRepresentative(cube.getInternalBdd()), this->getContainedMetaVariables()); });
         }
 
         template<DdType LibraryType>
@@ -165,7 +166,7 @@ namespace storm {
             std::set<storm::expressions::Variable> containedMetaVariables;
             std::set_difference(unionOfMetaVariables.begin(), unionOfMetaVariables.end(), existentialVariables.begin(), existentialVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
             
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.andExists(other.getInternalBdd(), cube.getInternalBdd()), containedMetaVariables);
+            return recordDdOperation(DdOperationType::AndExists, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.andExists(other.getInternalBdd(), cube.getInternalBdd()), containedMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -199,7 +200,7 @@ namespace storm {
                 }
             }
             
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.relationalProduct(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables);
+            return recordDdOperation(DdOperationType::RelationalProduct, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.relationalProduct(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -223,7 +224,7 @@ namespace storm {
                 }
             }
             
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.inverseRelationalProduct(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables);
+            return recordDdOperation(DdOperationType::InverseRelationalProduct, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.inverseRelationalProduct(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -247,7 +248,7 @@ namespace storm {
                 }
             }
             
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.inverseRelationalProductWithExtendedRelation(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables);
+            return recordDdOperation(DdOperationType::InverseRelationalProduct, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.inverseRelationalProductWithExtendedRelation(relation.getInternalBdd(), rowVariables, columnVariables), newMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -289,7 +290,7 @@ namespace storm {
             std::set_difference(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end(), deletedMetaVariables.begin(), deletedMetaVariables.end(), std::inserter(tmp, tmp.begin()));
             std::set<storm::expressions::Variable> containedMetaVariables;
             std::set_union(tmp.begin(), tmp.end(), newContainedMetaVariables.begin(), newContainedMetaVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(from, to), containedMetaVariables);
+            return recordDdOperation(DdOperationType::SwapVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(from, to), containedMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -316,7 +317,7 @@ namespace storm {
             std::set_difference(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end(), from.begin(), from.end(), std::inserter(newContainedMetaVariables, newContainedMetaVariables.begin()));
             
             STORM_LOG_THROW(fromBdds.size() == toBdds.size(), storm::exceptions::InvalidArgumentException, "Unable to rename mismatching meta variables.");
-            return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables);
+            return recordDdOperation(DdOperationType::RenameVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables); });
         }
         
         template<DdType LibraryType>
@@ -347,7 +348,7 @@ namespace storm {
             STORM_LOG_ASSERT(fromBdds.size() >= toBdds.size(), "Unable to perform rename-abstract with mismatching sizes.");
             
             if (fromBdds.size() == toBdds.size()) {
-                return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables);
+                return recordDdOperation(DdOperationType::RenameVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables); });
             } else {
                 InternalBdd<LibraryType> cube = this->getDdManager().getBddOne().getInternalBdd();
                 for (uint64_t index = toBdds.size(); index < fromBdds.size(); ++index) {
@@ -355,7 +356,7 @@ namespace storm {
                 }
                 fromBdds.resize(toBdds.size());
                 
-                return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstract(cube).swapVariables(fromBdds, toBdds), newContainedMetaVariables);
+                return recordDdOperation(DdOperationType::RenameVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstract(cube).swapVariables(fromBdds, toBdds), newContainedMetaVariables); });
             }
         }
         
@@ -387,7 +388,7 @@ namespace storm {
             STORM_LOG_ASSERT(toBdds.size() >= fromBdds.size(), "Unable to perform rename-concretize with mismatching sizes.");
             
             if (fromBdds.size() == toBdds.size()) {
-                return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables);
+                return recordDdOperation(DdOperationType::RenameVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), internalBdd.swapVariables(fromBdds, toBdds), newContainedMetaVariables); });
             } else {
                 InternalBdd<LibraryType> negatedCube = this->getDdManager().getBddOne().getInternalBdd();
                 for (uint64_t index = fromBdds.size(); index < toBdds.size(); ++index) {
@@ -395,7 +396,7 @@ namespace storm {
                 }
                 toBdds.resize(fromBdds.size());
                 
-                return Bdd<LibraryType>(this->getDdManager(), (internalBdd && negatedCube).swapVariables(fromBdds, toBdds), newContainedMetaVariables);
+                return recordDdOperation(DdOperationType::RenameVariables, [&] { return Bdd<LibraryType>(this->getDdManager(), (internalBdd && negatedCube).swapVariables(fromBdds, toBdds), newContainedMetaVariables); });
             }
         }
         
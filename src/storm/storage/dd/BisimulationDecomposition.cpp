@@ -5,6 +5,7 @@
 #include "storm/storage/dd/bisimulation/NondeterministicModelPartitionRefiner.h"
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 #include "storm/storage/dd/bisimulation/PartialQuotientExtractor.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 
 #include "storm/models/symbolic/Model.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -71,6 +72,7 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
         void BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(bisimulation::SignatureMode const& mode) {
+            DdOperationScope scope("BisimulationDecomposition::compute");
             STORM_LOG_ASSERT(refiner, "No suitable refiner.");
             STORM_LOG_ASSERT(this->refiner->getStatus() != Status::FixedPoint, "Can only proceed if no fixpoint has been reached yet.");
 
@@ -98,6 +100,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
         bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(uint64_t steps, bisimulation::SignatureMode const& mode) {
+            DdOperationScope scope("BisimulationDecomposition::compute");
             STORM_LOG_ASSERT(refiner, "No suitable refiner.");
             STORM_LOG_ASSERT(this->refiner->getStatus() != Status::FixedPoint, "Can only proceed if no fixpoint has been reached yet.");
             STORM_LOG_ASSERT(steps > 0, "Can only perform positive number of steps.");
@@ -130,10 +133,15 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
         std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition<DdType, ValueType, ExportValueType>::getQuotient() const {
+            return getQuotient(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getQuotientFormat());
+        }
+        
+        template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+        std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition<DdType, ValueType, ExportValueType>::getQuotient(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat) const {
             std::shared_ptr<storm::models::Model<ExportValueType>> quotient;
             if (this->refiner->getStatus() == Status::FixedPoint) {
                 STORM_LOG_INFO("Starting full quotient extraction.");
-                QuotientExtractor<DdType, ValueType, ExportValueType> extractor;
+                QuotientExtractor<DdType, ValueType, ExportValueType> extractor(quotientFormat);
                 quotient = extractor.extract(model, refiner->getStatePartition(), preservationInformation);
             } else {
                 STORM_LOG_THROW(model.getType() == storm::models::ModelType::Dtmc || model.getType() == storm::models::ModelType::Mdp, storm::exceptions::InvalidOperationException, "Can only extract partial quotient for discrete-time models.");
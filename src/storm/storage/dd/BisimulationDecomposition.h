@@ -10,6 +10,8 @@
 
 #include "storm/logic/Formula.h"
 
+#include "storm/settings/modules/BisimulationSettings.h"
+
 namespace storm {
     namespace models {
         template <typename ValueType>
@@ -66,6 +68,12 @@ namespace storm {
              */
             std::shared_ptr<storm::models::Model<ExportValueType>> getQuotient() const;
             
+            /*!
+             * Retrieves the quotient model after the bisimulation decomposition was computed. If a fixpoint was reached,
+             * the quotient is extracted in the given format.
+             */
+            std::shared_ptr<storm::models::Model<ExportValueType>> getQuotient(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat) const;
+            
         private:
             void initialize();
             void refineWrtRewardModels();
@@ -0,0 +1,164 @@
+#include "storm/storage/dd/DdOperationStatistics.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "storm/utility/macros.h"
+
+#include "json.hpp"
+
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+namespace storm {
+    namespace dd {
+
+        std::ostream& operator<<(std::ostream& out, DdOperationType const& type) {
+            switch (type) {
+                case DdOperationType::SumAbstract: out << "sumAbstract"; break;
+                case DdOperationType::MinAbstract: out << "minAbstract"; break;
+                case DdOperationType::MaxAbstract: out << "maxAbstract"; break;
+                case DdOperationType::MinAbstractRepresentative: out << "minAbstractRepresentative"; break;
+                case DdOperationType::MaxAbstractRepresentative: out << "maxAbstractRepresentative"; break;
+                case DdOperationType::ExistsAbstract: out << "existsAbstract"; break;
+                case DdOperationType::ExistsAbstractRepresentative: out << "existsAbstractRepresentative"; break;
+                case DdOperationType::AndExists: out << "andExists"; break;
+                case DdOperationType::RelationalProduct: out << "relationalProduct"; break;
+                case DdOperationType::InverseRelationalProduct: out << "inverseRelationalProduct"; break;
+                case DdOperationType::SwapVariables: out << "swapVariables"; break;
+                case DdOperationType::PermuteVariables: out << "permuteVariables"; break;
+                case DdOperationType::RenameVariables: out << "renameVariables"; break;
+                case DdOperationType::MultiplyMatrix: out << "multiplyMatrix"; break;
+            }
+            return out;
+        }
+
+        DdOperationStatistics::OperationRecord::OperationRecord() : numberOfCalls(0), totalTime(0), totalResultNodes(0), maximalResultNodes(0) {
+            // Intentionally left empty.
+        }
+
+        void DdOperationStatistics::OperationRecord::add(std::chrono::nanoseconds const& duration, uint64_t resultNodeCount) {
+            ++numberOfCalls;
+            totalTime += duration;
+            totalResultNodes += resultNodeCount;
+            maximalResultNodes = std::max(maximalResultNodes, resultNodeCount);
+        }
+
+        thread_local std::vector<std::string> DdOperationStatistics::scopes;
+
+        DdOperationStatistics::DdOperationStatistics() : enabled(false) {
+            // Intentionally left empty.
+        }
+
+        DdOperationStatistics& DdOperationStatistics::getInstance() {
+            static DdOperationStatistics instance;
+            return instance;
+        }
+
+        void DdOperationStatistics::setEnabled(bool enabled) {
+            this->enabled.store(enabled);
+        }
+
+        bool DdOperationStatistics::isEnabled() const {
+            return enabled.load();
+        }
+
+        void DdOperationStatistics::recordOperation(DdOperationType const& type, std::chrono::nanoseconds const& duration, uint64_t resultNodeCount) {
+            std::string scope = scopes.empty() ? "<none>" : boost::algorithm::join(scopes, "/");
+            std::lock_guard<std::mutex> lock(mutex);
+            operations[type].add(duration, resultNodeCount);
+            operationsPerScope[scope][type].add(duration, resultNodeCount);
+        }
+
+        void DdOperationStatistics::recordLibraryStatistics(std::string const& library, std::map<std::string, uint64_t> const& statistics) {
+            std::lock_guard<std::mutex> lock(mutex);
+            libraryStatistics.emplace_back(library, statistics);
+        }
+
+        void DdOperationStatistics::enterScope(std::string const& name) {
+            scopes.push_back(name);
+        }
+
+        void DdOperationStatistics::leaveScope() {
+            STORM_LOG_ASSERT(!scopes.empty(), "Cannot leave DD operation scope, because no scope was entered.");
+            if (!scopes.empty()) {
+                scopes.pop_back();
+            }
+        }
+
+        namespace {
+            template<typename RecordType>
+            modernjson::json recordToJson(RecordType const& record) {
+                modernjson::json result;
+                result["calls"] = record.numberOfCalls;
+                result["total-time-ms"] = std::chrono::duration<double, std::milli>(record.totalTime).count();
+                result["total-result-nodes"] = record.totalResultNodes;
+                result["max-result-nodes"] = record.maximalResultNodes;
+                return result;
+            }
+
+            std::string toString(DdOperationType const& type) {
+                std::stringstream stream;
+                stream << type;
+                return stream.str();
+            }
+        }
+
+        void DdOperationStatistics::exportToJson(std::ostream& out) const {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            modernjson::json result;
+            modernjson::json operationsJson = modernjson::json::object();
+            for (auto const& operation : operations) {
+                operationsJson[toString(operation.first)] = recordToJson(operation.second);
+            }
+            result["operations"] = operationsJson;
+
+            modernjson::json scopesJson = modernjson::json::object();
+            for (auto const& scope : operationsPerScope) {
+                modernjson::json scopeJson;
+                for (auto const& operation : scope.second) {
+                    scopeJson[toString(operation.first)] = recordToJson(operation.second);
+                }
+                scopesJson[scope.first] = scopeJson;
+            }
+            result["scopes"] = scopesJson;
+
+            modernjson::json librariesJson = modernjson::json::array();
+            for (auto const& snapshot : libraryStatistics) {
+                modernjson::json snapshotJson;
+                snapshotJson["library"] = snapshot.first;
+                for (auto const& entry : snapshot.second) {
+                    snapshotJson[entry.first] = entry.second;
+                }
+                librariesJson.push_back(snapshotJson);
+            }
+            result["libraries"] = librariesJson;
+
+            out << result.dump(4) << std::endl;
+        }
+
+        void DdOperationStatistics::reset() {
+            std::lock_guard<std::mutex> lock(mutex);
+            operations.clear();
+            operationsPerScope.clear();
+            libraryStatistics.clear();
+        }
+
+        DdOperationScope::DdOperationScope(std::string const& name) : entered(DdOperationStatistics::getInstance().isEnabled()) {
+            if (entered) {
+                DdOperationStatistics::getInstance().enterScope(name);
+            }
+        }
+
+        DdOperationScope::~DdOperationScope() {
+            if (entered) {
+                DdOperationStatistics::getInstance().leaveScope();
+            }
+        }
+
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace dd {
+
+        // An enum that contains all DD operations whose invocations can be recorded.
+        enum class DdOperationType { SumAbstract, MinAbstract, MaxAbstract, MinAbstractRepresentative, MaxAbstractRepresentative, ExistsAbstract, ExistsAbstractRepresentative, AndExists, RelationalProduct, InverseRelationalProduct, SwapVariables, PermuteVariables, RenameVariables, MultiplyMatrix };
+
+        std::ostream& operator<<(std::ostream& out, DdOperationType const& type);
+
+        /*!
+         * Collects statistics about the invocations of the (expensive) operations on DDs as well as statistics of the
+         * underlying DD libraries (unique table and computed table). Operations are recorded per operation type and per
+         * scope, where scopes are entered and left via DdOperationScope objects and identify the part of the code
+         * that triggered the operations. Scopes are tracked per thread, so operations performed by worker threads are
+         * attributed to the scopes entered by that thread. Recording is disabled by default, in which case recording an
+         * operation only costs a single check.
+         */
+        class DdOperationStatistics {
+        public:
+            /*!
+             * Retrieves the (only) instance collecting the statistics.
+             */
+            static DdOperationStatistics& getInstance();
+
+            /*!
+             * Sets whether operations (and library statistics) are to be recorded.
+             */
+            void setEnabled(bool enabled);
+
+            /*!
+             * Retrieves whether operations (and library statistics) are to be recorded.
+             */
+            bool isEnabled() const;
+
+            /*!
+             * Records one invocation of the given operation in the current scope.
+             *
+             * @param type The type of the operation.
+             * @param duration The wall time the operation took.
+             * @param resultNodeCount The number of nodes of the result of the operation.
+             */
+            void recordOperation(DdOperationType const& type, std::chrono::nanoseconds const& duration, uint64_t resultNodeCount);
+
+            /*!
+             * Records a snapshot of the statistics of a DD library (e.g. when a manager is destroyed).
+             *
+             * @param library The name of the library.
+             * @param statistics The statistics of the library as key-value pairs.
+             */
+            void recordLibraryStatistics(std::string const& library, std::map<std::string, uint64_t> const& statistics);
+
+            /*!
+             * Enters the scope with the given name for the calling thread. Scopes may be nested.
+             */
+            void enterScope(std::string const& name);
+
+            /*!
+             * Leaves the innermost scope of the calling thread.
+             */
+            void leaveScope();
+
+            /*!
+             * Writes all recorded statistics in JSON format to the given stream.
+             */
+            void exportToJson(std::ostream& out) const;
+
+            /*!
+             * Clears all recorded statistics.
+             */
+            void reset();
+
+        private:
+            DdOperationStatistics();
+
+            struct OperationRecord {
+                OperationRecord();
+
+                void add(std::chrono::nanoseconds const& duration, uint64_t resultNodeCount);
+
+                uint64_t numberOfCalls;
+                std::chrono::nanoseconds totalTime;
+                uint64_t totalResultNodes;
+                uint64_t maximalResultNodes;
+            };
+
+            // A flag indicating whether recording is enabled.
+            std::atomic<bool> enabled;
+
+            // The records per operation type.
+            std::map<DdOperationType, OperationRecord> operations;
+
+            // The records per scope (given by the names of all nested scopes) and operation type.
+            std::map<std::string, std::map<DdOperationType, OperationRecord>> operationsPerScope;
+
+            // The scopes currently entered by the calling thread.
+            static thread_local std::vector<std::string> scopes;
+
+            // The recorded snapshots of library statistics.
+            std::vector<std::pair<std::string, std::map<std::string, uint64_t>>> libraryStatistics;
+
+            // A mutex guarding the records, as operations may be performed by multiple threads.
+            mutable std::mutex mutex;
+        };
+
+        /*!
+         * Marks a scope for the DD operation statistics for as long as the object lives.
+         */
+        class DdOperationScope {
+        public:
+            DdOperationScope(std::string const& name);
+            ~DdOperationScope();
+
+            DdOperationScope(DdOperationScope const& other) = delete;
+            DdOperationScope& operator=(DdOperationScope const& other) = delete;
+
+        private:
+            // A flag storing whether the scope was actually entered (i.e. whether recording was enabled).
+            bool entered;
+        };
+
+        /*!
+         * Performs the given operation and records it in the DD operation statistics if recording is enabled.
+         *
+         * @param type The type of the operation.
+         * @param operation A callable that performs the operation and returns the resulting DD.
+         * @return The resulting DD.
+         */
+        template<typename OperationType>
+        auto recordDdOperation(DdOperationType const& type, OperationType const& operation) -> decltype(operation()) {
+            DdOperationStatistics& statistics = DdOperationStatistics::getInstance();
+            if (!statistics.isEnabled()) {
+                return operation();
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            auto result = operation();
+            auto end = std::chrono::high_resolution_clock::now();
+            statistics.recordOperation(type, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start), result.getNodeCount());
+            return result;
+        }
+
+    }
+}
@@ -621,23 +621,269 @@ namespace storm {
                 spp::sparse_hash_map<DdNode const*, uint64_t> blockToOffset;
             };
 
+            /*!
+             * The part of the Sylvan-based sparse quotient extractor that is accessed by the Lace tasks below. As Lace
+             * tasks cannot be templated, this base class provides the type-independent interface.
+             */
+            class InternalSylvanSparseQuotientExtractorBase {
+            public:
+                virtual ~InternalSylvanSparseQuotientExtractorBase() = default;
+
+                // Adds an entry with the value of the given leaf to the given row. This is called concurrently, but
+                // never for the same row from different workers.
+                virtual void addMatrixEntryFromLeaf(uint64_t row, uint64_t column, MTBDD leaf) = 0;
+
+                // Records the state to which the given row belongs. This is called concurrently, but never for the
+                // same row from different workers.
+                virtual void recordRowState(uint64_t row, uint64_t state) = 0;
+
+                // Sets the value at the given offset of the vector currently being extracted to the value of the
+                // given leaf. This is called concurrently, but never for the same offset from different workers.
+                virtual void setVectorEntryFromLeaf(uint64_t offset, MTBDD leaf) = 0;
+
+                // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block. It is
+                // only read during the (parallel) extraction.
+                spp::sparse_hash_map<BDD, uint64_t> blockToOffset;
+            };
+
+            /*!
+             * The arguments of one step of the transition matrix extraction. As Lace tasks only take a limited number of
+             * arguments, they are bundled in this structure. Since spawned tasks are always synchronized before the
+             * spawning task returns, it is safe to pass pointers to steps living on the stack of the spawning task.
+             */
+            struct SylvanTransitionMatrixExtractionStep {
+                MTBDD transitionMatrixNode;
+                storm::dd::Odd const* sourceOdd;
+                uint64_t sourceOffset;
+                BDD targetPartitionNode;
+                BDD representativesNode;
+                BDD variables;
+                BDD nondeterminismVariables;
+                storm::dd::Odd const* stateOdd;
+                uint64_t stateOffset;
+            };
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+            VOID_TASK_DECL_3(sylvan_extract_transition_matrix_sequentially, SylvanTransitionMatrixExtractionStep const*, SylvanTransitionMatrixExtractionStep const*, InternalSylvanSparseQuotientExtractorBase*)
+
+            /*!
+             * Extracts the part of the quotient matrix described by the given step. Different source states (and
+             * different choices of the same state) correspond to disjoint sets of rows of the quotient, so they are
+             * extracted concurrently. Parts that belong to the same rows (i.e. that only differ in the target block)
+             * are extracted one after another, so no row is ever written by two workers at the same time.
+             */
+            VOID_TASK_2(sylvan_extract_transition_matrix, SylvanTransitionMatrixExtractionStep const*, step, InternalSylvanSparseQuotientExtractorBase*, extractor)
+            {
+                // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
+                // as all states of the model have to be contained.
+                if (mtbdd_iszero(step->transitionMatrixNode) || step->representativesNode == sylvan_false) {
+                    return;
+                }
+
+                // If we have moved through all source variables, we must have arrived at a target block encoding.
+                if (sylvan_isconst(step->variables)) {
+                    STORM_LOG_ASSERT(mtbdd_isleaf(step->transitionMatrixNode), "Expected constant node.");
+                    extractor->addMatrixEntryFromLeaf(step->sourceOffset, extractor->blockToOffset.at(step->targetPartitionNode), step->transitionMatrixNode);
+                    if (step->stateOdd) {
+                        extractor->recordRowState(step->sourceOffset, step->stateOffset);
+                    }
+                    return;
+                }
+
+                storm::dd::Odd const& sourceOdd = *step->sourceOdd;
+                storm::dd::Odd const* stateOdd = step->stateOdd;
+
+                // Determine whether the next variable is a nondeterminism variable.
+                bool nextVariableIsNondeterminismVariable = !sylvan_isconst(step->nondeterminismVariables) && sylvan_var(step->nondeterminismVariables) == sylvan_var(step->variables);
+
+                if (nextVariableIsNondeterminismVariable) {
+                    MTBDD t;
+                    MTBDD e;
+
+                    // Determine whether the variable was skipped in the matrix.
+                    if (sylvan_mtbdd_matches_variable_index(step->transitionMatrixNode, sylvan_var(step->variables))) {
+                        t = sylvan_high(step->transitionMatrixNode);
+                        e = sylvan_low(step->transitionMatrixNode);
+                    } else {
+                        t = e = step->transitionMatrixNode;
+                    }
+
+                    STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
+                    SylvanTransitionMatrixExtractionStep elseStep = {e, &sourceOdd.getElseSuccessor(), step->sourceOffset, step->targetPartitionNode, step->representativesNode, sylvan_high(step->variables), sylvan_high(step->nondeterminismVariables), stateOdd, step->stateOffset};
+                    SylvanTransitionMatrixExtractionStep thenStep = {t, &sourceOdd.getThenSuccessor(), step->sourceOffset + sourceOdd.getElseOffset(), step->targetPartitionNode, step->representativesNode, sylvan_high(step->variables), sylvan_high(step->nondeterminismVariables), stateOdd, step->stateOffset};
+
+                    SPAWN(sylvan_extract_transition_matrix, &thenStep, extractor);
+                    CALL(sylvan_extract_transition_matrix, &elseStep, extractor);
+                    SYNC(sylvan_extract_transition_matrix);
+                } else {
+                    MTBDD t;
+                    MTBDD tt;
+                    MTBDD te;
+                    MTBDD e;
+                    MTBDD et;
+                    MTBDD ee;
+                    if (sylvan_mtbdd_matches_variable_index(step->transitionMatrixNode, sylvan_var(step->variables))) {
+                        // Source node was not skipped in transition matrix.
+                        t = sylvan_high(step->transitionMatrixNode);
+                        e = sylvan_low(step->transitionMatrixNode);
+                    } else {
+                        t = e = step->transitionMatrixNode;
+                    }
+
+                    if (sylvan_mtbdd_matches_variable_index(t, sylvan_var(step->variables) + 1)) {
+                        // Target node was not skipped in transition matrix.
+                        tt = sylvan_high(t);
+                        te = sylvan_low(t);
+                    } else {
+                        // Target node was skipped in transition matrix.
+                        tt = te = t;
+                    }
+                    if (t != e) {
+                        if (sylvan_mtbdd_matches_variable_index(e, sylvan_var(step->variables) + 1)) {
+                            // Target node was not skipped in transition matrix.
+                            et = sylvan_high(e);
+                            ee = sylvan_low(e);
+                        } else {
+                            // Target node was skipped in transition matrix.
+                            et = ee = e;
+                        }
+                    } else {
+                        et = tt;
+                        ee = te;
+                    }
+
+                    BDD targetT;
+                    BDD targetE;
+                    if (sylvan_bdd_matches_variable_index(step->targetPartitionNode, sylvan_var(step->variables))) {
+                        // Node was not skipped in target partition.
+                        targetT = sylvan_high(step->targetPartitionNode);
+                        targetE = sylvan_low(step->targetPartitionNode);
+                    } else {
+                        // Node was skipped in target partition.
+                        targetT = targetE = step->targetPartitionNode;
+                    }
+
+                    BDD representativesT;
+                    BDD representativesE;
+                    if (sylvan_bdd_matches_variable_index(step->representativesNode, sylvan_var(step->variables))) {
+                        // Node was not skipped in representatives.
+                        representativesT = sylvan_high(step->representativesNode);
+                        representativesE = sylvan_low(step->representativesNode);
+                    } else {
+                        // Node was skipped in representatives.
+                        representativesT = representativesE = step->representativesNode;
+                    }
+
+                    BDD nextVariables = sylvan_high(step->variables);
+                    storm::dd::Odd const* elseStateOdd = stateOdd ? &stateOdd->getElseSuccessor() : stateOdd;
+                    storm::dd::Odd const* thenStateOdd = stateOdd ? &stateOdd->getThenSuccessor() : stateOdd;
+                    uint64_t thenStateOffset = step->stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0);
+
+                    SylvanTransitionMatrixExtractionStep elseElseStep = {ee, &sourceOdd.getElseSuccessor(), step->sourceOffset, targetE, representativesE, nextVariables, step->nondeterminismVariables, elseStateOdd, step->stateOffset};
+                    SylvanTransitionMatrixExtractionStep elseThenStep = {et, &sourceOdd.getElseSuccessor(), step->sourceOffset, targetT, representativesE, nextVariables, step->nondeterminismVariables, elseStateOdd, step->stateOffset};
+                    SylvanTransitionMatrixExtractionStep thenElseStep = {te, &sourceOdd.getThenSuccessor(), step->sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, nextVariables, step->nondeterminismVariables, thenStateOdd, thenStateOffset};
+                    SylvanTransitionMatrixExtractionStep thenThenStep = {tt, &sourceOdd.getThenSuccessor(), step->sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, nextVariables, step->nondeterminismVariables, thenStateOdd, thenStateOffset};
+
+                    // The rows of the then-successor are disjoint from the ones of the else-successor, so we can
+                    // extract them concurrently.
+                    SPAWN(sylvan_extract_transition_matrix_sequentially, &thenElseStep, &thenThenStep, extractor);
+                    CALL(sylvan_extract_transition_matrix_sequentially, &elseElseStep, &elseThenStep, extractor);
+                    SYNC(sylvan_extract_transition_matrix_sequentially);
+                }
+            }
+
+            VOID_TASK_IMPL_3(sylvan_extract_transition_matrix_sequentially, SylvanTransitionMatrixExtractionStep const*, first, SylvanTransitionMatrixExtractionStep const*, second, InternalSylvanSparseQuotientExtractorBase*, extractor)
+            {
+                CALL(sylvan_extract_transition_matrix, first, extractor);
+                CALL(sylvan_extract_transition_matrix, second, extractor);
+            }
+
+            VOID_TASK_6(sylvan_extract_vector, MTBDD, vector, BDD, representativesNode, BDD, variables, storm::dd::Odd const*, odd, uint64_t, offset, InternalSylvanSparseQuotientExtractorBase*, extractor)
+            {
+                if (representativesNode == sylvan_false || mtbdd_iszero(vector)) {
+                    return;
+                }
+
+                if (sylvan_isconst(variables)) {
+                    extractor->setVectorEntryFromLeaf(offset, vector);
+                } else {
+                    MTBDD vectorT;
+                    MTBDD vectorE;
+                    if (sylvan_mtbdd_matches_variable_index(vector, sylvan_var(variables))) {
+                        vectorT = sylvan_high(vector);
+                        vectorE = sylvan_low(vector);
+                    } else {
+                        vectorT = vectorE = vector;
+                    }
+
+                    BDD representativesT;
+                    BDD representativesE;
+                    if (sylvan_bdd_matches_variable_index(representativesNode, sylvan_var(variables))) {
+                        representativesT = sylvan_high(representativesNode);
+                        representativesE = sylvan_low(representativesNode);
+                    } else {
+                        representativesT = representativesE = representativesNode;
+                    }
+
+                    SPAWN(sylvan_extract_vector, vectorT, representativesT, sylvan_high(variables), &odd->getThenSuccessor(), offset + odd->getElseOffset(), extractor);
+                    CALL(sylvan_extract_vector, vectorE, representativesE, sylvan_high(variables), &odd->getElseSuccessor(), offset, extractor);
+                    SYNC(sylvan_extract_vector);
+                }
+            }
+
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
             template<typename ValueType, typename ExportValueType>
-            class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, ExportValueType> : public InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType> {
+            class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, ExportValueType> : public InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>, public InternalSylvanSparseQuotientExtractorBase {
             public:
-                InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives) : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives) {
+                InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives) : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives), currentVector(nullptr) {
                     this->createBlockToOffsetMapping();
                 }
                 
+                virtual void addMatrixEntryFromLeaf(uint64_t row, uint64_t column, MTBDD leaf) override {
+                    this->addMatrixEntry(row, column, storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(leaf)));
+                }
+                
+                virtual void recordRowState(uint64_t row, uint64_t state) override {
+                    this->assignRowToState(row, state);
+                }
+                
+                virtual void setVectorEntryFromLeaf(uint64_t offset, MTBDD leaf) override {
+                    (*currentVector)[offset] = storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(leaf));
+                }
+                
             private:
+                // Only values stored as doubles can be converted concurrently. Exact and parametric values are backed
+                // by carl, whose number and polynomial pools must not be accessed by several workers.
+                static const bool extractConcurrently = std::is_same<ValueType, double>::value && std::is_same<ExportValueType, double>::value;
+                
                 virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
                     this->createMatrixEntryStorage();
-                    extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                    if (extractConcurrently) {
+                        LACE_ME;
+                        SylvanTransitionMatrixExtractionStep step = {matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? &this->nondeterminismOdd : &this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0};
+                        CALL(sylvan_extract_transition_matrix, &step, this);
+                    } else {
+                        extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                    }
                     return this->createMatrixFromEntries();
                 }
                 
                 virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& vector, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& variablesCube, storm::dd::Odd const& odd) override {
                     std::vector<ExportValueType> result(odd.getTotalOffset());
-                    extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), variablesCube.getInternalBdd().getSylvanBdd().GetBDD(), odd, 0, result);
+                    if (extractConcurrently) {
+                        LACE_ME;
+                        currentVector = &result;
+                        CALL(sylvan_extract_vector, vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), variablesCube.getInternalBdd().getSylvanBdd().GetBDD(), &odd, 0, this);
+                        currentVector = nullptr;
+                    } else {
+                        extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), variablesCube.getInternalBdd().getSylvanBdd().GetBDD(), odd, 0, result);
+                    }
                     return result;
                 }
                 
@@ -813,8 +1059,8 @@ namespace storm {
                     }
                 }
                 
-                // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block.
-                spp::sparse_hash_map<BDD, uint64_t> blockToOffset;
+                // The vector that is currently being extracted concurrently (if any).
+                std::vector<ExportValueType>* currentVector;
             };
 
             template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -825,6 +1071,11 @@ namespace storm {
                 this->quotientFormat = settings.getQuotientFormat();
             }
             
+            template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+            QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat) : QuotientExtractor() {
+                this->quotientFormat = quotientFormat;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
             std::shared_ptr<storm::models::Model<ExportValueType>> QuotientExtractor<DdType, ValueType, ExportValueType>::extract(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation) {
                 auto start = std::chrono::high_resolution_clock::now();
@@ -20,6 +20,7 @@ namespace storm {
             class QuotientExtractor {
             public:
                 QuotientExtractor();
+                QuotientExtractor(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat);
                 
                 std::shared_ptr<storm::models::Model<ExportValueType>> extract(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation);
                 
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 
+#include "storm/storage/dd/DdOperationStatistics.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
 
@@ -41,7 +43,9 @@ namespace storm {
         }
         
         InternalDdManager<DdType::CUDD>::~InternalDdManager() {
-            // Intentionally left empty.
+            if (storm::dd::DdOperationStatistics::getInstance().isEnabled()) {
+                storm::dd::DdOperationStatistics::getInstance().recordLibraryStatistics("cudd", this->getLibraryStatistics());
+            }
         }
         
         InternalBdd<DdType::CUDD> InternalDdManager<DdType::CUDD>::getBddOne() const {
@@ -157,6 +161,22 @@ namespace storm {
             this->getCuddManager().DebugCheck();
         }
         
+        std::map<std::string, uint64_t> InternalDdManager<DdType::CUDD>::getLibraryStatistics() const {
+            ::DdManager* manager = this->getCuddManager().getManager();
+            std::map<std::string, uint64_t> result;
+            result["live-nodes"] = Cudd_ReadKeys(manager) - Cudd_ReadDead(manager);
+            result["dead-nodes"] = Cudd_ReadDead(manager);
+            result["peak-nodes"] = static_cast<uint64_t>(Cudd_ReadPeakNodeCount(manager));
+            result["unique-table-slots"] = Cudd_ReadSlots(manager);
+            result["cache-slots"] = Cudd_ReadCacheSlots(manager);
+            result["cache-lookups"] = static_cast<uint64_t>(Cudd_ReadCacheLookUps(manager));
+            result["cache-hits"] = static_cast<uint64_t>(Cudd_ReadCacheHits(manager));
+            result["garbage-collections"] = Cudd_ReadGarbageCollections(manager);
+            result["reorderings"] = Cudd_ReadReorderings(manager);
+            result["memory-in-use"] = Cudd_ReadMemoryInUse(manager);
+            return result;
+        }
+        
         cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
             return cuddManager;
         }
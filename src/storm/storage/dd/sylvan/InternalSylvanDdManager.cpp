@@ -3,6 +3,8 @@
 #include <cmath>
 #include <iostream>
 
+#include "storm/storage/dd/DdOperationStatistics.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
 
@@ -119,6 +121,10 @@ namespace storm {
 //                sylvan_stats_report(filePointer, 0);
 //                fclose(filePointer);
                 
+                if (storm::dd::DdOperationStatistics::getInstance().isEnabled()) {
+                    storm::dd::DdOperationStatistics::getInstance().recordLibraryStatistics("sylvan", this->getLibraryStatistics());
+                }
+                
                 sylvan::Sylvan::quitPackage();
                 lace_exit();
             }
@@ -262,6 +268,38 @@ namespace storm {
             return nextFreeVariableIndex;
         }
         
+        std::map<std::string, uint64_t> InternalDdManager<DdType::Sylvan>::getLibraryStatistics() const {
+            LACE_ME;
+            
+            std::map<std::string, uint64_t> result;
+            size_t filled = 0;
+            size_t total = 0;
+            sylvan_table_usage(&filled, &total);
+            result["live-nodes"] = filled;
+            result["unique-table-slots"] = total;
+            
+            // Note that the counters are only maintained if sylvan was built with statistics enabled.
+            sylvan_stats_t stats;
+            sylvan_stats_snapshot(&stats);
+            result["nodes-created"] = stats.counters[BDD_NODES_CREATED];
+            result["nodes-reused"] = stats.counters[BDD_NODES_REUSED];
+            result["garbage-collections"] = stats.counters[SYLVAN_GC_COUNT];
+            
+            // Each operation has three consecutive counters: calls, puts into the cache and cache hits.
+            uint64_t operationCalls = 0;
+            uint64_t cachePuts = 0;
+            uint64_t cacheHits = 0;
+            for (int counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+                operationCalls += stats.counters[counter];
+                cachePuts += stats.counters[counter + 1];
+                cacheHits += stats.counters[counter + 2];
+            }
+            result["cache-lookups"] = operationCalls;
+            result["cache-puts"] = cachePuts;
+            result["cache-hits"] = cacheHits;
+            return result;
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         
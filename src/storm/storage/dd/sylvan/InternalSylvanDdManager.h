@@ -1,6 +1,9 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <map>
+#include <string>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -138,6 +141,14 @@ namespace storm {
              * @return The number of managed variables.
              */
             uint_fast64_t getNumberOfDdVariables() const;
+
+            /*!
+             * Retrieves statistics of the underlying library (e.g. the usage of the unique table and the computed
+             * table) as key-value pairs.
+             *
+             * @return The statistics of the library.
+             */
+            std::map<std::string, uint64_t> getLibraryStatistics() const;
             
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
@@ -0,0 +1,251 @@
+#include "storm/storage/memorystructure/ImplicitSparseModelMemoryProduct.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace storage {
+
+        template <typename ValueType>
+        ImplicitSparseModelMemoryProduct<ValueType>::ImplicitSparseModelMemoryProduct(storm::storage::SparseMatrix<ValueType> const& modelTransitions, storm::storage::MemoryStructure const& memory, uint64_t cacheSize) : modelTransitions(modelTransitions), memory(memory), memoryStateCount(memory.getNumberOfStates()), memorySuccessors(memoryStateCount), cacheSize(cacheSize), numberOfCachedEntries(0) {
+            for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
+                for (uint64_t successorMemoryState = 0; successorMemoryState < memoryStateCount; ++successorMemoryState) {
+                    if (memory.getTransitionMatrix()[memoryState][successorMemoryState]) {
+                        memorySuccessors[memoryState].push_back(successorMemoryState);
+                    }
+                }
+            }
+
+            rowGroupIndices.reserve(getNumberOfStates() + 1);
+            uint64_t row = 0;
+            for (uint64_t modelState = 0; modelState < modelTransitions.getRowGroupCount(); ++modelState) {
+                uint64_t rowGroupSize = modelTransitions.getRowGroupSize(modelState);
+                for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
+                    rowGroupIndices.push_back(row);
+                    row += rowGroupSize;
+                }
+            }
+            rowGroupIndices.push_back(row);
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getNumberOfStates() const {
+            return modelTransitions.getRowGroupCount() * memoryStateCount;
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getNumberOfRows() const {
+            return modelTransitions.getRowCount() * memoryStateCount;
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getProductState(uint64_t modelState, uint64_t memoryState) const {
+            STORM_LOG_ASSERT(memoryState < memoryStateCount, "Invalid memory state: " << memoryState << ".");
+            return modelState * memoryStateCount + memoryState;
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getModelState(uint64_t productState) const {
+            return productState / memoryStateCount;
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getMemoryState(uint64_t productState) const {
+            return productState % memoryStateCount;
+        }
+
+        template <typename ValueType>
+        std::vector<uint64_t> const& ImplicitSparseModelMemoryProduct<ValueType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getModelRow(uint64_t productRow) const {
+            return getModelRowAndMemoryState(productRow).first;
+        }
+
+        template <typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& ImplicitSparseModelMemoryProduct<ValueType>::getModelTransitions() const {
+            return modelTransitions;
+        }
+
+        template <typename ValueType>
+        std::pair<uint64_t, uint64_t> ImplicitSparseModelMemoryProduct<ValueType>::getModelRowAndMemoryState(uint64_t productRow) const {
+            STORM_LOG_ASSERT(productRow < getNumberOfRows(), "Invalid product row: " << productRow << ".");
+            // Empty row groups share their index with the next row group, so we take the last group starting at or
+            // before the given row.
+            uint64_t productState = std::distance(rowGroupIndices.begin(), std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), productRow)) - 1;
+            uint64_t modelRow = modelTransitions.getRowGroupIndices()[getModelState(productState)] + (productRow - rowGroupIndices[productState]);
+            return std::make_pair(modelRow, getMemoryState(productState));
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getSuccessorMemoryState(uint64_t memoryState, uint64_t modelTransition) const {
+            for (auto const& successorMemoryState : memorySuccessors[memoryState]) {
+                if (memory.getTransitionMatrix()[memoryState][successorMemoryState].get().get(modelTransition)) {
+                    return successorMemoryState;
+                }
+            }
+            STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "The successor memory state for the given transition could not be found.");
+            return memoryStateCount;
+        }
+
+        template <typename ValueType>
+        storm::storage::BitVector ImplicitSparseModelMemoryProduct<ValueType>::getInitialStates(storm::storage::BitVector const& modelInitialStates) const {
+            storm::storage::BitVector result(getNumberOfStates(), false);
+            auto memoryInitIt = memory.getInitialMemoryStates().begin();
+            for (auto const& modelInit : modelInitialStates) {
+                result.set(getProductState(modelInit, *memoryInitIt), true);
+                ++memoryInitIt;
+            }
+            STORM_LOG_ASSERT(memoryInitIt == memory.getInitialMemoryStates().end(), "Unexpected number of initial states.");
+            return result;
+        }
+
+        template <typename ValueType>
+        std::vector<typename ImplicitSparseModelMemoryProduct<ValueType>::EntryType> const& ImplicitSparseModelMemoryProduct<ValueType>::getRow(uint64_t productRow) const {
+            auto cachedRowIt = cachedRows.find(productRow);
+            if (cachedRowIt != cachedRows.end()) {
+                return cachedRowIt->second;
+            }
+
+            auto modelRowAndMemoryState = getModelRowAndMemoryState(productRow);
+            computeRow(modelRowAndMemoryState.first, modelRowAndMemoryState.second, currentRow);
+            return currentRow;
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::computeRow(uint64_t modelRow, uint64_t memoryState, std::vector<EntryType>& row) const {
+            row.clear();
+            for (auto entryIt = modelTransitions.begin(modelRow), entryIte = modelTransitions.end(modelRow); entryIt != entryIte; ++entryIt) {
+                uint64_t successorMemoryState = getSuccessorMemoryState(memoryState, entryIt - modelTransitions.begin());
+                row.emplace_back(getProductState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+            }
+        }
+
+        template <typename ValueType>
+        ValueType ImplicitSparseModelMemoryProduct<ValueType>::multiplyRow(uint64_t productRow, std::vector<ValueType> const& x) const {
+            auto modelRowAndMemoryState = getModelRowAndMemoryState(productRow);
+            return multiplyRow(productRow, modelRowAndMemoryState.first, modelRowAndMemoryState.second, x);
+        }
+
+        template <typename ValueType>
+        ValueType ImplicitSparseModelMemoryProduct<ValueType>::multiplyRow(uint64_t productRow, uint64_t modelRow, uint64_t memoryState, std::vector<ValueType> const& x) const {
+            ValueType result = storm::utility::zero<ValueType>();
+
+            auto cachedRowIt = cachedRows.find(productRow);
+            if (cachedRowIt == cachedRows.end() && numberOfCachedEntries + modelTransitions.getRow(modelRow).getNumberOfEntries() <= cacheSize) {
+                cachedRowIt = cachedRows.emplace(productRow, std::vector<EntryType>()).first;
+                computeRow(modelRow, memoryState, cachedRowIt->second);
+                numberOfCachedEntries += cachedRowIt->second.size();
+            }
+
+            if (cachedRowIt != cachedRows.end()) {
+                for (auto const& entry : cachedRowIt->second) {
+                    result += entry.getValue() * x[entry.getColumn()];
+                }
+            } else {
+                for (auto entryIt = modelTransitions.begin(modelRow), entryIte = modelTransitions.end(modelRow); entryIt != entryIte; ++entryIt) {
+                    uint64_t successorMemoryState = getSuccessorMemoryState(memoryState, entryIt - modelTransitions.begin());
+                    result += entryIt->getValue() * x[getProductState(entryIt->getColumn(), successorMemoryState)];
+                }
+            }
+            return result;
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            STORM_LOG_ASSERT(x.size() == getNumberOfStates(), "Unexpected size of the input vector.");
+            STORM_LOG_ASSERT(result.size() == getNumberOfRows(), "Unexpected size of the result vector.");
+            STORM_LOG_ASSERT(&x != &result, "The input and the result vector must not coincide.");
+            std::vector<uint64_t> const& modelRowGroupIndices = modelTransitions.getRowGroupIndices();
+            uint64_t productRow = 0;
+            for (uint64_t modelState = 0; modelState < modelTransitions.getRowGroupCount(); ++modelState) {
+                for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
+                    for (uint64_t modelRow = modelRowGroupIndices[modelState]; modelRow < modelRowGroupIndices[modelState + 1]; ++modelRow, ++productRow) {
+                        result[productRow] = multiplyRow(productRow, modelRow, memoryState, x);
+                        if (b) {
+                            result[productRow] += (*b)[productRow];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            STORM_LOG_THROW(getNumberOfRows() == getNumberOfStates(), storm::exceptions::InvalidOperationException, "Gauss-Seidel multiplication requires one row per product state.");
+            STORM_LOG_ASSERT(x.size() == getNumberOfStates(), "Unexpected size of the input vector.");
+            for (uint64_t productState = getNumberOfStates(); productState > 0;) {
+                --productState;
+                uint64_t modelRow = modelTransitions.getRowGroupIndices()[getModelState(productState)];
+                ValueType newValue = multiplyRow(productState, modelRow, getMemoryState(productState), x);
+                if (b) {
+                    newValue += (*b)[productState];
+                }
+                x[productState] = std::move(newValue);
+            }
+        }
+
+        template <typename ValueType>
+        ValueType ImplicitSparseModelMemoryProduct<ValueType>::multiplyAndReduceState(OptimizationDirection const& dir, uint64_t productState, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            uint64_t memoryState = getMemoryState(productState);
+            uint64_t modelRow = modelTransitions.getRowGroupIndices()[getModelState(productState)];
+            ValueType currentValue = storm::utility::zero<ValueType>();
+            if (choices) {
+                (*choices)[productState] = 0;
+            }
+            for (uint64_t productRow = rowGroupIndices[productState]; productRow < rowGroupIndices[productState + 1]; ++productRow, ++modelRow) {
+                ValueType newValue = multiplyRow(productRow, modelRow, memoryState, x);
+                if (b) {
+                    newValue += (*b)[productRow];
+                }
+                if (productRow == rowGroupIndices[productState] || (dir == OptimizationDirection::Minimize && newValue < currentValue) || (dir == OptimizationDirection::Maximize && newValue > currentValue)) {
+                    currentValue = std::move(newValue);
+                    if (choices) {
+                        (*choices)[productState] = productRow - rowGroupIndices[productState];
+                    }
+                }
+            }
+            return currentValue;
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(x.size() == getNumberOfStates(), "Unexpected size of the input vector.");
+            STORM_LOG_ASSERT(result.size() == getNumberOfStates(), "Unexpected size of the result vector.");
+            STORM_LOG_ASSERT(&x != &result, "The input and the result vector must not coincide.");
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                result[productState] = multiplyAndReduceState(dir, productState, x, b, choices);
+            }
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(x.size() == getNumberOfStates(), "Unexpected size of the input vector.");
+            for (uint64_t productState = getNumberOfStates(); productState > 0;) {
+                --productState;
+                x[productState] = multiplyAndReduceState(dir, productState, x, b, choices);
+            }
+        }
+
+        template <typename ValueType>
+        uint64_t ImplicitSparseModelMemoryProduct<ValueType>::getNumberOfCachedEntries() const {
+            return numberOfCachedEntries;
+        }
+
+        template <typename ValueType>
+        void ImplicitSparseModelMemoryProduct<ValueType>::clearCache() const {
+            cachedRows.clear();
+            numberOfCachedEntries = 0;
+        }
+
+        template class ImplicitSparseModelMemoryProduct<double>;
+        template class ImplicitSparseModelMemoryProduct<storm::RationalNumber>;
+    }
+}
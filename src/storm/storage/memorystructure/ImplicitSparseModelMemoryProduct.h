@@ -0,0 +1,139 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/memorystructure/MemoryStructure.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents the transition matrix of the (full) product of a sparse model and a memory structure
+         * without building it. The rows of the product are computed on demand from the transition matrix of the model
+         * and the transitions of the memory structure, such that only a small cache of rows occupies memory.
+         *
+         * The states and rows are numbered as in the full product built by SparseModelMemoryProduct, i.e. the product
+         * state (s, m) has index (s * memoryStateCount) + m and its rows are the rows of model state s (in the same order).
+         *
+         * Since the row cache is filled during the (const) multiplications, an object of this class must not be used
+         * by multiple threads concurrently.
+         */
+        template <typename ValueType>
+        class ImplicitSparseModelMemoryProduct {
+        public:
+            typedef MatrixEntry<typename SparseMatrix<ValueType>::index_type, ValueType> EntryType;
+
+            /*!
+             * Creates the product of the given transition matrix and memory structure.
+             *
+             * @param modelTransitions The transition matrix of the model. It must outlive this object.
+             * @param memory The memory structure. It must outlive this object.
+             * @param cacheSize The maximal number of product entries that are kept in the row cache.
+             */
+            ImplicitSparseModelMemoryProduct(storm::storage::SparseMatrix<ValueType> const& modelTransitions, storm::storage::MemoryStructure const& memory, uint64_t cacheSize = 0);
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfRows() const;
+
+            uint64_t getProductState(uint64_t modelState, uint64_t memoryState) const;
+            uint64_t getModelState(uint64_t productState) const;
+            uint64_t getMemoryState(uint64_t productState) const;
+
+            // Retrieves the row group indices of the product, i.e. the index of the first row of each product state.
+            std::vector<uint64_t> const& getRowGroupIndices() const;
+
+            // Retrieves the model row from which the given product row originates.
+            uint64_t getModelRow(uint64_t productRow) const;
+
+            // Retrieves the transition matrix of the model.
+            storm::storage::SparseMatrix<ValueType> const& getModelTransitions() const;
+
+            /*!
+             * Retrieves the product states that are initial w.r.t. the given initial states of the model and the
+             * initial memory states of the memory structure.
+             */
+            storm::storage::BitVector getInitialStates(storm::storage::BitVector const& modelInitialStates) const;
+
+            /*!
+             * Retrieves the entries of the given product row. The returned reference is valid until the next call to
+             * this method.
+             */
+            std::vector<EntryType> const& getRow(uint64_t productRow) const;
+
+            /*!
+             * Multiplies the given product row with the given vector.
+             */
+            ValueType multiplyRow(uint64_t productRow, std::vector<ValueType> const& x) const;
+
+            /*!
+             * Multiplies the product matrix with the given vector and adds the (optional) summand. The input and the
+             * result vector must not coincide.
+             */
+            void multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+            /*!
+             * Multiplies the product matrix with the given vector in place, processing the rows backwards such that
+             * updated values are used as soon as they are available. This requires one row per product state.
+             */
+            void multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b) const;
+
+            /*!
+             * Multiplies the product matrix with the given vector, adds the (optional) summand and reduces the result
+             * to one value per product state. The input and the result vector must not coincide.
+             */
+            void multiplyAndReduce(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const;
+
+            /*!
+             * Multiplies the product matrix with the given vector, adds the (optional) summand and reduces the result
+             * in place, processing the product states backwards.
+             */
+            void multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const;
+
+            // Retrieves the number of product entries that are currently cached.
+            uint64_t getNumberOfCachedEntries() const;
+
+            // Drops all cached rows.
+            void clearCache() const;
+
+        private:
+            // Retrieves the model row and the memory state from which the given product row originates.
+            std::pair<uint64_t, uint64_t> getModelRowAndMemoryState(uint64_t productRow) const;
+
+            // Retrieves the memory state that is reached from the given memory state via the given model transition.
+            uint64_t getSuccessorMemoryState(uint64_t memoryState, uint64_t modelTransition) const;
+
+            // Computes the product row for the given model row and memory state.
+            void computeRow(uint64_t modelRow, uint64_t memoryState, std::vector<EntryType>& row) const;
+
+            // Computes the value of the given product row w.r.t. the given vector.
+            ValueType multiplyRow(uint64_t productRow, uint64_t modelRow, uint64_t memoryState, std::vector<ValueType> const& x) const;
+
+            // Computes the reduced value of the given product state and writes the choice (if requested).
+            ValueType multiplyAndReduceState(OptimizationDirection const& dir, uint64_t productState, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const;
+
+            storm::storage::SparseMatrix<ValueType> const& modelTransitions;
+            storm::storage::MemoryStructure const& memory;
+            uint64_t const memoryStateCount;
+
+            // For each memory state, the memory states that are reachable via some model transition. Successor
+            // lookups only test the transitions to these memory states.
+            std::vector<std::vector<uint64_t>> memorySuccessors;
+
+            // The row group indices of the product.
+            std::vector<uint64_t> rowGroupIndices;
+
+            // The cache of product rows. As value iteration sweeps over all rows, replacing cached rows would only
+            // cause further misses, so rows are added (in the order they are requested) as long as there is space.
+            uint64_t const cacheSize;
+            mutable uint64_t numberOfCachedEntries;
+            mutable std::unordered_map<uint64_t, std::vector<EntryType>> cachedRows;
+
+            // The row that is handed out by getRow for rows that are not cached.
+            mutable std::vector<EntryType> currentRow;
+        };
+    }
+}
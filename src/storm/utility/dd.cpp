@@ -1,5 +1,9 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -82,6 +86,92 @@ namespace storm {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
             }
             
+            uint64_t computeTotalSpan(std::vector<uint64_t> const& positions, std::vector<std::vector<uint64_t>> const& hyperedges) {
+                uint64_t result = 0;
+                for (auto const& hyperedge : hyperedges) {
+                    if (hyperedge.empty()) {
+                        continue;
+                    }
+                    uint64_t minimalPosition = positions[hyperedge.front()];
+                    uint64_t maximalPosition = minimalPosition;
+                    for (auto const& variable : hyperedge) {
+                        minimalPosition = std::min(minimalPosition, positions[variable]);
+                        maximalPosition = std::max(maximalPosition, positions[variable]);
+                    }
+                    result += maximalPosition - minimalPosition;
+                }
+                return result;
+            }
+            
+            std::vector<uint64_t> computeForceVariableOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges) {
+                std::vector<uint64_t> order(numberOfVariables);
+                std::iota(order.begin(), order.end(), 0ull);
+                std::vector<uint64_t> positions = order;
+                
+                // Determine the hyperedges every variable is contained in.
+                std::vector<std::vector<uint64_t>> variableToHyperedges(numberOfVariables);
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    for (auto const& variable : hyperedges[hyperedgeIndex]) {
+                        STORM_LOG_ASSERT(variable < numberOfVariables, "Illegal variable index in hyperedge.");
+                        variableToHyperedges[variable].push_back(hyperedgeIndex);
+                    }
+                }
+                
+                std::vector<uint64_t> bestOrder = order;
+                uint64_t bestSpan = computeTotalSpan(positions, hyperedges);
+                uint64_t lastSpan = bestSpan;
+                
+                // The original paper suggests a logarithmic number of iterations, but we additionally stop as soon as
+                // the total span does not decrease anymore.
+                uint64_t maximalIterations = 10 * static_cast<uint64_t>(std::ceil(std::log2(std::max<uint64_t>(numberOfVariables, 2))));
+                std::vector<double> centersOfGravity(hyperedges.size());
+                std::vector<double> newPositions(numberOfVariables);
+                for (uint64_t iteration = 0; iteration < maximalIterations; ++iteration) {
+                    // Compute the center of gravity of every hyperedge.
+                    for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                        auto const& hyperedge = hyperedges[hyperedgeIndex];
+                        double sum = 0;
+                        for (auto const& variable : hyperedge) {
+                            sum += positions[variable];
+                        }
+                        centersOfGravity[hyperedgeIndex] = hyperedge.empty() ? 0 : sum / hyperedge.size();
+                    }
+                    
+                    // Move every variable to the average of the centers of gravity of its hyperedges.
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        auto const& variableHyperedges = variableToHyperedges[variable];
+                        if (variableHyperedges.empty()) {
+                            newPositions[variable] = positions[variable];
+                        } else {
+                            double sum = 0;
+                            for (auto const& hyperedgeIndex : variableHyperedges) {
+                                sum += centersOfGravity[hyperedgeIndex];
+                            }
+                            newPositions[variable] = sum / variableHyperedges.size();
+                        }
+                    }
+                    
+                    // Derive the new order by sorting the variables according to their tentative positions.
+                    std::stable_sort(order.begin(), order.end(), [&newPositions] (uint64_t const& first, uint64_t const& second) { return newPositions[first] < newPositions[second]; } );
+                    for (uint64_t position = 0; position < numberOfVariables; ++position) {
+                        positions[order[position]] = position;
+                    }
+                    
+                    uint64_t span = computeTotalSpan(positions, hyperedges);
+                    STORM_LOG_TRACE("FORCE iteration " << iteration << " yields total span " << span << ".");
+                    if (span < bestSpan) {
+                        bestSpan = span;
+                        bestOrder = order;
+                    }
+                    if (span >= lastSpan) {
+                        break;
+                    }
+                    lastSpan = span;
+                }
+                
+                return bestOrder;
+            }
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
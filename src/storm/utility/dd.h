@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -34,6 +35,17 @@ namespace storm {
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            
+            /*!
+             * Computes an order of the given variables using the FORCE heuristic (Aloul, Markov, Sakallah: "FORCE: A
+             * Fast and Easy-To-Implement Variable-Ordering Heuristic"). The heuristic tries to place variables that occur
+             * together in the same hyperedge close to each other, starting from the order 0, ..., numberOfVariables - 1.
+             *
+             * @param numberOfVariables The number of variables to order.
+             * @param hyperedges The hyperedges, each given as the indices of the variables it connects.
+             * @return The computed order, that is, the i-th entry is the index of the variable to put at position i.
+             */
+            std::vector<uint64_t> computeForceVariableOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges);
                         
         }
     }
@@ -384,6 +384,66 @@ namespace storm {
                 return result;
             }
             
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Bdd<Type> computeBottomScc(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& states) {
+                // Any bottom SCC in the forward closure of some state is also a bottom SCC of the given states, so we
+                // repeatedly restrict the search to the forward closure of a state outside the pivot's SCC.
+                storm::dd::Bdd<Type> candidates = states;
+                while (true) {
+                    storm::dd::Bdd<Type> pivot = candidates.existsAbstractRepresentative(model.getRowVariables());
+                    
+                    storm::dd::Bdd<Type> forward = pivot;
+                    storm::dd::Bdd<Type> lastForward = model.getManager().getBddZero();
+                    while (lastForward != forward) {
+                        lastForward = forward;
+                        forward |= forward.relationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    }
+                    
+                    storm::dd::Bdd<Type> backward = pivot;
+                    storm::dd::Bdd<Type> lastBackward = model.getManager().getBddZero();
+                    while (lastBackward != backward) {
+                        lastBackward = backward;
+                        backward |= backward.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables()) && forward;
+                    }
+                    
+                    if (forward == backward) {
+                        return forward;
+                    }
+                    candidates = forward && !backward;
+                }
+            }
+            
+            template <storm::dd::DdType Type, typename ValueType>
+            std::vector<storm::dd::Bdd<Type>> computeTopologicalBlocks(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& states, uint64_t minimalBlockSize) {
+                std::vector<storm::dd::Bdd<Type>> result;
+                
+                storm::dd::Bdd<Type> remainingStates = states;
+                storm::dd::Bdd<Type> currentBlock = model.getManager().getBddZero();
+                uint64_t currentBlockSize = 0;
+                while (!remainingStates.isZero()) {
+                    // Restrict the transitions to the ones between remaining states.
+                    storm::dd::Bdd<Type> remainingTransitions = transitionMatrix && remainingStates && remainingStates.swapVariables(model.getRowColumnMetaVariablePairs());
+                    
+                    // States without a successor among the remaining states can be processed right away. Only if
+                    // there are none, we need to search for a bottom SCC.
+                    storm::dd::Bdd<Type> nextBlock = remainingStates && !remainingTransitions.existsAbstract(model.getColumnVariables());
+                    if (nextBlock.isZero()) {
+                        nextBlock = computeBottomScc(model, remainingTransitions, remainingStates);
+                    }
+                    
+                    remainingStates &= !nextBlock;
+                    currentBlock |= nextBlock;
+                    currentBlockSize += nextBlock.getNonZeroCount();
+                    if (currentBlockSize >= minimalBlockSize || remainingStates.isZero()) {
+                        result.push_back(currentBlock);
+                        currentBlock = model.getManager().getBddZero();
+                        currentBlockSize = 0;
+                    }
+                }
+                
+                return result;
+            }
+            
             template <typename T>
             void computeSchedulerStayingInStates(storm::storage::BitVector const& states, storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::Scheduler<T>& scheduler) {
                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -1544,6 +1604,8 @@ namespace storm {
             
             template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, storm::dd::Bdd<storm::dd::DdType::CUDD>> performProb01(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates);
             
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeTopologicalBlocks(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, uint64_t minimalBlockSize);
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates);
             
             template storm::dd::Bdd<storm::dd::DdType::CUDD> performProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates);
@@ -1584,6 +1646,8 @@ namespace storm {
             
             template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> performProb01(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
             
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeTopologicalBlocks(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+            
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
@@ -1624,6 +1688,8 @@ namespace storm {
             
             template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> performProb01(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
             
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeTopologicalBlocks(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+            
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
@@ -1660,6 +1726,8 @@ namespace storm {
             
             template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> performProb01(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
             
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeTopologicalBlocks(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+            
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0E(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
@@ -239,6 +239,23 @@ namespace storm {
             template <storm::dd::DdType Type, typename ValueType>
             std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>> performProb01(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates);
             
+            /*!
+             * Decomposes the given states into blocks that can be processed in (reverse) topological order, i.e. all
+             * successors of the states of a block either lie in the block itself, in one of the preceding blocks or
+             * outside the given states. The blocks are obtained by repeatedly splitting off the states without
+             * successors among the remaining states and (if there are none) a bottom SCC of the remaining states.
+             * Consecutive blocks are merged until they contain at least the given number of states.
+             *
+             * @param model The (symbolic) model for which to compute the blocks. This is used for retrieving the
+             * manager and information about the meta variables.
+             * @param transitionMatrix The transition relation of the model as a BDD over the row and column variables.
+             * @param states The states that are to be decomposed.
+             * @param minimalBlockSize The minimal number of states of a block (the last block may be smaller).
+             * @return The blocks in the order in which they can be processed.
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            std::vector<storm::dd::Bdd<Type>> computeTopologicalBlocks(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& states, uint64_t minimalBlockSize);
+            
             /*!
              * Computes a scheduler for the given states that chooses an action that stays completely in the very same set.
              * Note that this assumes that there is a legal choice for each of the states.
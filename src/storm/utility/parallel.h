@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * Calls the given function for each of the given tasks. The tasks are handed out (in the given order) to the
+             * given number of threads, one of which is the calling thread. If a call throws, the remaining tasks are
+             * skipped and the first exception is rethrown after all threads have finished.
+             *
+             * @param tasks The tasks to process.
+             * @param numberOfThreads The number of threads to use. For at most one thread, the tasks are processed by
+             * the calling thread.
+             * @param function The function to call for each task. It must be safe to call it concurrently.
+             */
+            template<typename TaskType, typename FunctionType>
+            void forEachConcurrently(std::vector<TaskType> const& tasks, uint64_t numberOfThreads, FunctionType const& function) {
+                numberOfThreads = std::min<uint64_t>(numberOfThreads, tasks.size());
+                if (numberOfThreads <= 1) {
+                    for (auto const& task : tasks) {
+                        function(task);
+                    }
+                    return;
+                }
+
+                std::atomic<uint64_t> nextTask(0);
+                std::mutex exceptionMutex;
+                std::exception_ptr exception;
+                auto worker = [&] () {
+                    try {
+                        for (uint64_t index = nextTask++; index < tasks.size(); index = nextTask++) {
+                            function(tasks[index]);
+                        }
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(exceptionMutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                        nextTask = tasks.size();
+                    }
+                };
+
+                std::vector<std::thread> threads;
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+        }
+    }
+}
@@ -1,6 +1,7 @@
+#include <algorithm>
+#include <limits>
 #include <ostream>
 #include <queue>
-#include <set>
 #include <string>
 
 #include "storm/models/sparse/Model.h"
@@ -17,6 +18,9 @@
 namespace storm {
     namespace utility {
         namespace ksp {
+            template <typename T>
+            const uint_fast64_t ShortestPathsGenerator<T>::noIndex = std::numeric_limits<uint_fast64_t>::max();
+
             template <typename T>
             ShortestPathsGenerator<T>::ShortestPathsGenerator(storage::SparseMatrix<T> const& transitionMatrix,
                                                               std::unordered_map<state_t, T> const& targetProbMap,
@@ -29,17 +33,13 @@ namespace storm {
                     targetProbMap(targetProbMap),
                     matrixFormat(matrixFormat) {
 
-                computePredecessors();
+                assert(transitionMatrix.hasTrivialRowGrouping());
 
                 // gives us SP-predecessors, SP-distances
-                performDijkstra();
-
-                computeSPSuccessors();
-
-                // constructs the recursive shortest path representations
-                initializeShortestPaths();
+                std::vector<state_t> settleOrder = performDijkstra();
 
-                candidatePaths.resize(numStates);
+                // constructs the heaps that implicitly represent all paths
+                buildSidetrackHeaps(settleOrder);
             }
 
             template <typename T>
@@ -70,26 +70,15 @@ namespace storm {
             template <typename T>
             T ShortestPathsGenerator<T>::getDistance(unsigned long k) {
                 computeKSP(k);
-                return kShortestPaths[metaTarget][k - 1].distance;
+                return kShortestPaths[k - 1].distance;
             }
 
             template <typename T>
             BitVector ShortestPathsGenerator<T>::getStates(unsigned long k) {
-                computeKSP(k);
                 BitVector stateSet(numStates - 1, false); // no meta-target
-
-                Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
-                boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
-                // this omits the first node, which is actually convenient since that's the meta-target
-
-                while (maybePredecessor) {
-                    state_t predecessor = maybePredecessor.get();
-                    stateSet.set(predecessor, true);
-
-                    currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1]; // god damn you, index
-                    maybePredecessor = currentPath.predecessorNode;
+                for (state_t state : getPathAsList(k)) {
+                    stateSet.set(state, true);
                 }
-
                 return stateSet;
             }
 
@@ -97,239 +86,222 @@ namespace storm {
             std::vector<state_t> ShortestPathsGenerator<T>::getPathAsList(unsigned long k) {
                 computeKSP(k);
 
-                std::vector<state_t> backToFrontList;
-
-                Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
-                boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
-                // this omits the first node, which is actually convenient since that's the meta-target
+                // collect the sidetracks in the order in which they are taken when walking back from the meta-target
+                std::vector<uint_fast64_t> sidetracks;
+                for (uint_fast64_t pathIndex = k - 1; kShortestPaths[pathIndex].sidetrack != noIndex; pathIndex = kShortestPaths[pathIndex].prefix) {
+                    sidetracks.push_back(kShortestPaths[pathIndex].sidetrack);
+                }
+                std::reverse(sidetracks.begin(), sidetracks.end());
 
-                while (maybePredecessor) {
-                    state_t predecessor = maybePredecessor.get();
-                    backToFrontList.push_back(predecessor);
+                std::vector<state_t> backToFrontList;
+                auto appendTreePath = [&] (state_t from, state_t to) {
+                    // walk back in the shortest path tree; `to` is an ancestor of `from`
+                    state_t currentNode = from;
+                    while (true) {
+                        if (currentNode != metaTarget) {
+                            backToFrontList.push_back(currentNode);
+                        }
+                        if (currentNode == to || !shortestPathPredecessors[currentNode]) {
+                            break;
+                        }
+                        currentNode = shortestPathPredecessors[currentNode].get();
+                    }
+                };
 
-                    currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1];
-                    maybePredecessor = currentPath.predecessorNode;
+                state_t currentNode = metaTarget;
+                for (uint_fast64_t sidetrack : sidetracks) {
+                    appendTreePath(currentNode, heapNodes[sidetrack].head);
+                    currentNode = heapNodes[sidetrack].tail;
                 }
+                // finally, follow the tree back to an initial state
+                appendTreePath(currentNode, metaTarget);
 
                 return backToFrontList;
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::computePredecessors() {
-                assert(transitionMatrix.hasTrivialRowGrouping());
-
-                // one more for meta-target
-                graphPredecessors.resize(numStates);
-
-                for (state_t i = 0; i < numStates - 1; i++) {
-                    for (auto const& transition : transitionMatrix.getRowGroup(i)) {
-                        // to avoid non-minimal paths, the meta-target-predecessors are
-                        // *not* predecessors of any state but the meta-target
-                        if (!isMetaTargetPredecessor(i)) {
-                            graphPredecessors[transition.getColumn()].push_back(i);
-                        }
+            bool ShortestPathsGenerator<T>::computeNextPath() {
+                if (kShortestPaths.empty()) {
+                    // the shortest path is the path in the shortest path tree, it has no sidetracks
+                    if (shortestPathDistances[metaTarget] == zero<T>()) {
+                        return false;
                     }
+                    kShortestPaths.push_back(Path<T> {noIndex, noIndex, shortestPathDistances[metaTarget]});
+                } else {
+                    if (candidatePaths.empty()) {
+                        return false;
+                    }
+                    kShortestPaths.push_back(candidatePaths.top());
+                    candidatePaths.pop();
                 }
-
-                // meta-target has exactly the meta-target-predecessors as predecessors
-                // (duh. note that the meta-target-predecessors used to be called target,
-                // but that's not necessarily true in the matrix/value invocation case)
-                for (auto targetProbPair : targetProbMap) {
-                    graphPredecessors[metaTarget].push_back(targetProbPair.first);
-                }
+                addCandidatePaths(kShortestPaths.size() - 1);
+                return true;
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::performDijkstra() {
-                // the existing Dijkstra isn't working anyway AND
-                // doesn't fully meet our requirements, so let's roll our own
+            unsigned long ShortestPathsGenerator<T>::getNumberOfComputedPaths() const {
+                return kShortestPaths.size();
+            }
 
+            template <typename T>
+            std::vector<state_t> ShortestPathsGenerator<T>::performDijkstra() {
+                // distances are probabilities, thus they are multiplied and larger is better
                 T inftyDistance = zero<T>();
                 T zeroDistance = one<T>();
                 shortestPathDistances.resize(numStates, inftyDistance);
                 shortestPathPredecessors.resize(numStates, boost::optional<state_t>());
 
-                // set serves as priority queue with unique membership
-                // default comparison on pair actually works fine if distance is the first entry
-                std::set<std::pair<T, state_t>, std::greater<std::pair<T, state_t>>> dijkstraQueue;
+                // states may be queued several times, only the first (i.e., best) occurrence is settled
+                std::priority_queue<std::pair<T, state_t>> dijkstraQueue;
+                BitVector settledStates(numStates, false);
+                std::vector<state_t> settleOrder;
 
                 for (state_t initialState : initialStates) {
                     shortestPathDistances[initialState] = zeroDistance;
                     dijkstraQueue.emplace(zeroDistance, initialState);
                 }
 
+                auto relax = [&] (state_t currentNode, state_t otherNode, T const& edgeDistance) {
+                    T alternateDistance = shortestPathDistances[currentNode] * edgeDistance;
+                    assert((zero<T>() <= alternateDistance) && (alternateDistance <= one<T>()));
+                    if (alternateDistance > shortestPathDistances[otherNode]) {
+                        shortestPathDistances[otherNode] = alternateDistance;
+                        shortestPathPredecessors[otherNode] = boost::optional<state_t>(currentNode);
+                        dijkstraQueue.emplace(alternateDistance, otherNode);
+                    }
+                };
+
                 while (!dijkstraQueue.empty()) {
-                    state_t currentNode = (*dijkstraQueue.begin()).second;
-                    dijkstraQueue.erase(dijkstraQueue.begin());
+                    state_t currentNode = dijkstraQueue.top().second;
+                    dijkstraQueue.pop();
+                    if (settledStates.get(currentNode)) {
+                        continue;
+                    }
+                    settledStates.set(currentNode, true);
+                    settleOrder.push_back(currentNode);
 
-                    if (!isMetaTargetPredecessor(currentNode)) {
+                    if (currentNode == metaTarget) {
+                        continue;
+                    } else if (!isMetaTargetPredecessor(currentNode)) {
                         // non-target node, treated normally
-                        for (auto const& transition : transitionMatrix.getRowGroup(currentNode)) {
-                            state_t otherNode = transition.getColumn();
-
-                            // note that distances are probabilities, thus they are multiplied and larger is better
-                            T alternateDistance = shortestPathDistances[currentNode] * convertDistance(currentNode, otherNode, transition.getValue());
-                            assert((zero<T>() <= alternateDistance) && (alternateDistance <= one<T>()));
-                            if (alternateDistance > shortestPathDistances[otherNode]) {
-                                shortestPathDistances[otherNode] = alternateDistance;
-                                shortestPathPredecessors[otherNode] = boost::optional<state_t>(currentNode);
-                                dijkstraQueue.emplace(alternateDistance, otherNode);
-                            }
+                        for (auto const& transition : transitionMatrix.getRow(currentNode)) {
+                            relax(currentNode, transition.getColumn(), convertDistance(currentNode, transition.getColumn(), transition.getValue()));
                         }
                     } else {
                         // node only has one "virtual edge" (with prob as per targetProbMap) to meta-target
-                        T alternateDistance = shortestPathDistances[currentNode] * targetProbMap[currentNode];
-                        if (alternateDistance > shortestPathDistances[metaTarget]) {
-                            shortestPathDistances[metaTarget] = alternateDistance;
-                            shortestPathPredecessors[metaTarget] = boost::optional<state_t>(currentNode);
-                        }
-                        // no need to enqueue meta-target
+                        relax(currentNode, metaTarget, targetProbMap[currentNode]);
                     }
                 }
+
+                return settleOrder;
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::computeSPSuccessors() {
-                shortestPathSuccessors.resize(numStates);
+            template <typename FunctionType>
+            void ShortestPathsGenerator<T>::forEachSidetrack(FunctionType const& function) const {
+                auto processEdge = [&] (state_t tailNode, state_t headNode, T const& edgeDistance) {
+                    if (edgeDistance > zero<T>() && shortestPathPredecessors[headNode] != boost::optional<state_t>(tailNode)) {
+                        function(tailNode, headNode, shortestPathDistances[tailNode] * edgeDistance / shortestPathDistances[headNode]);
+                    }
+                };
 
-                for (state_t i = 0; i < numStates; i++) {
-                    if (shortestPathPredecessors[i]) {
-                        state_t predecessor = shortestPathPredecessors[i].get();
-                        shortestPathSuccessors[predecessor].push_back(i);
+                for (state_t tailNode = 0; tailNode < numStates - 1; ++tailNode) {
+                    if (shortestPathDistances[tailNode] == zero<T>()) {
+                        continue;
+                    }
+                    // to avoid non-minimal paths, the meta-target-predecessors only have the edge to the meta-target
+                    auto targetProbIt = targetProbMap.find(tailNode);
+                    if (targetProbIt != targetProbMap.end()) {
+                        processEdge(tailNode, metaTarget, targetProbIt->second);
+                    } else {
+                        for (auto const& transition : transitionMatrix.getRow(tailNode)) {
+                            processEdge(tailNode, transition.getColumn(), convertDistance(tailNode, transition.getColumn(), transition.getValue()));
+                        }
                     }
                 }
             }
 
             template <typename T>
-            void ShortestPathsGenerator<T>::initializeShortestPaths() {
-                kShortestPaths.resize(numStates);
-
-                // BFS in Dijkstra-SP order
-                std::queue<state_t> bfsQueue;
-                for (state_t initialState : initialStates) {
-                    bfsQueue.push(initialState);
+            void ShortestPathsGenerator<T>::buildSidetrackHeaps(std::vector<state_t> const& settleOrder) {
+                // bucket the sidetracks by their head
+                std::vector<uint_fast64_t> sidetrackStarts(numStates + 1, 0);
+                forEachSidetrack([&] (state_t, state_t headNode, T const&) {
+                    ++sidetrackStarts[headNode + 1];
+                });
+                for (state_t node = 0; node < numStates; ++node) {
+                    sidetrackStarts[node + 1] += sidetrackStarts[node];
                 }
-
-                while (!bfsQueue.empty()) {
-                    state_t currentNode = bfsQueue.front();
-                    bfsQueue.pop();
-
-                    if (!kShortestPaths[currentNode].empty()) {
-                        continue; // already visited
-                    }
-
-                    for (state_t successorNode : shortestPathSuccessors[currentNode]) {
-                        bfsQueue.push(successorNode);
+                heapNodes.resize(sidetrackStarts.back());
+                std::vector<uint_fast64_t> nextPositions(sidetrackStarts.begin(), sidetrackStarts.end() - 1);
+                forEachSidetrack([&] (state_t tailNode, state_t headNode, T const& delta) {
+                    heapNodes[nextPositions[headNode]++] = SidetrackHeapNode<T> {tailNode, headNode, delta, noIndex, noIndex, 1};
+                });
+
+                // the sidetracks into a state, sorted by delta, form a (degenerated) heap by themselves
+                for (state_t node = 0; node < numStates; ++node) {
+                    auto begin = heapNodes.begin() + sidetrackStarts[node];
+                    auto end = heapNodes.begin() + sidetrackStarts[node + 1];
+                    std::sort(begin, end, [] (SidetrackHeapNode<T> const& first, SidetrackHeapNode<T> const& second) { return first.delta > second.delta; });
+                    for (uint_fast64_t index = sidetrackStarts[node]; index + 1 < sidetrackStarts[node + 1]; ++index) {
+                        heapNodes[index].left = index + 1;
                     }
+                }
 
-                    // note that `shortestPathPredecessor` may not be present
-                    // if current node is an initial state
-                    // in this case, the boost::optional copy of an uninitialized optional is hopefully also uninitialized
-                    kShortestPaths[currentNode].push_back(Path<T> {
-                            shortestPathPredecessors[currentNode],
-                            1,
-                            shortestPathDistances[currentNode]
-                    });
+                // the heap of a state additionally holds the sidetracks of all its predecessors in the shortest path tree,
+                // as predecessors are settled first, their heaps are already complete
+                sidetrackHeaps.resize(numStates, noIndex);
+                for (state_t node : settleOrder) {
+                    uint_fast64_t ownHeap = sidetrackStarts[node] < sidetrackStarts[node + 1] ? sidetrackStarts[node] : noIndex;
+                    uint_fast64_t predecessorHeap = shortestPathPredecessors[node] ? sidetrackHeaps[shortestPathPredecessors[node].get()] : noIndex;
+                    sidetrackHeaps[node] = mergeHeaps(ownHeap, predecessorHeap);
                 }
             }
 
             template <typename T>
-            T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode) const {
-                // just to be clear, head is where the arrow points (obviously)
-                if (headNode != metaTarget) {
-                    // edge is "normal", not to meta-target
-
-                    for (auto const& transition : transitionMatrix.getRowGroup(tailNode)) {
-                        if (transition.getColumn() == headNode) {
-                            return convertDistance(tailNode, headNode, transition.getValue());
-                        }
-                    }
+            uint_fast64_t ShortestPathsGenerator<T>::mergeHeaps(uint_fast64_t first, uint_fast64_t second) {
+                if (first == noIndex) {
+                    return second;
+                }
+                if (second == noIndex) {
+                    return first;
+                }
+                if (heapNodes[second].delta > heapNodes[first].delta) {
+                    std::swap(first, second);
+                }
 
-                    // there is no such edge
-                    // let's disallow that for now, because I'm not expecting it to happen
-                    assert(false);
-                    return zero<T>();
-                } else {
-                    // edge must be "virtual edge" to meta-target
-                    assert(isMetaTargetPredecessor(tailNode));
-                    return targetProbMap.at(tailNode);
+                // copy the root with the larger delta and merge the other heap into its right subtree
+                SidetrackHeapNode<T> root = heapNodes[first];
+                root.right = mergeHeaps(root.right, second);
+                uint_fast64_t leftRank = root.left == noIndex ? 0 : heapNodes[root.left].rank;
+                uint_fast64_t rightRank = heapNodes[root.right].rank;
+                if (leftRank < rightRank) {
+                    std::swap(root.left, root.right);
+                    std::swap(leftRank, rightRank);
                 }
+                root.rank = rightRank + 1;
+                heapNodes.push_back(root);
+                return heapNodes.size() - 1;
             }
 
-
             template <typename T>
-            void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
-                assert(k >= 2); // Dijkstra is used for k=1
-                assert(kShortestPaths[node].size() == k - 1); // if not, the previous SP must not exist
-
-                // TODO: I could extract the candidate generation to make this function more succinct
-                if (k == 2) {
-                    // Step B.1 in J&M paper
-
-                    Path<T> shortestPathToNode = kShortestPaths[node][1 - 1]; // never forget index shift :-|
-
-                    for (state_t predecessor : graphPredecessors[node]) {
-                        // add shortest paths to predecessors plus edge to current node
-                        Path<T> pathToPredecessorPlusEdge = {
-                            boost::optional<state_t>(predecessor),
-                            1,
-                            shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)
-                        };
-                        candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
-                        // ... but not the actual shortest path
-                        auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-                        if (it != candidatePaths[node].end()) {
-                            candidatePaths[node].erase(it);
+            void ShortestPathsGenerator<T>::addCandidatePaths(uint_fast64_t pathIndex) {
+                Path<T> const path = kShortestPaths[pathIndex];
+
+                if (path.sidetrack != noIndex) {
+                    // replace the last sidetrack by one of its children in the heap
+                    T prefixDistance = kShortestPaths[path.prefix].distance;
+                    for (uint_fast64_t child : {heapNodes[path.sidetrack].left, heapNodes[path.sidetrack].right}) {
+                        if (child != noIndex) {
+                            candidatePaths.push(Path<T> {child, path.prefix, prefixDistance * heapNodes[child].delta});
                         }
                     }
                 }
 
-                if (not (k == 2 && isInitialState(node))) {
-                    // Steps B.2-5 in J&M paper
-
-                    // the (k-1)th shortest path (i.e., one better than the one we want to compute)
-                    Path<T> previousShortestPath = kShortestPaths[node][k - 1 - 1]; // oh god, I forgot index shift AGAIN
-
-                    // the predecessor node on that path
-                    state_t predecessor = previousShortestPath.predecessorNode.get();
-                    // the path to that predecessor was the `tailK`-shortest
-                    unsigned long tailK = previousShortestPath.predecessorK;
-
-                    // i.e. source ~~tailK-shortest path~~> predecessor --> node
-
-                    // compute one-worse-shortest path to the predecessor (if it hasn't yet been computed)
-                    if (kShortestPaths[predecessor].size() < tailK + 1) {
-                        // TODO: investigate recursion depth and possible iterative alternative
-                        computeNextPath(predecessor, tailK + 1);
-                    }
-
-                    if (kShortestPaths[predecessor].size() >= tailK + 1) {
-                        // take that path, add an edge to the current node; that's a candidate
-                        Path<T> pathToPredecessorPlusEdge = {
-                                boost::optional<state_t>(predecessor),
-                                tailK + 1,
-                                kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)
-                        };
-                        candidatePaths[node].insert(pathToPredecessorPlusEdge);
-                    }
-                    // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
-                }
-
-                // Step B.6 in J&M paper
-                if (!candidatePaths[node].empty()) {
-                    Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-                    for (auto path : candidatePaths[node]) {
-                        if (path.distance > minDistanceCandidate.distance) {
-                            minDistanceCandidate = path;
-                        }
-                    }
-
-                    candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-                    kShortestPaths[node].push_back(minDistanceCandidate);
-                } else {
-                    // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
-                    STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
+                // append the best sidetrack that can be taken after the last one
+                state_t lastNode = path.sidetrack == noIndex ? metaTarget : heapNodes[path.sidetrack].tail;
+                uint_fast64_t heap = sidetrackHeaps[lastNode];
+                if (heap != noIndex) {
+                    candidatePaths.push(Path<T> {heap, pathIndex, path.distance * heapNodes[heap].delta});
                 }
             }
 
@@ -339,51 +311,22 @@ namespace storm {
                     throw std::invalid_argument("Index 0 is invalid, since we use 1-based indices (sorry)!");
                 }
 
-                unsigned long alreadyComputedK = kShortestPaths[metaTarget].size();
-
-                for (unsigned long nextK = alreadyComputedK + 1; nextK <= k; nextK++) {
-                    computeNextPath(metaTarget, nextK);
-                    if (kShortestPaths[metaTarget].size() < nextK) {
-                        unsigned long lastExistingK = nextK - 1;
-                        STORM_LOG_DEBUG("KSP throws (as expected) due to nonexistence -- maybe this is unhandled and causes the Python interface to segfault?");
-                        STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(lastExistingK));
-                        STORM_LOG_DEBUG("maybe this is unhandled and causes the Python interface to segfault?");
+                while (kShortestPaths.size() < k) {
+                    if (!computeNextPath()) {
+                        STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(kShortestPaths.size()));
                         throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
                     }
                 }
             }
 
-            template <typename T>
-            void ShortestPathsGenerator<T>::printKShortestPath(state_t targetNode, unsigned long k, bool head) const {
-                // note the index shift! risk of off-by-one
-                Path<T> p = kShortestPaths[targetNode][k - 1];
-
-                if (head) {
-                    std::cout << "Path (reversed";
-                    if (targetNode == metaTarget) {
-                        std::cout << ", w/ meta-target";
-                    }
-                    std::cout <<"), dist (prob)=" << p.distance << ": [";
-                }
-
-                std::cout << " " << targetNode;
-
-                if (p.predecessorNode) {
-                    printKShortestPath(p.predecessorNode.get(), p.predecessorK, false);
-                } else {
-                    std::cout << " ]" << std::endl;
-                }
-            }
-
 
             template class ShortestPathsGenerator<double>;
 
             // only prints the info stored in the Path struct;
-            // does not traverse the actual path (see printKShortestPath for that)
+            // does not traverse the actual path (see getPathAsList for that)
             template <typename T>
             std::ostream& operator<<(std::ostream& out, Path<T> const& p) {
-                out << "Path with predecessorNode: " << ((p.predecessorNode) ? std::to_string(p.predecessorNode.get()) : "None");
-                out << " predecessorK: " << p.predecessorK << " distance: " << p.distance;
+                out << "Path with sidetrack: " << p.sidetrack << " prefix: " << p.prefix << " distance: " << p.distance;
                 return out;
             }
             template std::ostream& operator<<(std::ostream& out, Path<double> const& p);
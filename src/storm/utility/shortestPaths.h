@@ -1,7 +1,8 @@
 #ifndef STORM_UTIL_SHORTESTPATHS_H_
 #define STORM_UTIL_SHORTESTPATHS_H_
 
-#include <unordered_set>
+#include <queue>
+#include <unordered_map>
 #include <vector>
 #include <boost/optional/optional.hpp>
 
@@ -36,23 +37,30 @@ namespace storm {
 
             // -- helper structs/classes -----------------------------------------------------------------------------
 
+            /*!
+             * A node of a (persistent, leftist) heap of sidetracks. A sidetrack is an edge `tail -> head` that is not
+             * part of the shortest path tree. Its `delta` is the factor by which the distance of a path decreases
+             * when the sidetrack is taken instead of the tree edge into `head`.
+             */
+            template <typename T>
+            struct SidetrackHeapNode {
+                state_t tail;
+                state_t head;
+                T delta;
+                uint_fast64_t left;
+                uint_fast64_t right;
+                uint_fast64_t rank;
+            };
+
+            /*!
+             * An implicit representation of a path. The path takes the given sidetrack after the sidetracks of
+             * the prefix path; the shortest path has no sidetrack at all.
+             */
             template <typename T>
             struct Path {
-                boost::optional<state_t> predecessorNode;
-                unsigned long predecessorK;
+                uint_fast64_t sidetrack;
+                uint_fast64_t prefix;
                 T distance;
-
-                // arbitrary order for std::set
-                bool operator<(const Path<T>& rhs) const {
-                    if (predecessorNode != rhs.predecessorNode) {
-                        return predecessorNode < rhs.predecessorNode;
-                    }
-                    return predecessorK < predecessorK;
-                }
-
-                bool operator==(const Path<T>& rhs) const {
-                    return (predecessorNode == rhs.predecessorNode) && (predecessorK == rhs.predecessorK);
-                }
             };
 
             template <typename T>
@@ -65,6 +73,12 @@ namespace storm {
 
             // -------------------------------------------------------------------------------------------------------
 
+            /*!
+             * Enumerates the paths from the initial states to the target states in order of decreasing probability
+             * (i.e., the k-shortest paths). The paths are enumerated with Eppstein's algorithm: after a single Dijkstra
+             * run, every path is represented implicitly by its last sidetrack and its prefix path, such that each
+             * enumerated path only takes constant space. The states of a path are only materialized on request.
+             */
             template <typename T>
             class ShortestPathsGenerator {
             public:
@@ -73,8 +87,8 @@ namespace storm {
                 using Model = models::sparse::Model<T, models::sparse::StandardRewardModel<T>>;
 
                 /*!
-                 * Performs precomputations (including meta-target insertion and Dijkstra).
-                 * Modifications are done locally, `model` remains unchanged.
+                 * Performs precomputations (including meta-target insertion, Dijkstra and the construction of the
+                 * sidetrack heaps). Modifications are done locally, `model` remains unchanged.
                  * Target (group) cannot be changed.
                  */
                 ShortestPathsGenerator(Model const& model, BitVector const& targetBV);
@@ -116,8 +130,28 @@ namespace storm {
                  */
                 OrderedStateList getPathAsList(unsigned long k);
 
+                /*!
+                 * Computes the next path, i.e., the (n+1)-shortest path if n paths have been computed so far. This allows
+                 * to stream the paths in order without fixing k in advance.
+                 * @return False iff no further path exists.
+                 */
+                bool computeNextPath();
+
+                /*!
+                 * Returns the number of paths that have been computed so far.
+                 */
+                unsigned long getNumberOfComputedPaths() const;
+
 
             private:
+                struct PathDistanceComparator {
+                    bool operator()(Path<T> const& first, Path<T> const& second) const {
+                        return first.distance < second.distance;
+                    }
+                };
+
+                static const uint_fast64_t noIndex;
+
                 Matrix const& transitionMatrix;
                 state_t numStates; // includes meta-target, i.e. states in model + 1
                 state_t metaTarget;
@@ -126,47 +160,42 @@ namespace storm {
 
                 MatrixFormat matrixFormat;
 
-                std::vector<OrderedStateList>         graphPredecessors;
                 std::vector<boost::optional<state_t>> shortestPathPredecessors;
-                std::vector<OrderedStateList>         shortestPathSuccessors;
                 std::vector<T>                        shortestPathDistances;
 
-                std::vector<std::vector<Path<T>>> kShortestPaths;
-                std::vector<std::set<Path<T>>>    candidatePaths;
+                // the nodes of all sidetrack heaps and the root of the heap of each state, which holds the
+                // sidetracks into the state and all its predecessors in the shortest path tree
+                std::vector<SidetrackHeapNode<T>> heapNodes;
+                std::vector<uint_fast64_t>        sidetrackHeaps;
 
-                /*!
-                 * Computes list of predecessors for all nodes.
-                 * Reachability is not considered; a predecessor is simply any node that has an edge leading to the node in question.
-                 * Requires `transitionMatrix`.
-                 * Modifies `graphPredecessors`.
-                 */
-                void computePredecessors();
+                // the paths computed so far (the k-shortest path is at index k-1) and the candidates for the next path
+                std::vector<Path<T>> kShortestPaths;
+                std::priority_queue<Path<T>, std::vector<Path<T>>, PathDistanceComparator> candidatePaths;
 
                 /*!
                  * Computes shortest path distances and predecessors.
-                 * Requires `model`, `numStates`, `transitionMatrix`.
+                 * Requires `numStates`, `transitionMatrix`.
                  * Modifies `shortestPathPredecessors` and `shortestPathDistances`.
+                 * @return The states in the order in which they were settled.
                  */
-                void performDijkstra();
+                std::vector<state_t> performDijkstra();
 
                 /*!
-                 * Computes list of shortest path successor nodes from predecessor list.
-                 * Requires `shortestPathPredecessors`, `numStates`.
-                 * Modifies `shortestPathSuccessors`.
+                 * Builds the heap of sidetracks for each state reachable from the initial states.
+                 * Requires `shortestPathPredecessors`, `shortestPathDistances`.
+                 * Modifies `heapNodes` and `sidetrackHeaps`.
                  */
-                void computeSPSuccessors();
+                void buildSidetrackHeaps(std::vector<state_t> const& settleOrder);
 
                 /*!
-                 * Constructs and stores the implicit shortest path representations (see `Path`) for the (1-)shortest paths.
-                 * Requires `shortestPathPredecessors`, `shortestPathDistances`, `model`, `numStates`.
-                 * Modifies `kShortestPaths`.
+                 * Merges the two heaps without modifying them (by copying the nodes on the merge path).
                  */
-                void initializeShortestPaths();
+                uint_fast64_t mergeHeaps(uint_fast64_t first, uint_fast64_t second);
 
                 /*!
-                 * Main step of REA algorithm. TODO: Document further.
+                 * Adds the successors of the given path in the path graph as candidates.
                  */
-                void computeNextPath(state_t node, unsigned long k);
+                void addCandidatePaths(uint_fast64_t pathIndex);
 
                 /*!
                  * Computes k-shortest path if not yet computed.
@@ -175,22 +204,14 @@ namespace storm {
                 void computeKSP(unsigned long k);
 
                 /*!
-                 * Recurses over the path and prints the nodes. Intended for debugging.
-                 */
-                void printKShortestPath(state_t targetNode, unsigned long k, bool head=true) const;
-
-                /*!
-                 * Returns actual distance for real edges, 1 for edges to meta-target.
+                 * Calls the given function for each edge that is not part of the shortest path tree and whose tail is reachable.
                  */
-                T getEdgeDistance(state_t tailNode, state_t headNode) const;
+                template <typename FunctionType>
+                void forEachSidetrack(FunctionType const& function) const;
 
 
                 // --- tiny helper fcts ---
 
-                inline bool isInitialState(state_t node) const {
-                    return find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
-                }
-
                 inline bool isMetaTargetPredecessor(state_t node) const {
                     return targetProbMap.count(node) == 1;
                 }
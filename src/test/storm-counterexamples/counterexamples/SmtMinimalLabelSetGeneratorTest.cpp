@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_Z3
+
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/properties.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+TEST(SmtMinimalLabelSetGeneratorTest, PortfolioYieldsSameLabelSet) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P<=0.01 [F \"two\"]", program));
+    
+    storm::generator::NextStateGeneratorOptions builderOptions(formulas);
+    builderOptions.setBuildChoiceOrigins(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, builderOptions).build();
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::Mdp));
+    
+    storm::Environment env;
+    typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+    Generator::Options options(true);
+    options.silent = true;
+    
+    Generator::GeneratorStats sequentialStats;
+    options.portfolioSize = 1;
+    std::vector<boost::container::flat_set<uint_fast64_t>> sequentialResult = Generator::computeCounterexampleLabelSet(env, sequentialStats, program, *model, formulas.front(), {}, options);
+    ASSERT_EQ(1ul, sequentialResult.size());
+    
+    // All strategies of the portfolio search for a label set of minimal size, which is unique here.
+    Generator::GeneratorStats portfolioStats;
+    options.portfolioSize = 4;
+    std::vector<boost::container::flat_set<uint_fast64_t>> portfolioResult = Generator::computeCounterexampleLabelSet(env, portfolioStats, program, *model, formulas.front(), {}, options);
+    ASSERT_EQ(1ul, portfolioResult.size());
+    EXPECT_EQ(sequentialResult.front(), portfolioResult.front());
+}
+
+#endif
@@ -0,0 +1,10 @@
+#include "gtest/gtest.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
+
+int main(int argc, char **argv) {
+  storm::settings::initializeAll("Storm-counterexamples (Functional) Testing Suite", "test-counterexamples");
+  storm::settings::addModule<storm::settings::modules::CounterexampleGeneratorSettings>();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
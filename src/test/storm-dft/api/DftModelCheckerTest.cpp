@@ -1,8 +1,13 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
 
+#include <cmath>
+
 #include "storm-dft/api/storm-dft.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 
 namespace {
 
@@ -70,6 +75,24 @@ namespace {
             return boost::get<double>(results[0]);
         }
 
+        std::vector<double> analyzeReliability(std::string const& file, std::vector<double> const& timepoints) {
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileo<double>(file);
+            std::string property;
+            for (auto const& timepoint : timepoints) {
+                if (!property.empty()) {
+                    property += ";";
+                }
+                property += "P=? [F<=" + std::to_string(timepoint) + " \"failed\"]";
+            }
+            std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, config.useMod, config.useDC, false);
+            std::vector<double> values;
+            for (auto const& result : results) {
+                values.push_back(boost::get<double>(result));
+            }
+            return values;
+        }
+
     private:
         DftAnalysisConfig config;
     };
@@ -105,6 +128,21 @@ namespace {
         EXPECT_FLOAT_EQ(result, 5/6.0);
     }
 
+    TYPED_TEST(DftModelCheckerTest, AndOrReliability) {
+        std::vector<double> timepoints = {0.5, 1, 2};
+        std::vector<double> result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/and.dft", timepoints);
+        ASSERT_EQ(timepoints.size(), result.size());
+        for (size_t i = 0; i < timepoints.size(); ++i) {
+            double failureProbability = 1 - std::exp(-0.5 * timepoints[i]);
+            EXPECT_NEAR(failureProbability * failureProbability, result[i], 1e-6);
+        }
+        result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/or.dft", timepoints);
+        ASSERT_EQ(timepoints.size(), result.size());
+        for (size_t i = 0; i < timepoints.size(); ++i) {
+            EXPECT_NEAR(1 - std::exp(-timepoints[i]), result[i], 1e-6);
+        }
+    }
+
     TYPED_TEST(DftModelCheckerTest, PandMTTF) {
         double result = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/pand.dft");
         EXPECT_EQ(result, storm::utility::infinity<double>());
@@ -183,4 +221,29 @@ namespace {
         EXPECT_EQ(result, storm::utility::infinity<double>());
     }
 
+    std::vector<double> analyzeModularReliability(std::string const& file, std::string const& property, uint_fast64_t numberOfModuleThreads) {
+        storm::settings::modules::FaultTreeSettings& faultTreeSettings = dynamic_cast<storm::settings::modules::FaultTreeSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::FaultTreeSettings::moduleName));
+        std::unique_ptr<storm::settings::SettingMemento> moduleThreadsMemento = faultTreeSettings.overrideNumberOfModuleThreads(numberOfModuleThreads);
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileo<double>(file);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, false, true, false, false);
+        std::vector<double> values;
+        for (auto const& result : results) {
+            values.push_back(boost::get<double>(result));
+        }
+        return values;
+    }
+
+    TEST(DftModuleThreadsTest, VotingReliability) {
+        // The top level 2of3 gate is split into three modules which are checked by three threads.
+        std::string property = "P=? [F<=0.5 \"failed\"]; P=? [F<=1 \"failed\"]; P=? [F<=2 \"failed\"]";
+        std::vector<double> sequential = analyzeModularReliability(STORM_TEST_RESOURCES_DIR "/dft/voting3.dft", property, 1);
+        std::vector<double> concurrent = analyzeModularReliability(STORM_TEST_RESOURCES_DIR "/dft/voting3.dft", property, 3);
+        ASSERT_EQ(3ul, sequential.size());
+        ASSERT_EQ(sequential.size(), concurrent.size());
+        for (size_t i = 0; i < sequential.size(); ++i) {
+            EXPECT_EQ(sequential[i], concurrent[i]);
+        }
+    }
+
 }
@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+
+namespace {
+
+    // Builds the complete model of the given DFT (with merged failed states).
+    std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& file, bool useSymmetries) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileo<double>(file);
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        if (useSymmetries) {
+            symmetries = dft->findSymmetries(dft->colourDFT());
+        }
+        storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries, true);
+        typename storm::builder::ExplicitDFTModelBuilder<double>::LabelOptions labeloptions({});
+        builder.buildModel(labeloptions, 0, 0.0);
+        return builder.getModel();
+    }
+
+}
+
+TEST(ExplicitDFTModelBuilderTest, StateSpaceSize) {
+    // The merged failed state has a self-loop
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/and.dft", false);
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+
+    model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/or.dft", false);
+    EXPECT_EQ(2ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getNumberOfTransitions());
+
+    model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/voting.dft", false);
+    EXPECT_EQ(2ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getNumberOfTransitions());
+
+    // The failsafe state has a self-loop
+    model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/pand.dft", false);
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+
+    // The failure of C before B is invalid
+    model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/seq.dft", false);
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(3ul, model->getNumberOfTransitions());
+
+    model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/spare.dft", false);
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+}
+
+TEST(ExplicitDFTModelBuilderTest, StateSpaceSizeWithSymmetries) {
+    // The failures of B and C lead to the same (pseudo) state
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/dft/and.dft", true);
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(3ul, model->getNumberOfTransitions());
+}
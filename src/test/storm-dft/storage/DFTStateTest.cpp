@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/storage/dft/DFTState.h"
+
+TEST(DFTStateTest, Reconstruct) {
+    std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileo<double>(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::storage::DFTStateGenerationInfo stateGenerationInfo = dft->buildStateGenerationInfo(symmetries);
+
+    storm::storage::DFTState<double> initialState(*dft, stateGenerationInfo, 0);
+    EXPECT_EQ(2ul, initialState.nrFailableBEs());
+    EXPECT_TRUE(initialState.isReconstructible());
+
+    // The remaining BE is failable in the successor
+    std::shared_ptr<storm::storage::DFTState<double>> successor = initialState.copy();
+    successor->letNextBEFail(0);
+    EXPECT_EQ(1ul, successor->nrFailableBEs());
+    EXPECT_TRUE(successor->isReconstructible());
+
+    storm::storage::DFTState<double> reconstructed(successor->status(), *dft, stateGenerationInfo, 1);
+    reconstructed.construct();
+    EXPECT_EQ(1ul, reconstructed.nrFailableBEs());
+    EXPECT_EQ(successor->getFailableBERate(0), reconstructed.getFailableBERate(0));
+}
+
+TEST(DFTStateTest, ReconstructResolvedDependency) {
+    std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileo<double>(STORM_TEST_RESOURCES_DIR "/dft/pdep.dft");
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::storage::DFTStateGenerationInfo stateGenerationInfo = dft->buildStateGenerationInfo(symmetries);
+    storm::storage::DFTState<double> initialState(*dft, stateGenerationInfo, 0);
+
+    // Let the trigger MA of the PDEP fail
+    std::shared_ptr<storm::storage::DFTState<double>> state;
+    size_t triggerId = 0;
+    for (size_t index = 0; index < initialState.nrFailableBEs(); ++index) {
+        std::shared_ptr<storm::storage::DFTState<double>> successor = initialState.copy();
+        auto nextBE = successor->letNextBEFail(index).first;
+        if (nextBE->name() == "MA") {
+            state = successor;
+            triggerId = nextBE->id();
+        }
+    }
+    ASSERT_TRUE(state);
+    EXPECT_TRUE(state->updateFailableDependencies(triggerId));
+    EXPECT_EQ(1ul, state->nrFailableDependencies());
+
+    // The dependency is unsuccessful and must not be revived when constructing the state from its status
+    state->letDependencyBeUnsuccessful(0);
+    EXPECT_EQ(0ul, state->nrFailableDependencies());
+    storm::storage::DFTState<double> pseudoState(state->status(), *dft, stateGenerationInfo, 1);
+    pseudoState.construct();
+    EXPECT_EQ(0ul, pseudoState.nrFailableDependencies());
+    EXPECT_TRUE(state->isReconstructible());
+}
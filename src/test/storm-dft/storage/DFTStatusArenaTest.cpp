@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/storage/DFTStatusArena.h"
+
+TEST(DFTStatusArenaTest, StoreAndLoad) {
+    // Statuses spanning several words
+    storm::storage::DFTStatusArena arena(130);
+    storm::storage::BitVector first(130, {0, 63, 64, 129});
+    storm::storage::BitVector second(130, {1, 65, 127, 128});
+    storm::storage::BitVector empty(130);
+
+    uint64_t firstSlot = arena.store(first);
+    uint64_t secondSlot = arena.store(second);
+    uint64_t emptySlot = arena.store(empty);
+    EXPECT_EQ(3ul, arena.size());
+    EXPECT_NE(firstSlot, secondSlot);
+    EXPECT_NE(secondSlot, emptySlot);
+
+    EXPECT_EQ(first, arena.load(firstSlot));
+    EXPECT_EQ(second, arena.load(secondSlot));
+    EXPECT_EQ(empty, arena.load(emptySlot));
+
+    // Statuses smaller than a word
+    storm::storage::DFTStatusArena smallArena(5);
+    storm::storage::BitVector small(5, {0, 4});
+    uint64_t smallSlot = smallArena.store(small);
+    EXPECT_EQ(small, smallArena.load(smallSlot));
+    EXPECT_EQ(5ul, smallArena.load(smallSlot).size());
+}
+
+TEST(DFTStatusArenaTest, ReuseReleasedSlots) {
+    storm::storage::DFTStatusArena arena(70);
+    storm::storage::BitVector first(70, {2, 69});
+    storm::storage::BitVector second(70, {3, 68});
+    storm::storage::BitVector third(70, {0, 1, 64});
+
+    uint64_t firstSlot = arena.store(first);
+    uint64_t secondSlot = arena.store(second);
+    arena.release(firstSlot);
+    EXPECT_EQ(1ul, arena.size());
+
+    // The released slot is reused and the old content is overwritten completely
+    uint64_t thirdSlot = arena.store(third);
+    EXPECT_EQ(firstSlot, thirdSlot);
+    EXPECT_EQ(2ul, arena.size());
+    EXPECT_EQ(third, arena.load(thirdSlot));
+    EXPECT_EQ(second, arena.load(secondSlot));
+
+    // Without released slots, a new slot is used
+    uint64_t fourthSlot = arena.store(first);
+    EXPECT_NE(firstSlot, fourthSlot);
+    EXPECT_NE(secondSlot, fourthSlot);
+    EXPECT_EQ(3ul, arena.size());
+    EXPECT_EQ(first, arena.load(fourthSlot));
+
+    arena.release(secondSlot);
+    arena.release(thirdSlot);
+    arena.release(fourthSlot);
+    EXPECT_EQ(0ul, arena.size());
+}
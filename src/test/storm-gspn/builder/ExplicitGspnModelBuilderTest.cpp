@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parseFormulas(storm::gspn::GSPN const& gspn, std::string const& formulasString) {
+        storm::parser::FormulaParser formulaParser(gspn.getExpressionManager());
+        return storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulaParser, formulasString));
+    }
+
+    // Builds the (closed) Markov automaton of the GSPN via the translation to JANI. In contrast to the explicit builder,
+    // it contains a state for every reachable marking.
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildViaJani(storm::gspn::GSPN const& gspn, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+        std::unique_ptr<storm::jani::Model> janiModel(storm::api::buildJani(gspn));
+        janiModel->finalize();
+        auto model = storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(*janiModel), formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+        model->close();
+        return model;
+    }
+
+    template<typename ModelType>
+    double checkAtInitialState(std::shared_ptr<ModelType> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+        return result->asQuantitativeCheckResult<double>().getMin();
+    }
+
+}
+
+TEST(ExplicitGspnModelBuilderTest, TimedNet) {
+    // Three machines that fail and are repaired. All markings are tangible.
+    storm::gspn::GspnBuilder builder;
+    uint64_t up = builder.addPlace(3, 3, "up");
+    uint64_t down = builder.addPlace(3, 0, "down");
+    uint64_t fail = builder.addTimedTransition(0, 0.5, "fail");
+    uint64_t repair = builder.addTimedTransition(0, 1.0, "repair");
+    builder.addInputArc(up, fail);
+    builder.addOutputArc(fail, down);
+    builder.addInputArc(down, repair);
+    builder.addOutputArc(repair, up);
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto formulas = parseFormulas(*gspn, "T=? [F down=3]");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel(*gspn, formulas);
+    ASSERT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(6ul, model->getNumberOfTransitions());
+
+    auto janiModel = buildViaJani(*gspn, formulas);
+    ASSERT_TRUE(janiModel->isConvertibleToCtmc());
+    auto janiCtmc = janiModel->convertToCtmc();
+    EXPECT_EQ(janiCtmc->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(janiCtmc->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_NEAR(checkAtInitialState(janiCtmc, formulas[0]), checkAtInitialState(model, formulas[0]), 1e-6);
+}
+
+TEST(ExplicitGspnModelBuilderTest, NondeterministicImmediateChoice) {
+    // The token in 'start' is moved to either 'a' or 'b' by two immediate transitions without weight, which end up in
+    // different partitions and therefore constitute a nondeterministic choice.
+    storm::gspn::GspnBuilder builder;
+    uint64_t start = builder.addPlace(1, 1, "start");
+    uint64_t a = builder.addPlace(1, 0, "a");
+    uint64_t b = builder.addPlace(1, 0, "b");
+    uint64_t done = builder.addPlace(1, 0, "done");
+    uint64_t toA = builder.addImmediateTransition(0, 0, "toA");
+    uint64_t toB = builder.addImmediateTransition(0, 0, "toB");
+    uint64_t finishA = builder.addTimedTransition(0, 1.0, "finishA");
+    uint64_t finishB = builder.addTimedTransition(0, 2.0, "finishB");
+    builder.addInputArc(start, toA);
+    builder.addOutputArc(toA, a);
+    builder.addInputArc(start, toB);
+    builder.addOutputArc(toB, b);
+    builder.addInputArc(a, finishA);
+    builder.addOutputArc(finishA, done);
+    builder.addInputArc(b, finishB);
+    builder.addOutputArc(finishB, done);
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto formulas = parseFormulas(*gspn, "Tmin=? [F done=1]; Tmax=? [F done=1]");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel(*gspn, formulas);
+    ASSERT_EQ(storm::models::ModelType::MarkovAutomaton, model->getType());
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    // The initial marking resolves the choice and is kept, the deadlock in 'done' gets a self-loop.
+    EXPECT_EQ(4ul, ma->getNumberOfStates());
+    EXPECT_EQ(5ul, ma->getNumberOfChoices());
+    EXPECT_EQ(5ul, ma->getNumberOfTransitions());
+    EXPECT_EQ(3ul, ma->getMarkovianStates().getNumberOfSetBits());
+
+    auto janiModel = buildViaJani(*gspn, formulas);
+    EXPECT_EQ(janiModel->getNumberOfStates(), ma->getNumberOfStates());
+    EXPECT_EQ(janiModel->getNumberOfChoices(), ma->getNumberOfChoices());
+    EXPECT_EQ(janiModel->getNumberOfTransitions(), ma->getNumberOfTransitions());
+
+    EXPECT_NEAR(0.5, checkAtInitialState(ma, formulas[0]), 1e-6);
+    EXPECT_NEAR(checkAtInitialState(janiModel, formulas[0]), checkAtInitialState(ma, formulas[0]), 1e-6);
+    EXPECT_NEAR(1.0, checkAtInitialState(ma, formulas[1]), 1e-6);
+    EXPECT_NEAR(checkAtInitialState(janiModel, formulas[1]), checkAtInitialState(ma, formulas[1]), 1e-6);
+}
+
+TEST(ExplicitGspnModelBuilderTest, VanishingCycle) {
+    // The token moves between 'p' and 'q' by immediate transitions until it leaves 'q' towards 'r'. The cycle is broken
+    // by keeping the (initial) marking with a token in 'p' as a probabilistic state. The other vanishing marking is
+    // eliminated.
+    storm::gspn::GspnBuilder builder;
+    uint64_t p = builder.addPlace(1, 1, "p");
+    uint64_t q = builder.addPlace(1, 0, "q");
+    uint64_t r = builder.addPlace(1, 0, "r");
+    uint64_t s = builder.addPlace(1, 0, "s");
+    uint64_t pToQ = builder.addImmediateTransition(0, 1.0, "pToQ");
+    uint64_t qToP = builder.addImmediateTransition(0, 1.0, "qToP");
+    uint64_t qToR = builder.addImmediateTransition(0, 1.0, "qToR");
+    uint64_t rToS = builder.addTimedTransition(0, 2.0, "rToS");
+    uint64_t sToP = builder.addTimedTransition(0, 1.0, "sToP");
+    builder.addInputArc(p, pToQ);
+    builder.addOutputArc(pToQ, q);
+    builder.addInputArc(q, qToP);
+    builder.addOutputArc(qToP, p);
+    builder.addInputArc(q, qToR);
+    builder.addOutputArc(qToR, r);
+    builder.addInputArc(r, rToS);
+    builder.addOutputArc(rToS, s);
+    builder.addInputArc(s, sToP);
+    builder.addOutputArc(sToP, p);
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto formulas = parseFormulas(*gspn, "Tmin=? [F s=1]");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel(*gspn, formulas);
+    ASSERT_EQ(storm::models::ModelType::MarkovAutomaton, model->getType());
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(3ul, ma->getNumberOfStates());
+    EXPECT_EQ(4ul, ma->getNumberOfTransitions());
+    EXPECT_EQ(2ul, ma->getMarkovianStates().getNumberOfSetBits());
+
+    // The translation to JANI keeps both vanishing markings, the tangible markings coincide.
+    auto janiModel = buildViaJani(*gspn, formulas);
+    EXPECT_EQ(4ul, janiModel->getNumberOfStates());
+    EXPECT_EQ(janiModel->getMarkovianStates().getNumberOfSetBits(), ma->getMarkovianStates().getNumberOfSetBits());
+
+    EXPECT_NEAR(0.5, checkAtInitialState(ma, formulas[0]), 1e-6);
+    EXPECT_NEAR(checkAtInitialState(janiModel, formulas[0]), checkAtInitialState(ma, formulas[0]), 1e-6);
+}
+
+TEST(ExplicitGspnModelBuilderTest, CapacityViolation) {
+    // Tokens are produced without bound, so the default number of bits of a place without capacity is exceeded.
+    storm::gspn::GspnBuilder unboundedBuilder;
+    uint64_t unboundedPlace = unboundedBuilder.addPlace(boost::none, 0, "p");
+    uint64_t unboundedProduce = unboundedBuilder.addTimedTransition(0, 1.0, "produce");
+    unboundedBuilder.addOutputArc(unboundedProduce, unboundedPlace);
+    std::unique_ptr<storm::gspn::GSPN> unboundedGspn(unboundedBuilder.buildGspn());
+    EXPECT_THROW(storm::api::buildSparseModel(*unboundedGspn, {}), storm::exceptions::WrongFormatException);
+
+    // The same for a place whose capacity is given.
+    storm::gspn::GspnBuilder boundedBuilder;
+    uint64_t boundedPlace = boundedBuilder.addPlace(2, 0, "p");
+    uint64_t boundedProduce = boundedBuilder.addTimedTransition(0, 1.0, "produce");
+    boundedBuilder.addOutputArc(boundedProduce, boundedPlace);
+    std::unique_ptr<storm::gspn::GSPN> boundedGspn(boundedBuilder.buildGspn());
+    EXPECT_THROW(storm::api::buildSparseModel(*boundedGspn, {}), storm::exceptions::WrongFormatException);
+}
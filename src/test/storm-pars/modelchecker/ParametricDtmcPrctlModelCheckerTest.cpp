@@ -11,8 +11,12 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/api/builder.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcBatchInstantiationModelChecker.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
 namespace {
     
     class EigenEnvironment {
@@ -103,4 +107,54 @@ namespace {
         
         EXPECT_EQ(this->parseNumber("11/3"), quantitativeResult4[0].evaluate(instantiation));
     }
+    
+    TEST(ParametricDtmcBatchInstantiationTest, Die) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllLabels().setBuildAllRewardModels();
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+        storm::parser::FormulaParser formulaParser(expManager);
+        
+        std::set<storm::RationalFunctionVariable> variables = storm::models::sparse::getProbabilityParameters(*dtmc);
+        ASSERT_EQ(variables.size(), 1ull);
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+        for (std::string const& value : {"1/4", "1/2", "3/4"}) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(*variables.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+            valuations.push_back(valuation);
+        }
+        
+        storm::Environment env;
+        storm::modelchecker::SparseDtmcBatchInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*dtmc);
+        batchChecker.setInstantiationsAreGraphPreserving(true);
+        
+        for (std::string const& formulaString : {"P=? [F \"one\"]", "R=? [F \"done\"]"}) {
+            std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+            batchChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formula, true));
+            checker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formula, true));
+            ASSERT_TRUE(batchChecker.canHandleSpecifiedFormula());
+            
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = batchChecker.checkBatch(env, valuations);
+            ASSERT_EQ(valuations.size(), results.size());
+            for (uint64_t i = 0; i < valuations.size(); ++i) {
+                std::unique_ptr<storm::modelchecker::CheckResult> expected = checker.check(env, valuations[i]);
+                EXPECT_NEAR(expected->asExplicitQuantitativeCheckResult<double>()[*dtmc->getInitialStates().begin()], results[i]->asExplicitQuantitativeCheckResult<double>()[*dtmc->getInitialStates().begin()], 1e-6);
+                
+                // Instantiations that converge early keep their values, so the result does not depend on the batch.
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> singleResult = batchChecker.checkBatch(env, {valuations[i]});
+                EXPECT_EQ(singleResult.front()->asExplicitQuantitativeCheckResult<double>().getValueVector(), results[i]->asExplicitQuantitativeCheckResult<double>().getValueVector());
+            }
+        }
+        
+        // Only power iteration is supported.
+        storm::Environment jacobiEnv;
+        jacobiEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        EXPECT_THROW(batchChecker.checkBatch(jacobiEnv, valuations), storm::exceptions::NotSupportedException);
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> result = batchChecker.check(env, valuations[1]);
+        EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[*dtmc->getInitialStates().begin()], 1e-6);
+    }
 }
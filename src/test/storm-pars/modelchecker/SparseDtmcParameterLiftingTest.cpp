@@ -95,6 +95,41 @@ namespace {
     
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+        
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> additionalCheckers;
+        for (uint64_t i = 0; i < 3; ++i) {
+            additionalCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+        
+        //start testing
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.2<=pK<=0.95", modelParameters);
+        
+        // With a depth limit and no coverage threshold, the same subregions are analyzed in both cases.
+        auto sequentialResult = regionChecker->performRegionRefinement(this->env(), region, boost::none, 4);
+        auto parallelResult = regionChecker->performParallelRegionRefinement(this->env(), additionalCheckers, region, boost::none, 4);
+        EXPECT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+        EXPECT_EQ(sequentialResult->getSatFraction(), parallelResult->getSatFraction());
+        EXPECT_EQ(sequentialResult->getUnsatFraction(), parallelResult->getUnsatFraction());
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/models/sparse/Dtmc.h"
+
+TEST(CompiledFunctionEvaluatorTest, BrpProb) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::utility::parametric::CompiledFunctionEvaluator<storm::RationalFunction, storm::RationalNumber> evaluator;
+    std::vector<storm::RationalFunction> functions;
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        functions.push_back(entry.getValue());
+        EXPECT_EQ(evaluator.addFunction(entry.getValue()), evaluator.addFunction(functions.back()));
+    }
+    EXPECT_FALSE(evaluator.isCompiled());
+    evaluator.compile();
+    EXPECT_TRUE(evaluator.isCompiled());
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("4/5"))));
+    valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("9/10"))));
+
+    // Evaluating all functions at once.
+    std::vector<storm::RationalNumber> values;
+    evaluator.evaluate(valuation, values);
+    ASSERT_EQ(evaluator.getNumberOfFunctions(), values.size());
+
+    // The evaluation is exact, so converting to double afterwards yields the same values.
+    storm::utility::parametric::CompiledFunctionEvaluator<storm::RationalFunction, double> doubleEvaluator;
+    for (auto const& function : functions) {
+        doubleEvaluator.addFunction(function);
+    }
+    doubleEvaluator.compile();
+    std::vector<double> doubleValues;
+    doubleEvaluator.evaluate(valuation, doubleValues);
+    ASSERT_EQ(doubleEvaluator.getNumberOfFunctions(), doubleValues.size());
+
+    // Evaluating single functions.
+    std::vector<storm::RationalFunctionCoefficient> variableValues;
+    for (auto const& variable : evaluator.getVariables()) {
+        variableValues.push_back(valuation.at(variable));
+    }
+    std::vector<storm::RationalFunctionCoefficient> powerValues, monomialValues;
+
+    for (auto const& function : functions) {
+        storm::RationalNumber expected = storm::utility::convertNumber<storm::RationalNumber>(function.evaluate(valuation));
+        uint64_t index = evaluator.addFunction(function);
+        EXPECT_EQ(expected, values[index]);
+        EXPECT_EQ(expected, evaluator.evaluate(index, variableValues, powerValues, monomialValues));
+        EXPECT_EQ(carl::toDouble(function.evaluate(valuation)), doubleValues[doubleEvaluator.addFunction(function)]);
+    }
+}
+
+#endif
@@ -20,6 +20,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/modules/AbstractionSettings.h"
 
 TEST(PrismMenuGame, DieAbstractionTest_Cudd) {
@@ -852,6 +853,49 @@ TEST(PrismMenuGame, WlanAbstractionAndRefinementTest_Sylvan) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+TEST(PrismMenuGame, WlanConcurrentAbstractionAndRefinementTest_Cudd) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    // Abstracts the program (before and after a refinement) with the given number of threads and retrieves the sizes of the games.
+    auto computeGameSizes = [&] (uint64_t numberOfThreads) {
+        storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+        std::unique_ptr<storm::settings::SettingMemento> threadsMemento = storm::settings::mutableAbstractionSettings().overrideNumberOfThreads(numberOfThreads);
+        
+        std::vector<storm::expressions::Expression> initialPredicates;
+        initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+        initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+        initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+        
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        std::vector<uint64_t> sizes;
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        sizes.push_back(game.getNumberOfTransitions());
+        sizes.push_back(game.getNumberOfStates());
+        sizes.push_back(game.getBottomStates().getNonZeroCount());
+        
+        refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)});
+        game = abstractor.abstract();
+        sizes.push_back(game.getNumberOfTransitions());
+        sizes.push_back(game.getNumberOfStates());
+        sizes.push_back(game.getBottomStates().getNonZeroCount());
+        
+        storm::settings::mutableAbstractionSettings().restoreDefaults();
+        return sizes;
+    };
+    
+    std::vector<uint64_t> sequentialSizes = computeGameSizes(1);
+    EXPECT_EQ(std::vector<uint64_t>({915ull, 8ull, 4ull, 1824ull, 16ull, 8ull}), sequentialSizes);
+    EXPECT_EQ(sequentialSizes, computeGameSizes(4));
+}
+
 TEST(PrismMenuGame, WlanFullAbstractionTest_Cudd) {
     storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
 
@@ -6,6 +6,8 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Compositions.h"
 
@@ -15,6 +17,7 @@
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -695,3 +698,75 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+namespace {
+    
+    class CuddDdType {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    };
+    
+    class SylvanDdType {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    };
+    
+    template<typename TestType>
+    class DdJaniModelBuilderVariableOrderingTest : public ::testing::Test {
+    public:
+        template<typename ManagerType>
+        uint64_t getLowestIndex(ManagerType const& manager, std::string const& variableName) const {
+            return manager.getMetaVariable(manager.getMetaVariable(variableName)).getLowestIndex();
+        }
+    };
+    
+    typedef ::testing::Types<
+            CuddDdType,
+            SylvanDdType
+        > DdTypes;
+    
+    TYPED_TEST_CASE(DdJaniModelBuilderVariableOrderingTest, DdTypes);
+    
+    TYPED_TEST(DdJaniModelBuilderVariableOrderingTest, ForceVariableOrdering) {
+        typename storm::builder::DdJaniModelBuilder<TypeParam::ddType, double>::Options options;
+        options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+        
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        storm::builder::DdJaniModelBuilder<TypeParam::ddType, double> builder;
+        std::shared_ptr<storm::models::symbolic::Model<TypeParam::ddType>> model = builder.build(janiModel, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+        janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        model = builder.build(janiModel, options);
+        EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<TypeParam::ddType>> mdp = model->template as<storm::models::symbolic::Mdp<TypeParam::ddType>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates());
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+    }
+    
+    TYPED_TEST(DdJaniModelBuilderVariableOrderingTest, ForceVariableOrderingFromSettings) {
+        // The edges connect a with c and b with d, so FORCE places c before b.
+        std::string programAsString = "dtmc\n\nmodule main\n  a : bool init false;\n  b : bool init false;\n  c : bool init false;\n  d : bool init false;\n\n  [] true -> (a'=!a) & (c'=!c);\n  [] true -> (b'=!b) & (d'=!d);\nendmodule\n";
+        storm::storage::SymbolicModelDescription modelDescription(storm::parser::PrismParser::parseFromString(programAsString, "force.pm"));
+        storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        
+        std::shared_ptr<storm::models::symbolic::Model<TypeParam::ddType>> model = storm::builder::DdJaniModelBuilder<TypeParam::ddType, double>().build(janiModel);
+        EXPECT_EQ(4ul, model->getNumberOfStates());
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "b"), this->getLowestIndex(model->getManager(), "c"));
+        
+        {
+            std::unique_ptr<storm::settings::SettingMemento> ordering = storm::settings::mutableBuildSettings().overrideDdVariableOrdering(storm::builder::DdVariableOrdering::Force);
+            model = storm::builder::DdJaniModelBuilder<TypeParam::ddType, double>().build(janiModel);
+        }
+        EXPECT_TRUE(typename storm::builder::DdJaniModelBuilder<TypeParam::ddType, double>::Options().variableOrdering == storm::builder::DdVariableOrdering::Program);
+        EXPECT_EQ(4ul, model->getNumberOfStates());
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "a"), this->getLowestIndex(model->getManager(), "c"));
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "c"), this->getLowestIndex(model->getManager(), "b"));
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "b"), this->getLowestIndex(model->getManager(), "d"));
+    }
+    
+}
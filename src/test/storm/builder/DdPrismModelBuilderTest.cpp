@@ -4,6 +4,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -319,3 +321,73 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+namespace {
+    
+    class CuddDdType {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    };
+    
+    class SylvanDdType {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    };
+    
+    template<typename TestType>
+    class DdPrismModelBuilderVariableOrderingTest : public ::testing::Test {
+    public:
+        template<typename ManagerType>
+        uint64_t getLowestIndex(ManagerType const& manager, std::string const& variableName) const {
+            return manager.getMetaVariable(manager.getMetaVariable(variableName)).getLowestIndex();
+        }
+    };
+    
+    typedef ::testing::Types<
+            CuddDdType,
+            SylvanDdType
+        > DdTypes;
+    
+    TYPED_TEST_CASE(DdPrismModelBuilderVariableOrderingTest, DdTypes);
+    
+    TYPED_TEST(DdPrismModelBuilderVariableOrderingTest, ForceVariableOrdering) {
+        typename storm::builder::DdPrismModelBuilder<TypeParam::ddType>::Options options;
+        options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+        
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+        std::shared_ptr<storm::models::symbolic::Model<TypeParam::ddType>> model = storm::builder::DdPrismModelBuilder<TypeParam::ddType>().build(program, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+        program = modelDescription.preprocess().asPrismProgram();
+        model = storm::builder::DdPrismModelBuilder<TypeParam::ddType>().build(program, options);
+        EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<TypeParam::ddType>> mdp = model->template as<storm::models::symbolic::Mdp<TypeParam::ddType>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates());
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+    }
+    
+    TYPED_TEST(DdPrismModelBuilderVariableOrderingTest, ForceVariableOrderingFromSettings) {
+        // The commands connect a with c and b with d, so FORCE places c before b.
+        std::string programAsString = "dtmc\n\nmodule main\n  a : bool init false;\n  b : bool init false;\n  c : bool init false;\n  d : bool init false;\n\n  [] true -> (a'=!a) & (c'=!c);\n  [] true -> (b'=!b) & (d'=!d);\nendmodule\n";
+        storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "force.pm");
+        
+        std::shared_ptr<storm::models::symbolic::Model<TypeParam::ddType>> model = storm::builder::DdPrismModelBuilder<TypeParam::ddType>().build(program);
+        EXPECT_EQ(4ul, model->getNumberOfStates());
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "b"), this->getLowestIndex(model->getManager(), "c"));
+        
+        {
+            std::unique_ptr<storm::settings::SettingMemento> ordering = storm::settings::mutableBuildSettings().overrideDdVariableOrdering(storm::builder::DdVariableOrdering::Force);
+            EXPECT_TRUE(typename storm::builder::DdPrismModelBuilder<TypeParam::ddType>::Options().variableOrdering == storm::builder::DdVariableOrdering::Force);
+            model = storm::builder::DdPrismModelBuilder<TypeParam::ddType>().build(program);
+        }
+        EXPECT_TRUE(typename storm::builder::DdPrismModelBuilder<TypeParam::ddType>::Options().variableOrdering == storm::builder::DdVariableOrdering::Program);
+        EXPECT_EQ(4ul, model->getNumberOfStates());
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "a"), this->getLowestIndex(model->getManager(), "c"));
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "c"), this->getLowestIndex(model->getManager(), "b"));
+        EXPECT_LT(this->getLowestIndex(model->getManager(), "b"), this->getLowestIndex(model->getManager(), "d"));
+    }
+    
+}
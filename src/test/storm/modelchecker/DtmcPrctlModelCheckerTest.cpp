@@ -23,6 +23,9 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -369,6 +372,23 @@ namespace {
         }
     };
 
+    class DdCuddNativeFrontierJacobiEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Dd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().native().setSymbolicFrontierIteration(true);
+            return env;
+        }
+    };
+    
     class DdSylvanRationalSearchEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -492,6 +512,7 @@ namespace {
             HybridSylvanNativeRationalSearchEnvironment,
             DdSylvanNativePowerEnvironment,
             DdCuddNativeJacobiEnvironment,
+            DdCuddNativeFrontierJacobiEnvironment,
             DdSylvanRationalSearchEnvironment
         > TestingTypes;
     
@@ -573,6 +594,33 @@ namespace {
         result = checker->check(this->env(), tasks[2]);
         EXPECT_NEAR(this->parseNumber("25/24"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
     }
-
+    
+    TEST(HybridDtmcPrctlModelCheckerTest, Blockwise) {
+        typedef storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double> ModelType;
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F observe0>1]; P=? [F observe1>1]", program));
+        auto model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)->as<ModelType>();
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        storm::modelchecker::HybridDtmcPrctlModelChecker<ModelType> checker(*model);
+        storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStates(model->getReachableStates(), model->getInitialStates());
+        
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+            result->filter(initialStates);
+            double expected = result->asQuantitativeCheckResult<double>().getMin();
+            
+            // Solving block by block (with blocks of at least 1000 states) has to yield the same result.
+            std::unique_ptr<storm::settings::SettingMemento> blockwise = storm::settings::mutableModelCheckerSettings().overrideHybridBlockwiseSet(true);
+            result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+            result->filter(initialStates);
+            EXPECT_NEAR(expected, result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        }
+    }
 
 }
@@ -8,6 +8,7 @@
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
 
@@ -342,3 +343,55 @@ TEST(LraMdpPrctlModelCheckerTest, LRA) {
         EXPECT_NEAR(0.3 / 3., quantitativeResult2[14], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
     }
 }
+
+TEST(LraMdpPrctlModelCheckerTest, LRA_ConcurrentMecs) {
+    // An MDP whose initial state leads to three MECs of different size: {1, 2}, {3, 4, 5} and {6}.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(11, 7, 13, true, true, 7);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1);
+    matrixBuilder.addNextValue(1, 3, 1);
+    matrixBuilder.addNextValue(2, 1, 0.5);
+    matrixBuilder.addNextValue(2, 6, 0.5);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 1, 1);
+    matrixBuilder.addNextValue(4, 2, 1);
+    matrixBuilder.newRowGroup(5);
+    matrixBuilder.addNextValue(5, 1, 1);
+    matrixBuilder.newRowGroup(6);
+    matrixBuilder.addNextValue(6, 4, 1);
+    matrixBuilder.newRowGroup(7);
+    matrixBuilder.addNextValue(7, 3, 1);
+    matrixBuilder.addNextValue(8, 5, 1);
+    matrixBuilder.newRowGroup(9);
+    matrixBuilder.addNextValue(9, 3, 0.5);
+    matrixBuilder.addNextValue(9, 4, 0.5);
+    matrixBuilder.newRowGroup(10);
+    matrixBuilder.addNextValue(10, 6, 1);
+
+    storm::models::sparse::StateLabeling ap(7);
+    ap.addLabel("a");
+    ap.addLabelToState("a", 2);
+    ap.addLabelToState("a", 4);
+    ap.addLabelToState("a", 6);
+    storm::models::sparse::Mdp<double> mdp(matrixBuilder.build(), ap);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp);
+
+    storm::Environment sequentialEnv;
+    sequentialEnv.solver().minMax().setNumberOfLraThreads(1);
+    storm::Environment concurrentEnv;
+    concurrentEnv.solver().minMax().setNumberOfLraThreads(3);
+    
+    storm::parser::FormulaParser formulaParser;
+    for (std::string const& formulaString : {"LRAmax=? [\"a\"]", "LRAmin=? [\"a\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(sequentialEnv, *formula);
+        std::unique_ptr<storm::modelchecker::CheckResult> concurrentResult = checker.check(concurrentEnv, *formula);
+        for (uint64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
+            EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[state], concurrentResult->asExplicitQuantitativeCheckResult<double>()[state], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+        }
+    }
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(concurrentEnv, *formulaParser.parseSingleFormulaFromString("LRAmax=? [\"a\"]"));
+    EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[1], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[3], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
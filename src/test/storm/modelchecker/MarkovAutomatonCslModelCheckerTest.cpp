@@ -13,6 +13,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -267,4 +268,29 @@ namespace {
         EXPECT_TRUE(storm::utility::isInfinity(this->getQuantitativeResultAtInitialState(model, result)));
  
     }
-}
\ No newline at end of file
+    
+    TYPED_TEST(MarkovAutomatonCslModelCheckerTest, simple2ConcurrentMecs) {
+        // The MA has the two MECs {0, 1, 2, 5} and {3, 4}.
+        std::string formulasString = "R{\"rew2\"}max=? [LRA]";
+                    formulasString += "; R{\"rew2\"}min=? [LRA]";
+                    formulasString += "; LRAmax=? [s=3]";
+                    formulasString += "; LRAmin=? [s=3]";
+        
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/ma/simple2.ma", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        auto checker = this->createModelChecker(model);
+        
+        storm::Environment sequentialEnv = this->env();
+        sequentialEnv.solver().minMax().setNumberOfLraThreads(1);
+        storm::Environment concurrentEnv = this->env();
+        concurrentEnv.solver().minMax().setNumberOfLraThreads(2);
+        for (auto const& task : tasks) {
+            std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker->check(sequentialEnv, task);
+            std::unique_ptr<storm::modelchecker::CheckResult> concurrentResult = checker->check(concurrentEnv, task);
+            for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+                EXPECT_NEAR(sequentialResult->template asExplicitQuantitativeCheckResult<typename TestFixture::ValueType>()[state], concurrentResult->template asExplicitQuantitativeCheckResult<typename TestFixture::ValueType>()[state], this->precision());
+            }
+        }
+    }
+}
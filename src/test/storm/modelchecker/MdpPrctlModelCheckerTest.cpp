@@ -22,6 +22,9 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/logic/Formulas.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
@@ -73,6 +76,22 @@ namespace {
             return env;
         }
     };
+    class SparseDoubleOptimisticValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Sparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            return env;
+        }
+    };
     
     class SparseDoubleTopologicalValueIterationEnvironment {
     public:
@@ -234,6 +253,21 @@ namespace {
             return env;
         }
     };
+    class DdCuddDoubleFrontierValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Dd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            env.solver().minMax().setSymbolicFrontierIteration(true);
+            return env;
+        }
+    };
     class DdSylvanRationalRationalSearchEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -338,6 +372,7 @@ namespace {
             SparseDoubleValueIterationEnvironment,
             SparseDoubleIntervalIterationEnvironment,
             SparseDoubleSoundValueIterationEnvironment,
+            SparseDoubleOptimisticValueIterationEnvironment,
             SparseDoubleTopologicalValueIterationEnvironment,
             SparseDoubleTopologicalSoundValueIterationEnvironment,
             SparseRationalPolicyIterationEnvironment,
@@ -349,6 +384,7 @@ namespace {
             DdCuddDoubleValueIterationEnvironment,
             DdSylvanDoubleValueIterationEnvironment,
             DdCuddDoublePolicyIterationEnvironment,
+            DdCuddDoubleFrontierValueIterationEnvironment,
             DdSylvanRationalRationalSearchEnvironment
         > TestingTypes;
     
@@ -501,4 +537,33 @@ namespace {
             EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
         }
     }
+    
+    TEST(HybridMdpPrctlModelCheckerTest, Blockwise) {
+        typedef storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double> ModelType;
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"collision_max_backoff\"]; Pmax=? [F \"collision_max_backoff\"]; Pmin=? [!\"collision_max_backoff\" U \"all_delivered\"]", program));
+        auto model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)->as<ModelType>();
+        storm::modelchecker::HybridMdpPrctlModelChecker<ModelType> checker(*model);
+        storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStates(model->getReachableStates(), model->getInitialStates());
+        
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+            result->filter(initialStates);
+            double expected = result->asQuantitativeCheckResult<double>().getMin();
+            
+            // Solving block by block (with small blocks to obtain several of them) has to yield the same result.
+            {
+                std::unique_ptr<storm::settings::SettingMemento> blockwise = storm::settings::mutableModelCheckerSettings().overrideHybridBlockwiseSet(true);
+                std::unique_ptr<storm::settings::SettingMemento> minimalBlockSize = storm::settings::mutableModelCheckerSettings().overrideHybridMinimalBlockSize(10);
+                result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+            }
+            result->filter(initialStates);
+            EXPECT_NEAR(expected, result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        }
+    }
 }
\ No newline at end of file
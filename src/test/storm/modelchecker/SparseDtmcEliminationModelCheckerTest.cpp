@@ -7,8 +7,11 @@
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm-parsers/parser/AutoParser.h"
 
@@ -135,3 +138,37 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, CrowdsConcurrentSccs) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    // Use the hybrid elimination technique with small SCCs, such that many independent sub-SCCs exist.
+    std::unique_ptr<storm::settings::SettingMemento> methodMemento = storm::settings::mutableEliminationSettings().overrideEliminationMethod(storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid);
+    std::unique_ptr<storm::settings::SettingMemento> sccSizeMemento = storm::settings::mutableEliminationSettings().overrideMaximalSccSize(4);
+
+    storm::Environment sequentialEnv;
+    sequentialEnv.modelchecker().setNumberOfEliminationSccThreads(1);
+    storm::Environment concurrentEnv;
+    concurrentEnv.modelchecker().setNumberOfEliminationSccThreads(4);
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    for (std::string const& formulaString : {"P=? [F \"observe0Greater1\"]", "P=? [F \"observeOnlyTrueSender\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(sequentialEnv, *formula);
+        std::unique_ptr<storm::modelchecker::CheckResult> concurrentResult = checker.check(concurrentEnv, *formula);
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double>& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<double>();
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double>& concurrentValues = concurrentResult->asExplicitQuantitativeCheckResult<double>();
+
+        for (uint64_t state = 0; state < dtmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(sequentialValues[state], concurrentValues[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        }
+    }
+}
@@ -8,6 +8,7 @@
 #include "storm-parsers/parser/FormulaParser.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -86,3 +87,33 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, DiceConcurrent) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    std::vector<std::string> formulas = {"Pmin=? [F \"two\"]", "Pmax=? [F \"three\"]", "Pmin=? [F \"four\"]"};
+    std::vector<double> expectedResults = {0.0277777612209320068, 0.0555555224418640136, 0.083333283662796020508};
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulas[index]);
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        double sequentialResult = result->asExplicitQuantitativeCheckResult<double>()[0];
+        
+        double concurrentResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> threadsMemento = storm::settings::mutableExplorationSettings().overrideNumberOfThreads(4);
+            result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+            concurrentResult = result->asExplicitQuantitativeCheckResult<double>()[0];
+        }
+        
+        EXPECT_NEAR(expectedResults[index], sequentialResult, precision);
+        EXPECT_NEAR(expectedResults[index], concurrentResult, precision);
+        EXPECT_NEAR(sequentialResult, concurrentResult, precision);
+    }
+}
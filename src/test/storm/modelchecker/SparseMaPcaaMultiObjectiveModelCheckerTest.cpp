@@ -17,6 +17,8 @@
 #include "storm-parsers/api/storm-parsers.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, serverRationalNumbers) {
     storm::Environment env;
@@ -77,6 +79,35 @@ TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, server) {
 
 }
 
+TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, serverConcurrentSteps) {
+    storm::Environment env;
+    env.modelchecker().multi().setNumberOfConcurrentSteps(3);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/ma/server.ma";
+    std::string formulasAsString = "multi(Tmax=? [ F \"error\" ], Pmax=? [ F \"processB\" ]) "; // pareto
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *ma, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+
+    // The approximations have to be as precise as the ones obtained by checking one weight vector at a time.
+    std::vector<double> p = {11.0/6.0, 1.0/2.0};
+    std::vector<double> q = {29.0/18.0, 2.0/3.0};
+    auto expectedAchievableValues = storm::storage::geometry::Polytope<storm::RationalNumber>::createDownwardClosure(
+            std::vector<std::vector<storm::RationalNumber>>({storm::utility::vector::convertNumericVector<storm::RationalNumber>(p),
+                                                             storm::utility::vector::convertNumericVector<storm::RationalNumber>(q)}));
+    storm::RationalNumber eps = storm::utility::convertNumber<storm::RationalNumber>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    std::vector<storm::RationalNumber> lb(2,-eps), ub(2,eps);
+    auto bloatingBox = storm::storage::geometry::Hyperrectangle<storm::RationalNumber>(lb,ub).asPolytope();
+
+    EXPECT_TRUE(expectedAchievableValues->minkowskiSum(bloatingBox)->contains(result->asExplicitParetoCurveCheckResult<double>().getUnderApproximation()->convertNumberRepresentation<storm::RationalNumber>()));
+    EXPECT_TRUE(result->asExplicitParetoCurveCheckResult<double>().getOverApproximation()->convertNumberRepresentation<storm::RationalNumber>()->minkowskiSum(bloatingBox)->contains(expectedAchievableValues));
+}
+
 TEST(SparseMaPcaaMultiObjectiveModelCheckerTest, jobscheduler_pareto_3Obj) {
     storm::Environment env;
 
@@ -93,6 +93,20 @@ namespace {
         }
     };
     
+    class NativeDoubleMulticolorSorEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SOR);
+            env.solver().native().setNumberOfGaussSeidelThreads(2);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleWalkerChaeEnvironment {
     public:
         typedef double ValueType;
@@ -298,6 +312,7 @@ namespace {
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
+            NativeDoubleMulticolorSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
@@ -353,4 +368,41 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
+
+    TYPED_TEST(LinearEquationSolverTest, solveEquationSystemMultipleRightHandSides) {
+        typedef typename TestFixture::ValueType ValueType;
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(3));
+        std::vector<std::vector<ValueType>> b;
+        b.push_back({this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")});
+        b.push_back({this->parseNumber("6"), this->parseNumber("-0.02"), this->parseNumber("24")});
+        
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            A.convertToEquationSystem();
+        }
+        
+        auto solver = factory.create(this->env(), A);
+        solver->setBounds(this->parseNumber("-200"), this->parseNumber("200"));
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+        EXPECT_NEAR(x[0][0], this->parseNumber("481/9"), this->precision());
+        EXPECT_NEAR(x[0][1], this->parseNumber("457/9"), this->precision());
+        EXPECT_NEAR(x[0][2], this->parseNumber("875/18"), this->precision());
+        EXPECT_NEAR(x[1][0], this->parseNumber("962/9"), this->precision());
+        EXPECT_NEAR(x[1][1], this->parseNumber("914/9"), this->precision());
+        EXPECT_NEAR(x[1][2], this->parseNumber("875/9"), this->precision());
+    }
 }
\ No newline at end of file
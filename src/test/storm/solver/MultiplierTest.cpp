@@ -5,6 +5,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -75,6 +76,38 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
     }
     
+    TYPED_TEST(MultiplierTest, multiplyBlockTest) {
+        typedef typename TestFixture::ValueType ValueType;
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.25")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("0.75")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        // Two vectors (1,2,3) and (4,5,6) stored as a row-major block.
+        std::vector<ValueType> x = {this->parseNumber("1"), this->parseNumber("4"), this->parseNumber("2"), this->parseNumber("5"), this->parseNumber("3"), this->parseNumber("6")};
+        std::vector<ValueType> blockB(6, this->parseNumber("1"));
+        std::vector<ValueType> b(3, this->parseNumber("1"));
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        ASSERT_NO_THROW(multiplier->multiplyBlock(this->env(), x, &blockB, x, 2));
+        
+        // Each column has to coincide with the result of multiplying the corresponding vector.
+        for (uint64_t column = 0; column < 2; ++column) {
+            std::vector<ValueType> vector = {this->parseNumber(column == 0 ? "1" : "4"), this->parseNumber(column == 0 ? "2" : "5"), this->parseNumber(column == 0 ? "3" : "6")};
+            std::vector<ValueType> result(3);
+            multiplier->multiply(this->env(), vector, &b, result);
+            for (uint64_t row = 0; row < 3; ++row) {
+                EXPECT_NEAR(result[row], x[row * 2 + column], this->precision());
+            }
+        }
+    }
+    
     TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
         typedef typename TestFixture::ValueType ValueType;
     
@@ -120,4 +153,99 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, multiplyAndReduce2Test) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0.2"), this->parseNumber("0")};
+        std::vector<ValueType> lower = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0")};
+        std::vector<ValueType> upper = {this->parseNumber("1"), this->parseNumber("0.5"), this->parseNumber("2")};
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        // The fused multiplication has to coincide with two separate ones.
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<ValueType> expectedLower(3), expectedUpper(3), resultLower(3), resultUpper(3);
+            std::vector<uint_fast64_t> expectedLowerChoices(3), expectedUpperChoices(3), lowerChoices(3), upperChoices(3);
+            multiplier->multiplyAndReduce(this->env(), dir, lower, &b, expectedLower, &expectedLowerChoices);
+            multiplier->multiplyAndReduce(this->env(), dir, upper, &b, expectedUpper, &expectedUpperChoices);
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce2(this->env(), dir, lower, upper, &b, resultLower, resultUpper, &lowerChoices, &upperChoices));
+            for (uint64_t state = 0; state < 3; ++state) {
+                EXPECT_NEAR(expectedLower[state], resultLower[state], this->precision());
+                EXPECT_NEAR(expectedUpper[state], resultUpper[state], this->precision());
+                EXPECT_EQ(expectedLowerChoices[state], lowerChoices[state]);
+                EXPECT_EQ(expectedUpperChoices[state], upperChoices[state]);
+            }
+            
+            std::vector<ValueType> gaussSeidelLower = lower;
+            std::vector<ValueType> gaussSeidelUpper = upper;
+            multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, gaussSeidelLower, &b);
+            multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, gaussSeidelUpper, &b);
+            resultLower = lower;
+            resultUpper = upper;
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel2(this->env(), dir, resultLower, resultUpper, &b));
+            for (uint64_t state = 0; state < 3; ++state) {
+                EXPECT_NEAR(gaussSeidelLower[state], resultLower[state], this->precision());
+                EXPECT_NEAR(gaussSeidelUpper[state], resultUpper[state], this->precision());
+            }
+        }
+    }
+    
+    TEST(NativeMultiplierTest, multicolorGaussSeidelTest) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(0, 3, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, 1.0));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.3));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.7));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, 0.2));
+        ASSERT_NO_THROW(builder.addNextValue(3, 3, 0.8));
+        ASSERT_NO_THROW(builder.newRowGroup(4));
+        ASSERT_NO_THROW(builder.addNextValue(4, 3, 1.0));
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build());
+        std::vector<double> b = {0.1, 0.0, 0.2, 0.05, 0.0};
+        
+        storm::Environment sequentialEnv;
+        sequentialEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        storm::Environment multicolorEnv = sequentialEnv;
+        multicolorEnv.solver().native().setNumberOfGaussSeidelThreads(3);
+        
+        auto factory = storm::solver::MultiplierFactory<double>();
+        auto sequentialMultiplier = factory.create(sequentialEnv, A);
+        auto multicolorMultiplier = factory.create(multicolorEnv, A);
+        
+        // Both orders of the Gauss-Seidel sweeps converge to the same fixpoint.
+        std::vector<double> sequentialX(4, 0.0);
+        std::vector<double> multicolorX(4, 0.0);
+        std::vector<uint_fast64_t> sequentialChoices(4);
+        std::vector<uint_fast64_t> multicolorChoices(4);
+        for (uint64_t iteration = 0; iteration < 1000; ++iteration) {
+            sequentialMultiplier->multiplyAndReduceGaussSeidel(sequentialEnv, storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), sequentialX, &b, &sequentialChoices);
+            multicolorMultiplier->multiplyAndReduceGaussSeidel(multicolorEnv, storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), multicolorX, &b, &multicolorChoices);
+        }
+        for (uint64_t state = 0; state < 4; ++state) {
+            EXPECT_NEAR(sequentialX[state], multicolorX[state], 1e-12);
+            EXPECT_EQ(sequentialChoices[state], multicolorChoices[state]);
+        }
+    }
+    
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
@@ -564,3 +565,36 @@ TEST(BitVectorTest, CompareAndSwap) {
     result = vector.compareAndSwap(68, 0, 68);
     ASSERT_TRUE(result);
 }
+
+TEST(BitVectorTest, RankIndex) {
+    storm::storage::BitVector vector(10000);
+    for (uint_fast64_t i = 0; i < 10000; ++i) {
+        vector.set(i, i % 3 == 0 || (i > 5000 && i < 5100));
+    }
+    
+    storm::storage::BitVectorRankIndex rankIndex(vector);
+    ASSERT_EQ(vector.getNumberOfSetBits(), rankIndex.getNumberOfSetBits());
+    for (uint_fast64_t i = 0; i <= 10000; ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), rankIndex.rank(i));
+    }
+    
+    uint_fast64_t rank = 0;
+    for (auto bit : vector) {
+        ASSERT_EQ(bit, rankIndex.select(rank));
+        ++rank;
+    }
+    ASSERT_EQ(10000ul, rankIndex.select(rank));
+}
+
+TEST(BitVectorTest, RankIndexEmptyAndFull) {
+    storm::storage::BitVector empty(128);
+    storm::storage::BitVectorRankIndex emptyIndex(empty);
+    ASSERT_EQ(0ul, emptyIndex.rank(128));
+    ASSERT_EQ(128ul, emptyIndex.select(0));
+    
+    storm::storage::BitVector full(4097, true);
+    storm::storage::BitVectorRankIndex fullIndex(full);
+    ASSERT_EQ(4097ul, fullIndex.rank(4097));
+    ASSERT_EQ(4096ul, fullIndex.select(4096));
+    ASSERT_EQ(4097ul, fullIndex.select(4097));
+}
@@ -5,12 +5,15 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <thread>
+
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     storm::dd::Add<storm::dd::DdType::CUDD, double> zero;
@@ -778,3 +781,58 @@ TEST(CuddDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, OperationStatistics) {
+    storm::dd::DdOperationStatistics& statistics = storm::dd::DdOperationStatistics::getInstance();
+    statistics.reset();
+    statistics.setEnabled(true);
+    
+    {
+        std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+        
+        storm::dd::DdOperationScope scope("test");
+        storm::dd::Bdd<storm::dd::DdType::CUDD> bdd = manager->template getIdentity<double>(x.first).equals(manager->template getConstant<double>(5));
+        bdd = bdd.existsAbstract({x.first});
+        EXPECT_TRUE(bdd.isOne());
+    }
+    statistics.setEnabled(false);
+    
+    std::stringstream stream;
+    statistics.exportToJson(stream);
+    std::string json = stream.str();
+    EXPECT_NE(std::string::npos, json.find("\"existsAbstract\""));
+    EXPECT_NE(std::string::npos, json.find("\"test\""));
+    EXPECT_NE(std::string::npos, json.find("\"cudd\""));
+    EXPECT_NE(std::string::npos, json.find("\"cache-lookups\""));
+    statistics.reset();
+}
+
+TEST(CuddDd, OperationStatisticsScopesPerThread) {
+    storm::dd::DdOperationStatistics& statistics = storm::dd::DdOperationStatistics::getInstance();
+    statistics.reset();
+    statistics.setEnabled(true);
+    
+    {
+        std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+        
+        // The scope entered by this thread must not be attributed to the operations of the other thread.
+        storm::dd::DdOperationScope scope("main");
+        std::thread worker([&manager, &x] () {
+            storm::dd::DdOperationScope workerScope("worker");
+            storm::dd::Bdd<storm::dd::DdType::CUDD> bdd = manager->template getIdentity<double>(x.first).equals(manager->template getConstant<double>(5));
+            bdd = bdd.existsAbstract({x.first});
+            EXPECT_TRUE(bdd.isOne());
+        });
+        worker.join();
+    }
+    statistics.setEnabled(false);
+    
+    std::stringstream stream;
+    statistics.exportToJson(stream);
+    std::string json = stream.str();
+    EXPECT_NE(std::string::npos, json.find("\"worker\""));
+    EXPECT_EQ(std::string::npos, json.find("main/worker"));
+    statistics.reset();
+}
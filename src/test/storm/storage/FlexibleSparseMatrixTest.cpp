@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(FlexibleSparseMatrix, ConversionRoundTrip) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 3, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.6));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 1.0));
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    ASSERT_EQ(3ul, flexibleMatrix.getRowCount());
+    ASSERT_EQ(2ul, flexibleMatrix.getRow(0).size());
+    EXPECT_TRUE(flexibleMatrix.rowHasDiagonalElement(1));
+    EXPECT_FALSE(flexibleMatrix.rowHasDiagonalElement(0));
+
+    // Growing a row beyond its capacity moves it to a larger block.
+    for (uint64_t i = 0; i < 100; ++i) {
+        flexibleMatrix.getRow(2).emplace_back(2, 0.0);
+    }
+    flexibleMatrix.getRow(2).erase(flexibleMatrix.getRow(2).begin() + 1, flexibleMatrix.getRow(2).end());
+    flexibleMatrix.getRow(2).shrink_to_fit();
+
+    storm::storage::SparseMatrix<double> result = flexibleMatrix.createSparseMatrix();
+    ASSERT_EQ(5ul, result.getEntryCount());
+    for (uint64_t row = 0; row < 3; ++row) {
+        EXPECT_EQ(matrix.getRowSum(row), result.getRowSum(row));
+    }
+}
+
+TEST(FlexibleSparseMatrix, RowPoolReusesBlocks) {
+    storm::storage::detail::FlexibleRowPool::releaseFreeBlocks();
+    EXPECT_EQ(0ul, storm::storage::detail::FlexibleRowPool::getNumberOfFreeBytes());
+
+    typedef storm::storage::FlexibleSparseMatrix<double>::row_type RowType;
+    void const* firstBlock;
+    {
+        RowType row(10);
+        firstBlock = row.data();
+    }
+    EXPECT_LT(0ul, storm::storage::detail::FlexibleRowPool::getNumberOfFreeBytes());
+
+    // A row of the same size class obtains the block that was just freed.
+    RowType row(9);
+    EXPECT_EQ(firstBlock, static_cast<void const*>(row.data()));
+    EXPECT_EQ(0ul, storm::storage::detail::FlexibleRowPool::getNumberOfFreeBytes());
+}
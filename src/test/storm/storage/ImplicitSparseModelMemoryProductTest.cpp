@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/solver/ModelMemoryProductMultiplier.h"
+#include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/storage/memorystructure/ImplicitSparseModelMemoryProduct.h"
+#include "storm/storage/memorystructure/MemoryStructure.h"
+#include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
+
+namespace {
+    // An MDP in which state 0 either moves to states 1 and 2 or loops and states 1 and 2 are absorbing, together with a memory structure that
+    // remembers whether state 2 was entered.
+    storm::models::sparse::Mdp<double> createMdp() {
+        storm::storage::SparseMatrixBuilder<double> builder(4, 3, 5, true, true, 3);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(0, 2, 0.5);
+        builder.addNextValue(1, 0, 1.0);
+        builder.newRowGroup(2);
+        builder.addNextValue(2, 1, 1.0);
+        builder.newRowGroup(3);
+        builder.addNextValue(3, 2, 1.0);
+
+        storm::models::sparse::StateLabeling labeling(3);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 0);
+        return storm::models::sparse::Mdp<double>(builder.build(), labeling);
+    }
+
+    storm::storage::MemoryStructure createMemory() {
+        // The transitions entering state 2 are the second entry of row 0 and the entry of row 3.
+        storm::storage::BitVector enterTwo(5, {1, 4});
+        storm::storage::MemoryStructure::TransitionMatrix transitions(2, std::vector<boost::optional<storm::storage::BitVector>>(2));
+        transitions[0][0] = ~enterTwo;
+        transitions[0][1] = enterTwo;
+        transitions[1][1] = storm::storage::BitVector(5, true);
+        return storm::storage::MemoryStructure(transitions, storm::models::sparse::StateLabeling(2), {0});
+    }
+}
+
+TEST(ImplicitSparseModelMemoryProductTest, MatchesFullProduct) {
+    storm::models::sparse::Mdp<double> mdp = createMdp();
+    storm::storage::MemoryStructure memory = createMemory();
+
+    storm::storage::SparseModelMemoryProduct<double> productBuilder(mdp, memory);
+    productBuilder.setBuildFullProduct();
+    storm::storage::SparseMatrix<double> productMatrix = productBuilder.build()->getTransitionMatrix();
+
+    storm::storage::ImplicitSparseModelMemoryProduct<double> implicitProduct(mdp.getTransitionMatrix(), memory);
+    ASSERT_EQ(productMatrix.getRowGroupCount(), implicitProduct.getNumberOfStates());
+    ASSERT_EQ(productMatrix.getRowCount(), implicitProduct.getNumberOfRows());
+    EXPECT_EQ(storm::storage::BitVector(6, std::vector<uint_fast64_t>({0})), implicitProduct.getInitialStates(mdp.getInitialStates()));
+
+    EXPECT_EQ(productMatrix.getRowGroupIndices(), implicitProduct.getRowGroupIndices());
+    for (uint64_t row = 0; row < implicitProduct.getNumberOfRows(); ++row) {
+        auto const& implicitRow = implicitProduct.getRow(row);
+        auto productRow = productMatrix.getRow(row);
+        ASSERT_EQ(productRow.getNumberOfEntries(), implicitRow.size());
+        auto implicitIt = implicitRow.begin();
+        for (auto const& entry : productRow) {
+            EXPECT_EQ(entry.getColumn(), implicitIt->getColumn());
+            EXPECT_EQ(entry.getValue(), implicitIt->getValue());
+            ++implicitIt;
+        }
+    }
+
+    std::vector<double> x = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> b = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    std::vector<double> expected(8);
+    std::vector<double> result(8);
+    productMatrix.multiplyWithVector(x, expected, &b);
+    implicitProduct.multiply(x, &b, result);
+    for (uint64_t row = 0; row < result.size(); ++row) {
+        EXPECT_NEAR(expected[row], result[row], 1e-12);
+    }
+
+    std::vector<double> reduced(6);
+    std::vector<uint_fast64_t> choices(6);
+    implicitProduct.multiplyAndReduce(storm::OptimizationDirection::Maximize, x, &b, reduced, &choices);
+    EXPECT_NEAR(std::max(expected[0], expected[1]), reduced[0], 1e-12);
+    EXPECT_NEAR(std::max(expected[2], expected[3]), reduced[1], 1e-12);
+    EXPECT_EQ(1ul, choices[0]);
+    EXPECT_NEAR(expected[7], reduced[5], 1e-12);
+    implicitProduct.multiplyAndReduce(storm::OptimizationDirection::Minimize, x, &b, reduced, &choices);
+    EXPECT_NEAR(std::min(expected[0], expected[1]), reduced[0], 1e-12);
+    EXPECT_EQ(0ul, choices[0]);
+}
+
+TEST(ImplicitSparseModelMemoryProductTest, RowCache) {
+    storm::models::sparse::Mdp<double> mdp = createMdp();
+    storm::storage::MemoryStructure memory = createMemory();
+
+    storm::storage::ImplicitSparseModelMemoryProduct<double> uncachedProduct(mdp.getTransitionMatrix(), memory);
+    storm::storage::ImplicitSparseModelMemoryProduct<double> cachedProduct(mdp.getTransitionMatrix(), memory, 3);
+
+    std::vector<double> x = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> expected(6);
+    std::vector<double> result(6);
+    uncachedProduct.multiplyAndReduce(storm::OptimizationDirection::Maximize, x, nullptr, expected);
+    EXPECT_EQ(0ul, uncachedProduct.getNumberOfCachedEntries());
+
+    // The cache is filled with the first rows and used in the subsequent multiplications.
+    for (uint64_t iteration = 0; iteration < 2; ++iteration) {
+        cachedProduct.multiplyAndReduce(storm::OptimizationDirection::Maximize, x, nullptr, result);
+        EXPECT_EQ(3ul, cachedProduct.getNumberOfCachedEntries());
+        for (uint64_t state = 0; state < result.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-12);
+        }
+    }
+}
+
+TEST(ImplicitSparseModelMemoryProductTest, ValueIteration) {
+    storm::models::sparse::Mdp<double> mdp = createMdp();
+    storm::storage::MemoryStructure memory = createMemory();
+    storm::Environment env;
+
+    storm::storage::SparseModelMemoryProduct<double> productBuilder(mdp, memory);
+    productBuilder.setBuildFullProduct();
+    storm::storage::SparseMatrix<double> productMatrix = productBuilder.build()->getTransitionMatrix();
+    storm::solver::NativeMultiplier<double> productMatrixMultiplier(productMatrix);
+
+    storm::storage::ImplicitSparseModelMemoryProduct<double> implicitProduct(mdp.getTransitionMatrix(), memory, 4);
+    storm::solver::ModelMemoryProductMultiplier<double> implicitProductMultiplier(implicitProduct);
+
+    // Starting from the product states with memory state 1 (which is never left), value iteration converges to the
+    // probability of entering state 2.
+    std::vector<double> initialX = {0.0, 1.0, 0.0, 1.0, 0.0, 1.0};
+    for (auto const& dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        for (auto const& style : {storm::solver::MultiplicationStyle::Regular, storm::solver::MultiplicationStyle::GaussSeidel}) {
+            std::vector<double> expected = initialX;
+            storm::solver::helper::ValueIterationHelper<double> productMatrixHelper(productMatrixMultiplier);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, productMatrixHelper.solveEquations(env, dir, expected, nullptr, 1e-8, false, 10000, style));
+
+            std::vector<double> result = initialX;
+            storm::solver::helper::ValueIterationHelper<double> implicitProductHelper(implicitProductMultiplier);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, implicitProductHelper.solveEquations(env, dir, result, nullptr, 1e-8, false, 10000, style));
+            for (uint64_t state = 0; state < result.size(); ++state) {
+                EXPECT_NEAR(expected[state], result[state], 1e-12);
+            }
+            EXPECT_NEAR(dir == storm::OptimizationDirection::Minimize ? 0.0 : 0.5, result[0], 1e-6);
+        }
+    }
+}
@@ -7,6 +7,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -954,3 +955,29 @@ TEST(SylvanDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, OperationStatistics) {
+    storm::dd::DdOperationStatistics& statistics = storm::dd::DdOperationStatistics::getInstance();
+    statistics.reset();
+    statistics.setEnabled(true);
+    
+    {
+        std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+        
+        storm::dd::DdOperationScope scope("test");
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> bdd = manager->template getIdentity<double>(x.first).equals(manager->template getConstant<double>(5));
+        bdd = bdd.existsAbstract({x.first});
+        EXPECT_TRUE(bdd.isOne());
+    }
+    statistics.setEnabled(false);
+    
+    std::stringstream stream;
+    statistics.exportToJson(stream);
+    std::string json = stream.str();
+    EXPECT_NE(std::string::npos, json.find("\"existsAbstract\""));
+    EXPECT_NE(std::string::npos, json.find("\"test\""));
+    EXPECT_NE(std::string::npos, json.find("\"sylvan\""));
+    EXPECT_NE(std::string::npos, json.find("\"cache-lookups\""));
+    statistics.reset();
+}
@@ -11,9 +11,12 @@
 
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/SymbolicMinMaxLinearEquationSolver.h"
@@ -21,6 +24,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm-parsers/parser/FormulaParser.h"
 
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -28,6 +32,23 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+namespace {
+    template<storm::dd::DdType DdType>
+    std::shared_ptr<storm::models::sparse::Model<double>> computeSparseQuotient(storm::prism::Program const& program, std::shared_ptr<storm::logic::Formula const> const& formula) {
+        std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program, *formula);
+        model->reduceToStateBasedRewards();
+        
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        formulas.push_back(formula);
+        
+        storm::dd::BisimulationDecomposition<DdType, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+        decomposition.compute();
+        std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient(storm::settings::modules::BisimulationSettings::QuotientFormat::Sparse);
+        EXPECT_TRUE(quotient->isSparseModel());
+        return quotient->as<storm::models::sparse::Model<double>>();
+    }
+}
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     
@@ -467,3 +488,53 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+TEST(SymbolicModelBisimulationDecomposition, CrowdsSparseQuotient_SylvanVsCudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> cuddQuotient = computeSparseQuotient<storm::dd::DdType::CUDD>(smd.asPrismProgram(), formula);
+    std::shared_ptr<storm::models::sparse::Model<double>> sylvanQuotient = computeSparseQuotient<storm::dd::DdType::Sylvan>(smd.asPrismProgram(), formula);
+    
+    EXPECT_EQ(65ul, sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(105ul, sylvanQuotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, sylvanQuotient->getType());
+    EXPECT_EQ(cuddQuotient->getNumberOfStates(), sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(cuddQuotient->getNumberOfTransitions(), sylvanQuotient->getNumberOfTransitions());
+    
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> cuddChecker(*cuddQuotient->as<storm::models::sparse::Dtmc<double>>());
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> sylvanChecker(*sylvanQuotient->as<storm::models::sparse::Dtmc<double>>());
+    std::unique_ptr<storm::modelchecker::CheckResult> cuddResult = cuddChecker.check(*formula);
+    std::unique_ptr<storm::modelchecker::CheckResult> sylvanResult = sylvanChecker.check(*formula);
+    EXPECT_NEAR(cuddResult->asExplicitQuantitativeCheckResult<double>()[*cuddQuotient->getInitialStates().begin()], sylvanResult->asExplicitQuantitativeCheckResult<double>()[*sylvanQuotient->getInitialStates().begin()], 1e-6);
+    EXPECT_NEAR(0.3328800375801578281, sylvanResult->asExplicitQuantitativeCheckResult<double>()[*sylvanQuotient->getInitialStates().begin()], 1e-6);
+}
+
+TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeaderSparseQuotient_SylvanVsCudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Rmax=? [F \"elected\"]");
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> cuddQuotient = computeSparseQuotient<storm::dd::DdType::CUDD>(smd.asPrismProgram(), formula);
+    std::shared_ptr<storm::models::sparse::Model<double>> sylvanQuotient = computeSparseQuotient<storm::dd::DdType::Sylvan>(smd.asPrismProgram(), formula);
+    
+    EXPECT_EQ(storm::models::ModelType::Mdp, sylvanQuotient->getType());
+    EXPECT_EQ(cuddQuotient->getNumberOfStates(), sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(cuddQuotient->getNumberOfTransitions(), sylvanQuotient->getNumberOfTransitions());
+    EXPECT_EQ(cuddQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices(), sylvanQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> cuddChecker(*cuddQuotient->as<storm::models::sparse::Mdp<double>>());
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> sylvanChecker(*sylvanQuotient->as<storm::models::sparse::Mdp<double>>());
+    std::unique_ptr<storm::modelchecker::CheckResult> cuddResult = cuddChecker.check(*formula);
+    std::unique_ptr<storm::modelchecker::CheckResult> sylvanResult = sylvanChecker.check(*formula);
+    EXPECT_NEAR(cuddResult->asExplicitQuantitativeCheckResult<double>()[*cuddQuotient->getInitialStates().begin()], sylvanResult->asExplicitQuantitativeCheckResult<double>()[*sylvanQuotient->getInitialStates().begin()], 1e-6);
+}
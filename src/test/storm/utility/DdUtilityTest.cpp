@@ -0,0 +1,36 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/utility/dd.h"
+
+#include <algorithm>
+
+TEST(DdUtilityTest, ForceVariableOrderWithoutHyperedges) {
+    std::vector<uint64_t> order = storm::utility::dd::computeForceVariableOrder(4, {});
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, 3}), order);
+    
+    // Variables that are not connected to any other variable keep their positions.
+    order = storm::utility::dd::computeForceVariableOrder(3, {{1}});
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), order);
+}
+
+TEST(DdUtilityTest, ForceVariableOrderPlacesConnectedVariablesNextToEachOther) {
+    // Variable 0 interacts with 2 and variable 1 with 3, so the initial order has a total span of 4.
+    std::vector<uint64_t> order = storm::utility::dd::computeForceVariableOrder(4, {{0, 2}, {1, 3}});
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 1, 3}), order);
+    
+    // A chain 3 - 0 - 2 - 1 that is declared in the wrong order.
+    order = storm::utility::dd::computeForceVariableOrder(4, {{0, 3}, {0, 2}, {1, 2}});
+    ASSERT_EQ(4ul, order.size());
+    std::vector<uint64_t> positions(order.size());
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        positions[order[position]] = position;
+    }
+    std::vector<uint64_t> sortedOrder = order;
+    std::sort(sortedOrder.begin(), sortedOrder.end());
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, 3}), sortedOrder);
+    uint64_t totalSpan = 0;
+    for (auto const& hyperedge : std::vector<std::pair<uint64_t, uint64_t>>({{0, 3}, {0, 2}, {1, 2}})) {
+        totalSpan += std::max(positions[hyperedge.first], positions[hyperedge.second]) - std::min(positions[hyperedge.first], positions[hyperedge.second]);
+    }
+    EXPECT_LT(totalSpan, 6ul);
+}
@@ -103,3 +103,33 @@ TEST(KSPTest, kspPathAsList) {
 //    auto reference = storm::utility::ksp::OrderedStateList{296, 288, 281, 272, 266, 260, 253, 245, 238, 230, 224, 218, 211, 203, 196, 188, 182, 176, 169, 161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0};
 //    EXPECT_EQ(reference, list);
 }
+
+TEST(KSPTest, streamPathsInOrder) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    double previousDistance = 1.0;
+    for (unsigned long k = 1; k <= 1000; ++k) {
+        ASSERT_TRUE(spg.computeNextPath());
+        ASSERT_EQ(k, spg.getNumberOfComputedPaths());
+        double distance = spg.getDistance(k);
+        EXPECT_LE(distance, previousDistance);
+        previousDistance = distance;
+    }
+    EXPECT_NEAR(1.5231305000339662e-06, spg.getDistance(100), 1e-12);
+    EXPECT_NEAR(3.0462610000679315e-08, spg.getDistance(500), 1e-12);
+
+    // Each path leads from the initial state to the target.
+    auto list = spg.getPathAsList(1000);
+    EXPECT_EQ(testState, list.front());
+    EXPECT_TRUE(model->getInitialStates().get(list.back()));
+}
+
+TEST(KSPTest, streamEndsWithLastPath) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, stateWithOnlyOnePath);
+
+    EXPECT_TRUE(spg.computeNextPath());
+    EXPECT_FALSE(spg.computeNextPath());
+    EXPECT_EQ(1ul, spg.getNumberOfComputedPaths());
+}